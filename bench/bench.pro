@@ -18,7 +18,7 @@
 ##------------------------------------------------------------------------##
 QT -= gui
 
-CONFIG += c++11 console testcase
+CONFIG += c++14 console testcase
 CONFIG -= app_bundle
 
 GOOGLE_BENCH_HOME = /home/zcobell/Development/google-benchmark
@@ -39,9 +39,9 @@ DEFINES += QT_DEPRECATED_WARNINGS
 
 SOURCES += main.cpp
 
-win32:CONFIG(release, debug|release): LIBS += -L$$OUT_PWD/../ADCIRCModules_lib/release/ -ladcircmodules
-else:win32:CONFIG(debug, debug|release): LIBS += -L$$OUT_PWD/../ADCIRCModules_lib/debug/ -ladcircmodules
-else:unix: LIBS += -L$$OUT_PWD/../ADCIRCModules_lib/ -ladcircmodules
+win32:CONFIG(release, debug|release): LIBS += -L$$OUT_PWD/../src/release/ -ladcircmodules
+else:win32:CONFIG(debug, debug|release): LIBS += -L$$OUT_PWD/../src/debug/ -ladcircmodules
+else:unix: LIBS += -L$$OUT_PWD/../src/ -ladcircmodules
 
-INCLUDEPATH += $$PWD/../ADCIRCModules_lib
-DEPENDPATH += $$PWD/../ADCIRCModules_lib
+INCLUDEPATH += $$PWD/../src $$PWD/../thirdparty/boost_1_66_0
+DEPENDPATH += $$PWD/../src
@@ -16,20 +16,179 @@
 // You should have received a copy of the GNU General Public License
 // along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
 //------------------------------------------------------------------------//
-#include "adcircmesh.h"
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "adcircmodules.h"
 #include "benchmark/benchmark.h"
-#include <QCoreApplication>
-#include <QPointer>
+#include "boost/format.hpp"
+#include "fileio.h"
 
 static void bench_readmesh(benchmark::State &state) {
-  AdcircMesh *mesh = new AdcircMesh(
-      std::string("/home/zcobell/Development/QADCModules/testing/test_files/ms-riv.grd"));
+  Adcirc::Geometry::Mesh mesh(std::string(
+      "/home/zcobell/Development/QADCModules/testing/test_files/ms-riv.grd"));
+  while (state.KeepRunning()) {
+    mesh.read();
+  }
+}
+
+//...Synthetic hourly time series for a set of stations
+static void buildStations(Adcirc::Output::Hmdf &h, size_t nstations,
+                          size_t nsnaps) {
+  h.setDatum("MSL");
+  h.setUnits("m");
+  for (size_t s = 0; s < nstations; ++s) {
+    Adcirc::Output::HmdfStation station(false);
+    station.setName("station_" + std::to_string(s));
+    station.setLatitude(29.0 + 0.01 * s);
+    station.setLongitude(-90.0 - 0.01 * s);
+    station.reserve(nsnaps);
+    Adcirc::CDate d(2011, 1, 1, 0, 0, 0);
+    for (size_t i = 0; i < nsnaps; ++i) {
+      station.setNext(d, std::sin(0.001 * i + s) * 1.25);
+      d.addSeconds(3600);
+    }
+    h.addStation(station);
+  }
+}
+
+static const std::string c_benchImeds = "bench_hmdf.imeds";
+
+static void writeBenchFile(size_t nstations, size_t nsnaps) {
+  Adcirc::Output::Hmdf h;
+  buildStations(h, nstations, nsnaps);
+  h.writeImeds(c_benchImeds);
+}
+
+//...Line by line reader that was used before the file was memory mapped
+static void readImedsLegacy(const std::string &filename,
+                            Adcirc::Output::Hmdf &h) {
+  std::ifstream fid(filename);
+  std::string templine;
+  std::getline(fid, templine);
+  std::getline(fid, templine);
+  std::getline(fid, templine);
+  std::getline(fid, templine);
+  while (!fid.eof()) {
+    Adcirc::Output::HmdfStation station(false);
+    templine = Adcirc::FileIO::Generic::sanitizeString(templine);
+    std::vector<std::string> templist;
+    Adcirc::FileIO::Generic::splitString(templine, templist);
+    station.setName(templist[0]);
+    station.setLongitude(stod(templist[2]));
+    station.setLatitude(stod(templist[1]));
+    while (!fid.eof()) {
+      std::getline(fid, templine);
+      int year, month, day, hour, minute, second;
+      double value;
+      if (Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(
+              templine, year, month, day, hour, minute, second, value)) {
+        station.setNext(Adcirc::CDate(year, month, day, hour, minute, second),
+                        value);
+      } else {
+        break;
+      }
+    }
+    h.addStation(station);
+  }
+}
+
+//...Stream writer that was used before the output was buffered
+static void writeImedsLegacy(const std::string &filename,
+                             Adcirc::Output::Hmdf &h) {
+  std::ofstream out(filename);
+  out << "% IMEDS generic format\n";
+  out << "% year month day hour min sec value\n";
+  out << "% ADCIRCModules UTC " << h.datum() << " " << h.units() << "\n";
+  for (size_t s = 0; s < h.nstations(); ++s) {
+    Adcirc::Output::HmdfStation *station = h.station(s);
+    out << boost::str(boost::format("%s   %16.10f   %16.10f\n") %
+                      station->name() % station->latitude() %
+                      station->longitude());
+    for (size_t i = 0; i < station->numSnaps(); ++i) {
+      Adcirc::CDate d = station->date(i);
+      out << boost::str(
+          boost::format("%04.4i %02.2i %02.2i %02.2i %02.2i %02.2i %10.6e\n") %
+          d.year() % d.month() % d.day() % d.hour() % d.minute() % d.second() %
+          station->data(i));
+    }
+  }
+}
+
+static void bench_readImeds(benchmark::State &state) {
+  writeBenchFile(state.range(0), state.range(1));
+  while (state.KeepRunning()) {
+    Adcirc::Output::Hmdf h;
+    h.readImeds(c_benchImeds);
+    benchmark::DoNotOptimize(h.nstations());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) *
+                          state.range(1));
+}
+
+static void bench_readImedsLegacy(benchmark::State &state) {
+  writeBenchFile(state.range(0), state.range(1));
+  while (state.KeepRunning()) {
+    Adcirc::Output::Hmdf h;
+    readImedsLegacy(c_benchImeds, h);
+    benchmark::DoNotOptimize(h.nstations());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) *
+                          state.range(1));
+}
+
+static void bench_writeImeds(benchmark::State &state) {
+  Adcirc::Output::Hmdf h;
+  buildStations(h, state.range(0), state.range(1));
+  while (state.KeepRunning()) {
+    h.writeImeds(c_benchImeds);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) *
+                          state.range(1));
+}
+
+static void bench_writeImedsColumnar(benchmark::State &state) {
+  Adcirc::Output::Hmdf h;
+  buildStations(h, state.range(0), state.range(1));
+  Adcirc::Output::Hmdf c;
+  c.copyStationList(h);
+  c.allocate(state.range(1));
+  for (size_t i = 0; i < c.numSnaps(); ++i) {
+    c.setTime(i, h.station(0)->date(i));
+    for (size_t s = 0; s < c.nstations(); ++s) {
+      c.setValue(s, i, h.station(s)->data(i));
+    }
+  }
+  while (state.KeepRunning()) {
+    c.writeImeds(c_benchImeds);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) *
+                          state.range(1));
+}
+
+static void bench_writeImedsLegacy(benchmark::State &state) {
+  Adcirc::Output::Hmdf h;
+  buildStations(h, state.range(0), state.range(1));
   while (state.KeepRunning()) {
-    mesh->read();
+    writeImedsLegacy(c_benchImeds, h);
   }
-  delete mesh;
+  state.SetItemsProcessed(state.iterations() * state.range(0) *
+                          state.range(1));
 }
 
 BENCHMARK(bench_readmesh);
+BENCHMARK(bench_readImeds)->Args({100, 8760})->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_readImedsLegacy)
+    ->Args({100, 8760})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_writeImeds)->Args({100, 8760})->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_writeImedsColumnar)
+    ->Args({100, 8760})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_writeImedsLegacy)
+    ->Args({100, 8760})
+    ->Unit(benchmark::kMillisecond);
 
 BENCHMARK_MAIN()
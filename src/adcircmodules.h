@@ -35,8 +35,12 @@
 #include "logging.h"
 #include "mesh.h"
 #include "meshchecker.h"
+#include "meshcheckreport.h"
+#include "meshintersection.h"
+#include "meshdiff.h"
 #include "multithreading.h"
 #include "nodalattributes.h"
+#include "progressmonitor.h"
 #include "readoutput.h"
 #include "writeoutput.h"
 
@@ -17,6 +17,7 @@
 // along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
 //------------------------------------------------------------------------*/
 #include "attribute.h"
+#include <algorithm>
 #include <cassert>
 #include <limits>
 #include "boost/format.hpp"
@@ -29,7 +30,12 @@ using namespace Adcirc::ModelParameters;
  * @brief Default Constructor
  */
 Attribute::Attribute()
-    : m_id(adcircmodules_default_value<size_t>()), m_node(nullptr) {
+    : m_id(adcircmodules_default_value<size_t>()),
+      m_node(nullptr),
+      m_data(nullptr),
+      m_size(0),
+      m_nonDefault(nullptr),
+      m_mask(0) {
   this->resize(1);
 }
 
@@ -38,14 +44,100 @@ Attribute::Attribute()
  * @param[in] size Number of nodal attributes to size this object for
  */
 Attribute::Attribute(size_t size)
-    : m_id(adcircmodules_default_value<size_t>()), m_node(nullptr) {
+    : m_id(adcircmodules_default_value<size_t>()),
+      m_node(nullptr),
+      m_data(nullptr),
+      m_size(0),
+      m_nonDefault(nullptr),
+      m_mask(0) {
   this->resize(size);
 }
 
+/**
+ * @brief Constructs a view of the values for one node in a nodal attribute
+ * array
+ * @param[in] owner storage of the nodal attribute array, which is kept alive
+ * for the lifetime of the view
+ * @param[in] data pointer to the first value for the node
+ * @param[in] size number of values for the node
+ * @param[in] id node id used in the nodal attributes file
+ * @param[in] node pointer to the mesh node, if available
+ * @param[in] nonDefault word of the non-default bitmap that holds this node
+ * @param[in] mask bit for this node within the bitmap word
+ */
+Attribute::Attribute(std::shared_ptr<void> owner, double *data, size_t size,
+                     size_t id, Adcirc::Geometry::Node *node,
+                     uint64_t *nonDefault, uint64_t mask)
+    : m_id(id),
+      m_node(node),
+      m_owner(std::move(owner)),
+      m_data(data),
+      m_size(size),
+      m_nonDefault(nonDefault),
+      m_mask(mask) {}
+
+/**
+ * @brief Copy constructor. Copies of a view refer to the same data
+ */
+Attribute::Attribute(const Attribute &a)
+    : m_id(a.m_id),
+      m_node(a.m_node),
+      m_values(a.m_values),
+      m_owner(a.m_owner),
+      m_data(a.isView() ? a.m_data : this->m_values.data()),
+      m_size(a.m_size),
+      m_nonDefault(a.m_nonDefault),
+      m_mask(a.m_mask) {}
+
+Attribute &Attribute::operator=(const Attribute &a) {
+  if (this == &a) return *this;
+  this->m_id = a.m_id;
+  this->m_node = a.m_node;
+  this->m_values = a.m_values;
+  this->m_owner = a.m_owner;
+  this->m_data = a.isView() ? a.m_data : this->m_values.data();
+  this->m_size = a.m_size;
+  this->m_nonDefault = a.m_nonDefault;
+  this->m_mask = a.m_mask;
+  return *this;
+}
+
 /**
  * @brief Resizes the object to a new number of values in this nodal attribute
+ *
+ * Views of nodal attribute arrays cannot change size
  */
-void Attribute::resize(size_t size) { this->m_values.resize(size); }
+void Attribute::resize(size_t size) {
+  if (this->isView()) {
+    if (size != this->m_size) {
+      adcircmodules_throw_exception(
+          "Attribute: Cannot resize a view of nodal attribute data");
+    }
+    return;
+  }
+  this->m_values.resize(size);
+  this->m_data = this->m_values.data();
+  this->m_size = size;
+}
+
+/**
+ * @brief Returns true if the object refers to data held by a NodalAttributes
+ * object rather than owning its values
+ */
+bool Attribute::isView() const { return this->m_nonDefault != nullptr; }
+
+/**
+ * @brief Flags the node of a view as holding non-default values. Views of
+ * neighboring nodes share a word of the bitmap and may be written from
+ * different threads, so the bit is set atomically
+ */
+void Attribute::markNonDefault() {
+  if (!this->m_nonDefault) return;
+  uint64_t &word = *(this->m_nonDefault);
+  const uint64_t mask = this->m_mask;
+#pragma omp atomic
+  word |= mask;
+}
 
 /**
  * @brief Returns the value of the nodal attribute at the specified index
@@ -56,7 +148,7 @@ double Attribute::value(size_t index) const {
   assert(index < this->size());
 
   if (index < this->size()) {
-    return m_values[index];
+    return this->m_data[index];
   } else {
     adcircmodules_throw_exception("Attribute: Index out of bounds");
     return adcircmodules_default_value<double>();
@@ -67,7 +159,9 @@ double Attribute::value(size_t index) const {
  * @brief Returns a vector of all values for this nodal parameter
  * @return values for this nodal attribute
  */
-std::vector<double> Attribute::values() const { return this->m_values; }
+std::vector<double> Attribute::values() const {
+  return std::vector<double>(this->m_data, this->m_data + this->m_size);
+}
 
 /**
  * @brief Set all values in the object to a single value
@@ -75,7 +169,8 @@ std::vector<double> Attribute::values() const { return this->m_values; }
  * present node
  */
 void Attribute::setValue(const double &value) {
-  std::fill(this->m_values.begin(), this->m_values.end(), value);
+  std::fill(this->m_data, this->m_data + this->m_size, value);
+  this->markNonDefault();
 }
 
 /**
@@ -87,7 +182,8 @@ void Attribute::setValue(size_t index, const double &value) {
   assert(index < this->size());
 
   if (index < this->size()) {
-    this->m_values[index] = value;
+    this->m_data[index] = value;
+    this->markNonDefault();
   } else {
     adcircmodules_throw_exception("Attribute: Index out of bounds");
   }
@@ -101,7 +197,8 @@ void Attribute::setValue(const std::vector<double> &values) {
   assert(values.size() == this->size());
 
   if (values.size() == this->size()) {
-    this->m_values = values;
+    std::copy(values.begin(), values.end(), this->m_data);
+    this->markNonDefault();
   } else {
     adcircmodules_throw_exception("Attribute: Index out of bounds");
   }
@@ -124,7 +221,7 @@ void Attribute::setNode(Adcirc::Geometry::Node *node) { this->m_node = node; }
  * @brief Returns the current size of this nodal attribute
  * @return size of nodal attribute
  */
-size_t Attribute::size() const { return this->m_values.size(); }
+size_t Attribute::size() const { return this->m_size; }
 
 /**
  * @brief Returns idenfitier for the current nodal attribute as specified in the
@@ -146,8 +243,8 @@ void Attribute::setId(size_t id) { this->m_id = id; }
  */
 std::string Attribute::write() {
   std::string f = boost::str(boost::format("%11i  ") % this->m_id);
-  for (auto &v : this->m_values) {
-    f = f + boost::str(boost::format("%12.6f  ") % v);
+  for (size_t i = 0; i < this->m_size; ++i) {
+    f = f + boost::str(boost::format("%12.6f  ") % this->m_data[i]);
   }
   f = f + "\n";
   return f;
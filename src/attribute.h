@@ -19,11 +19,17 @@
 #ifndef ADCMOD_ATTRIBUTE_H
 #define ADCMOD_ATTRIBUTE_H
 
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include "adcircmodules_global.h"
 #include "node.h"
 
 namespace Adcirc {
+namespace Private {
+class NodalAttributesPrivate;
+}
+
 namespace ModelParameters {
 
 /**
@@ -37,6 +43,15 @@ namespace ModelParameters {
  * size (i.e. scalars like friction or 12-parametered values such as
  * directional wind reduction.
  *
+ * Attributes returned by NodalAttributes are views into the nodal attribute
+ * arrays, so setting a value modifies the stored data. A view shares
+ * ownership of the array of its nodal attribute, so it can always be used
+ * safely, including from Python after the NodalAttributes object has been
+ * destroyed. Once the NodalAttributes object is read again or destroyed, the
+ * view refers to a detached copy of the array and changes are no longer
+ * visible to the NodalAttributes object. Attributes that are constructed
+ * directly own their values.
+ *
  */
 
 class Attribute {
@@ -45,6 +60,10 @@ class Attribute {
 
   ADCIRCMODULES_EXPORT Attribute(size_t size);
 
+  ADCIRCMODULES_EXPORT Attribute(const Attribute &a);
+
+  ADCIRCMODULES_EXPORT Attribute &operator=(const Attribute &a);
+
   void ADCIRCMODULES_EXPORT resize(size_t size);
 
   double ADCIRCMODULES_EXPORT value(size_t index) const;
@@ -62,17 +81,41 @@ class Attribute {
   size_t ADCIRCMODULES_EXPORT id() const;
   void ADCIRCMODULES_EXPORT setId(size_t id);
 
+  bool ADCIRCMODULES_EXPORT isView() const;
+
   std::string ADCIRCMODULES_EXPORT write();
 
  private:
+  friend class Adcirc::Private::NodalAttributesPrivate;
+
+  Attribute(std::shared_ptr<void> owner, double *data, size_t size, size_t id,
+            Adcirc::Geometry::Node *node, uint64_t *nonDefault, uint64_t mask);
+
+  void markNonDefault();
+
   /// ID number in the Adcirc Nodal Attributes file
   size_t m_id;
 
-  /// Value(s) for nodal parameter at this node
-  std::vector<double> m_values;
-
   /// Node that this value applies to
   Adcirc::Geometry::Node *m_node;
+
+  /// Value(s) for nodal parameter at this node when the object owns its data
+  std::vector<double> m_values;
+
+  /// Storage of the nodal attribute array that a view refers to (views only)
+  std::shared_ptr<void> m_owner;
+
+  /// Value(s) for nodal parameter at this node
+  double *m_data;
+
+  /// Number of values for the nodal parameter at this node
+  size_t m_size;
+
+  /// Word of the non-default bitmap of the nodal attribute array (views only)
+  uint64_t *m_nonDefault;
+
+  /// Bit for this node within m_nonDefault
+  uint64_t m_mask;
 };
 }  // namespace ModelParameters
 }  // namespace Adcirc
@@ -0,0 +1,87 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_BINARYIO_H
+#define ADCMOD_BINARYIO_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @brief Helpers used to serialize fixed width values to the binary cache
+ * files written by the library
+ *
+ * Values are always stored in little endian byte order without padding so
+ * that the files do not depend on the struct layout of the compiler or the
+ * byte order of the machine that wrote them
+ */
+namespace BinaryIO {
+
+inline bool isLittleEndian() {
+  const uint16_t one = 1;
+  unsigned char b;
+  std::memcpy(&b, &one, 1);
+  return b == 1;
+}
+
+/**
+ * @brief Appends a value to a byte buffer
+ * @param[inout] buffer buffer that the value is appended to
+ * @param[in] value value to append
+ */
+template <typename T>
+inline void append(std::vector<char> &buffer, T value) {
+  static_assert(std::is_arithmetic<T>::value,
+                "BinaryIO: Only arithmetic types can be serialized");
+  char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+  if (!isLittleEndian()) std::reverse(bytes, bytes + sizeof(T));
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+/**
+ * @brief Extracts a value from a byte buffer and advances the position
+ * @param[inout] pos position in the buffer, advanced past the value
+ * @param[in] end end of the buffer
+ * @param[out] value value read from the buffer
+ * @return true if the buffer contained enough bytes for the value
+ */
+template <typename T>
+inline bool extract(const char *&pos, const char *end, T &value) {
+  static_assert(std::is_arithmetic<T>::value,
+                "BinaryIO: Only arithmetic types can be serialized");
+  if (end - pos < static_cast<std::ptrdiff_t>(sizeof(T))) return false;
+  char bytes[sizeof(T)];
+  std::memcpy(bytes, pos, sizeof(T));
+  if (!isLittleEndian()) std::reverse(bytes, bytes + sizeof(T));
+  std::memcpy(&value, bytes, sizeof(T));
+  pos += sizeof(T);
+  return true;
+}
+
+}  // namespace BinaryIO
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_BINARYIO_H
@@ -0,0 +1,179 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "coordinatetransform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include "ezproj.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Adcirc::Private;
+
+/**
+ * @brief Transforms coordinates between two EPSG coordinate systems in place
+ * @param[in] epsgFrom coordinate system of the input coordinates
+ * @param[in] epsgTo coordinate system of the output coordinates
+ * @param[inout] x x-coordinates, replaced by the transformed x-coordinates
+ * @param[inout] y y-coordinates, replaced by the transformed y-coordinates
+ * @param[out] isLatLon true if the output coordinate system is geographic
+ * @return Ezproj error code. Ezproj::NoError if all blocks were transformed
+ *
+ * The coordinates are split into one contiguous block per thread. Each
+ * thread uses its own Ezproj object and transforms its block with a single
+ * call so that the projection is only set up once per thread
+ */
+int CoordinateTransform::reproject(int epsgFrom, int epsgTo,
+                                   std::vector<double> &x,
+                                   std::vector<double> &y, bool &isLatLon) {
+  assert(x.size() == y.size());
+
+  //...Empty input is passed through so that Ezproj reports the error
+  if (x.empty()) {
+    Ezproj proj;
+    std::vector<Point> in, out;
+    return proj.transform(epsgFrom, epsgTo, in, out, isLatLon);
+  }
+
+  const size_t n = x.size();
+#ifdef _OPENMP
+  const size_t nThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t nThreads = 1;
+#endif
+  const size_t blocks =
+      std::max<size_t>(1, std::min(nThreads, n / minimumBlockSize()));
+  const signed long long nBlocks = static_cast<signed long long>(blocks);
+  int error = Ezproj::NoError;
+  bool latlon = false;
+
+#pragma omp parallel for schedule(static, 1) default(none) \
+    shared(x, y, n, blocks, nBlocks, epsgFrom, epsgTo, error, latlon)
+  for (signed long long b = 0; b < nBlocks; ++b) {
+    const size_t begin = n * static_cast<size_t>(b) / blocks;
+    const size_t end = n * static_cast<size_t>(b + 1) / blocks;
+
+    std::vector<Point> in, out;
+    in.reserve(end - begin);
+    for (size_t i = begin; i < end; ++i) {
+      in.emplace_back(x[i], y[i]);
+    }
+
+    Ezproj proj;
+    bool blockLatLon = false;
+    int ierr = proj.transform(epsgFrom, epsgTo, in, out, blockLatLon);
+    if (ierr != Ezproj::NoError) {
+#pragma omp atomic write
+      error = ierr;
+      continue;
+    }
+
+    if (b == 0) latlon = blockLatLon;
+    for (size_t i = begin; i < end; ++i) {
+      x[i] = out[i - begin].first;
+      y[i] = out[i - begin].second;
+    }
+  }
+
+  isLatLon = latlon;
+  return error;
+}
+
+/**
+ * @brief Computes the coefficients of the CPP projection from Ezproj. The
+ * projection scales each coordinate independently, so it is fully described
+ * by the image of the central meridian at the equator and the scale in each
+ * direction
+ * @param[in] lambda central meridian
+ * @param[in] phi standard parallel
+ * @param[out] x0 projected x-coordinate of the central meridian
+ * @param[out] y0 projected y-coordinate of the equator
+ * @param[out] sx scale applied to longitude offsets from the central meridian
+ * @param[out] sy scale applied to latitude
+ */
+void CoordinateTransform::cppCoefficients(double lambda, double phi,
+                                          double &x0, double &y0, double &sx,
+                                          double &sy) {
+  Point origin, unit;
+  Ezproj::cpp(lambda, phi, Point(lambda, 0.0), origin);
+  Ezproj::cpp(lambda, phi, Point(lambda + 1.0, 1.0), unit);
+  x0 = origin.first;
+  y0 = origin.second;
+  sx = (unit.first - origin.first) / ((lambda + 1.0) - lambda);
+  sy = unit.second - origin.second;
+}
+
+/**
+ * @brief Converts coordinates to the carte parallelogrammatique projection in
+ * place
+ * @param[in] lambda central meridian
+ * @param[in] phi standard parallel
+ * @param[inout] x longitudes, replaced by the projected x-coordinates
+ * @param[inout] y latitudes, replaced by the projected y-coordinates
+ */
+void CoordinateTransform::cpp(double lambda, double phi,
+                              std::vector<double> &x, std::vector<double> &y) {
+  assert(x.size() == y.size());
+  double x0, y0, sx, sy;
+  CoordinateTransform::cppCoefficients(lambda, phi, x0, y0, sx, sy);
+
+  double *px = x.data();
+  double *py = y.data();
+  const signed long long n = static_cast<signed long long>(x.size());
+
+#pragma omp parallel for simd schedule(static) default(none) \
+    shared(px, py, n, lambda, x0, y0, sx, sy)
+  for (signed long long i = 0; i < n; ++i) {
+    px[i] = x0 + sx * (px[i] - lambda);
+    py[i] = y0 + sy * py[i];
+  }
+}
+
+/**
+ * @brief Converts coordinates from the carte parallelogrammatique projection
+ * back to geographic coordinates in place
+ * @param[in] lambda central meridian
+ * @param[in] phi standard parallel
+ * @param[inout] x projected x-coordinates, replaced by the longitudes
+ * @param[inout] y projected y-coordinates, replaced by the latitudes
+ */
+void CoordinateTransform::inverseCpp(double lambda, double phi,
+                                     std::vector<double> &x,
+                                     std::vector<double> &y) {
+  assert(x.size() == y.size());
+  double x0, y0, sx, sy;
+  CoordinateTransform::cppCoefficients(lambda, phi, x0, y0, sx, sy);
+  const double rx = 1.0 / sx;
+  const double ry = 1.0 / sy;
+
+  double *px = x.data();
+  double *py = y.data();
+  const signed long long n = static_cast<signed long long>(x.size());
+
+#pragma omp parallel for simd schedule(static) default(none) \
+    shared(px, py, n, lambda, x0, y0, rx, ry)
+  for (signed long long i = 0; i < n; ++i) {
+    px[i] = lambda + (px[i] - x0) * rx;
+    py[i] = (py[i] - y0) * ry;
+  }
+}
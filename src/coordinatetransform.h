@@ -0,0 +1,66 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_COORDINATETRANSFORM_H
+#define ADCMOD_COORDINATETRANSFORM_H
+
+#include <cstddef>
+#include <vector>
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class CoordinateTransform
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Static functions that transform coordinates held in contiguous x and
+ * y arrays in place
+ *
+ * Coordinate system transformations are divided into one block per thread,
+ * with each thread holding its own Ezproj object so that no projection state
+ * is shared between threads. The carte
+ * parallelogrammatique (CPP) projection used internally by ADCIRC is applied
+ * with a vectorized loop.
+ */
+class CoordinateTransform {
+ public:
+  CoordinateTransform() = default;
+
+  /// Minimum number of points transformed by each thread
+  static constexpr size_t minimumBlockSize() { return 16384; }
+
+  static int reproject(int epsgFrom, int epsgTo, std::vector<double> &x,
+                       std::vector<double> &y, bool &isLatLon);
+
+  static void cpp(double lambda, double phi, std::vector<double> &x,
+                  std::vector<double> &y);
+
+  static void inverseCpp(double lambda, double phi, std::vector<double> &x,
+                         std::vector<double> &y);
+
+ private:
+  static void cppCoefficients(double lambda, double phi, double &x0,
+                              double &y0, double &sx, double &sy);
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_COORDINATETRANSFORM_H
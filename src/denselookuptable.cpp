@@ -0,0 +1,152 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "denselookuptable.h"
+
+#include <algorithm>
+
+#include "logging.h"
+
+using namespace Adcirc::Private;
+
+DenseLookupTable::DenseLookupTable() : m_min(0), m_max(-1), m_size(0) {}
+
+void DenseLookupTable::clear() {
+  this->m_min = 0;
+  this->m_max = -1;
+  this->m_size = 0;
+  this->m_values.clear();
+  this->m_bitmap.clear();
+}
+
+bool DenseLookupTable::empty() const { return this->m_size == 0; }
+
+size_t DenseLookupTable::size() const { return this->m_size; }
+
+int DenseLookupTable::minimumKey() const { return this->m_min; }
+
+int DenseLookupTable::maximumKey() const { return this->m_max; }
+
+void DenseLookupTable::expand(int key) {
+  if (this->m_max < this->m_min) {
+    this->m_min = key;
+    this->m_max = key;
+    this->m_values.assign(1, 0.0);
+    this->m_bitmap.assign(1, 0);
+    return;
+  }
+
+  const int newMin = std::min(this->m_min, key);
+  const int newMax = std::max(this->m_max, key);
+  if (newMin == this->m_min && newMax == this->m_max) return;
+
+  const size_t n = static_cast<size_t>(newMax - newMin + 1);
+  std::vector<double> values(n, 0.0);
+  std::vector<uint64_t> bitmap((n + 63) / 64, 0);
+  for (int k = this->m_min; k <= this->m_max; ++k) {
+    const size_t oi = static_cast<size_t>(k - this->m_min);
+    if ((this->m_bitmap[oi >> 6] >> (oi & 63)) & 1) {
+      const size_t ni = static_cast<size_t>(k - newMin);
+      values[ni] = this->m_values[oi];
+      bitmap[ni >> 6] |= uint64_t(1) << (ni & 63);
+    }
+  }
+  this->m_values.swap(values);
+  this->m_bitmap.swap(bitmap);
+  this->m_min = newMin;
+  this->m_max = newMax;
+}
+
+void DenseLookupTable::set(int key, double value) {
+  if (key < 0 || key > DenseLookupTable::maxKey()) {
+    adcircmodules_throw_exception("DenseLookupTable: Key out of range");
+  }
+  this->expand(key);
+  const size_t i = static_cast<size_t>(key - this->m_min);
+  if (!((this->m_bitmap[i >> 6] >> (i & 63)) & 1)) {
+    this->m_bitmap[i >> 6] |= uint64_t(1) << (i & 63);
+    this->m_size++;
+  }
+  this->m_values[i] = value;
+}
+
+bool DenseLookupTable::contains(int key) const {
+  if (key < this->m_min || key > this->m_max) return false;
+  const size_t i = static_cast<size_t>(key - this->m_min);
+  return (this->m_bitmap[i >> 6] >> (i & 63)) & 1;
+}
+
+bool DenseLookupTable::value(int key, double &value) const {
+  if (!this->contains(key)) return false;
+  value = this->m_values[static_cast<size_t>(key - this->m_min)];
+  return true;
+}
+
+/**
+ * @brief Converts a window of raster classes to values
+ * @param[in] keys raster classes
+ * @param[in] keyValid true where the raster class is not nodata
+ * @param[out] values looked up values
+ * @param[out] valid true where the class was found in the table
+ *
+ * The loop does not branch on the table contents. Keys outside the bounds
+ * of the table are clamped to the first entry and then masked as invalid.
+ */
+void DenseLookupTable::classify(const std::vector<double> &keys,
+                                const std::vector<uint8_t> &keyValid,
+                                std::vector<double> &values,
+                                std::vector<uint8_t> &valid) const {
+  const size_t n = keys.size();
+  values.resize(n);
+  valid.resize(n);
+
+  if (this->empty()) {
+    std::fill(valid.begin(), valid.end(), false);
+    return;
+  }
+
+  //...Classes are read as unsigned 16 bit values, so the offsets and the
+  //   span of the table always fit in 32 bits
+  const uint32_t span = static_cast<uint32_t>(this->m_max - this->m_min);
+  const int32_t minimum = this->m_min;
+  const double *key = keys.data();
+  const uint8_t *keyOk = keyValid.data();
+  const double *table = this->m_values.data();
+  const uint64_t *bitmap = this->m_bitmap.data();
+  double *out = values.data();
+  uint8_t *ok = valid.data();
+
+  //...Keys are only converted to an integer once they are known to be in the
+  //   range of a class, since nodata pixels of a floating point raster hold
+  //   values such as -DBL_MAX that do not fit in 32 bits
+  const double maximumKey = static_cast<double>(maxKey());
+
+#pragma omp simd
+  for (size_t k = 0; k < n; ++k) {
+    const uint32_t keyInRange =
+        keyOk[k] & (key[k] >= 0.0) & (key[k] <= maximumKey);
+    const int32_t cls = static_cast<int32_t>(keyInRange ? key[k] : 0.0);
+    const uint32_t offset = static_cast<uint32_t>(cls - minimum);
+    const uint32_t inRange = offset <= span;
+    const uint32_t i = offset * inRange;
+    const uint32_t found =
+        static_cast<uint32_t>(bitmap[i >> 6] >> (i & 63)) & 1;
+    out[k] = table[i];
+    ok[k] = static_cast<uint8_t>(keyInRange & inRange & found);
+  }
+}
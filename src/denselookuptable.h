@@ -0,0 +1,78 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_DENSELOOKUPTABLE_H
+#define ADCMOD_DENSELOOKUPTABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "adcircmodules_global.h"
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class DenseLookupTable
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Lookup table that maps integer raster classes to values using a
+ * contiguous array bounded by the minimum and maximum class
+ *
+ * Classes that are not defined in the table are tracked using a validity
+ * bitmap so that an entire window of pixels can be classified without
+ * branching on a hash table probe for each pixel
+ */
+class DenseLookupTable {
+ public:
+  ADCIRCMODULES_EXPORT DenseLookupTable();
+
+  /// Largest class that can be stored in the table
+  static constexpr int maxKey() { return 65535; }
+
+  void ADCIRCMODULES_EXPORT clear();
+  bool ADCIRCMODULES_EXPORT empty() const;
+  size_t ADCIRCMODULES_EXPORT size() const;
+
+  int ADCIRCMODULES_EXPORT minimumKey() const;
+  int ADCIRCMODULES_EXPORT maximumKey() const;
+
+  void ADCIRCMODULES_EXPORT set(int key, double value);
+  bool ADCIRCMODULES_EXPORT contains(int key) const;
+  bool ADCIRCMODULES_EXPORT value(int key, double &value) const;
+
+  void ADCIRCMODULES_EXPORT classify(const std::vector<double> &keys,
+                                     const std::vector<uint8_t> &keyValid,
+                                     std::vector<double> &values,
+                                     std::vector<uint8_t> &valid) const;
+
+ private:
+  void expand(int key);
+
+  int m_min;
+  int m_max;
+  size_t m_size;
+  std::vector<double> m_values;
+  std::vector<uint64_t> m_bitmap;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_DENSELOOKUPTABLE_H
@@ -17,9 +17,11 @@
 // along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
 //------------------------------------------------------------------------*/
 #include "fileio.h"
+#include <algorithm>
 #include <complex>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <string>
 #include "boost/algorithm/string/replace.hpp"
 #include "boost/algorithm/string/split.hpp"
@@ -28,10 +30,12 @@
 #include "boost/spirit/include/phoenix.hpp"
 #include "boost/spirit/include/qi.hpp"
 #include "logging.h"
+#include "textio.h"
 
 namespace qi = boost::spirit::qi;
 namespace ascii = boost::spirit::ascii;
 namespace phoenix = boost::phoenix;
+namespace TextIO = Adcirc::Private::TextIO;
 
 /**
  * @brief Reads the data from a file and organizes it into a vector split by
@@ -390,3 +394,167 @@ bool Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(const std::string &data,
 
   return r;
 }
+
+/**
+ * @brief Parses an hmdf data line held in a character range without copying
+ * it into a string
+ * @param[in] begin start of the line
+ * @param[in] end one past the end of the line
+ * @return true if the line was parsed as data
+ *
+ * The integer fields are decoded directly and the value uses qi::double_ so
+ * that the results are identical to the string version and independent of
+ * the current locale
+ */
+bool Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(const char *begin,
+                                                   const char *end, int &year,
+                                                   int &month, int &day,
+                                                   int &hour, int &minute,
+                                                   int &second,
+                                                   double &value) {
+  const char *p = begin;
+  if (!TextIO::parseInteger(p, end, year)) return false;
+  if (!TextIO::parseInteger(p, end, month)) return false;
+  if (!TextIO::parseInteger(p, end, day)) return false;
+  if (!TextIO::parseInteger(p, end, hour)) return false;
+  if (!TextIO::parseInteger(p, end, minute)) return false;
+
+  const char *mark = p;
+  if (TextIO::parseInteger(p, end, second)) {
+    p = TextIO::skipSpace(p, end);
+    if (qi::parse(p, end, qi::double_, value)) return true;
+  }
+
+  p = TextIO::skipSpace(mark, end);
+  second = 0;
+  return qi::parse(p, end, qi::double_, value);
+}
+
+/**
+ * @brief Parses a nodal attribute line held in a character range without
+ * copying it into a string
+ * @param[in] begin start of the line
+ * @param[in] end one past the end of the line
+ * @param[out] node node id for data
+ * @param[out] values array that receives n values
+ * @param[in] n number of values expected on the line
+ * @return true if the node id and exactly n values were read
+ */
+bool Adcirc::FileIO::AdcircIO::splitStringAttributeNFormat(const char *begin,
+                                                           const char *end,
+                                                           size_t &node,
+                                                           double *values,
+                                                           size_t n) {
+  const char *p = begin;
+  int id;
+  if (!TextIO::parseInteger(p, end, id)) return false;
+  node = static_cast<size_t>(id);
+  for (size_t i = 0; i < n; ++i) {
+    p = TextIO::skipSpace(p, end);
+    if (!qi::parse(p, end, qi::double_, values[i])) return false;
+  }
+  return TextIO::skipSpace(p, end) == end;
+}
+
+/**
+ * @brief Skips leading whitespace and the card name of a 2dm line
+ */
+static inline const char *skip2dmCard(const char *p, const char *end) {
+  p = TextIO::skipSpace(p, end);
+  while (p != end && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') {
+    ++p;
+  }
+  return p;
+}
+
+/**
+ * @brief Splits an SMS format 2dm node card held in a character range
+ * without copying it into a string
+ * @param[in] begin start of the line, including the ND card
+ * @param[in] end one past the end of the line
+ * @param[out] id node id read
+ * @param[out] x x-coordinate
+ * @param[out] y y-coordinate
+ * @param[out] z z-elevation
+ * @return true if successful read
+ */
+bool Adcirc::FileIO::SMSIO::splitString2dmNodeFormat(const char *begin,
+                                                     const char *end,
+                                                     size_t &id, double &x,
+                                                     double &y, double &z) {
+  const char *p = skip2dmCard(begin, end);
+  int n;
+  if (!TextIO::parseInteger(p, end, n) || n < 0) return false;
+  id = static_cast<size_t>(n);
+  p = TextIO::skipSpace(p, end);
+  if (!qi::parse(p, end, qi::double_, x)) return false;
+  p = TextIO::skipSpace(p, end);
+  if (!qi::parse(p, end, qi::double_, y)) return false;
+  p = TextIO::skipSpace(p, end);
+  return qi::parse(p, end, qi::double_, z);
+}
+
+/**
+ * @brief Splits an SMS format 2dm element card held in a character range
+ * without copying it into a string
+ * @param[in] begin start of the line, including the E3T or E4Q card
+ * @param[in] end one past the end of the line
+ * @param[out] id element id read
+ * @param[out] nodes array that receives up to 4 node ids
+ * @param[out] numNodes number of nodes in the element
+ * @return true if successful read
+ */
+bool Adcirc::FileIO::SMSIO::splitString2dmElementFormat(const char *begin,
+                                                        const char *end,
+                                                        size_t &id,
+                                                        size_t *nodes,
+                                                        size_t &numNodes) {
+  const char *p = TextIO::skipSpace(begin, end);
+  if (end - p < 3) return false;
+  if (std::equal(p, p + 3, "E3T")) {
+    numNodes = 3;
+  } else if (std::equal(p, p + 3, "E4Q")) {
+    numNodes = 4;
+  } else {
+    return false;
+  }
+  p += 3;
+
+  int n;
+  if (!TextIO::parseInteger(p, end, n) || n < 0) return false;
+  id = static_cast<size_t>(n);
+  for (size_t i = 0; i < numNodes; ++i) {
+    if (!TextIO::parseInteger(p, end, n) || n <= 0) return false;
+    nodes[i] = static_cast<size_t>(n);
+  }
+  return true;
+}
+
+/**
+ * @brief Splits an SMS format 2dm nodestring card held in a character range.
+ * A nodestring may continue over several cards and ends with a negative node
+ * id, which may be followed by the name of the nodestring
+ * @param[in] begin start of the line, including the NS card
+ * @param[in] end one past the end of the line
+ * @param[out] nodes node ids on the card are appended to this vector. The
+ * final node id is stored as a positive value
+ * @param[out] last true if the nodestring ends on this card
+ * @return true if at least one node id was read
+ */
+bool Adcirc::FileIO::SMSIO::splitString2dmNodestringFormat(
+    const char *begin, const char *end, std::vector<size_t> &nodes,
+    bool &last) {
+  const char *p = skip2dmCard(begin, end);
+  const size_t first = nodes.size();
+  int n;
+  last = false;
+  while (TextIO::parseInteger(p, end, n)) {
+    if (n == 0) return false;
+    nodes.push_back(static_cast<size_t>(n < 0 ? -n : n));
+    if (n < 0) {
+      last = true;
+      break;
+    }
+  }
+  return nodes.size() > first;
+}
@@ -82,6 +82,11 @@ bool ADCIRCMODULES_EXPORT splitStringAttribute2Format(const std::string &data,
 bool ADCIRCMODULES_EXPORT splitStringAttributeNFormat(
     const std::string &data, size_t &node, std::vector<double> &values);
 
+bool ADCIRCMODULES_EXPORT splitStringAttributeNFormat(const char *begin,
+                                                      const char *end,
+                                                      size_t &node,
+                                                      double *values, size_t n);
+
 bool ADCIRCMODULES_EXPORT splitStringHarmonicsElevationFormat(
     const std::string &data, double &amplitude, double &phase);
 
@@ -97,6 +102,20 @@ bool ADCIRCMODULES_EXPORT splitString2dmNodeFormat(const std::string &data,
 
 bool ADCIRCMODULES_EXPORT splitString2dmElementFormat(
     const std::string &data, size_t &id, std::vector<size_t> &nodes);
+
+bool ADCIRCMODULES_EXPORT splitString2dmNodeFormat(const char *begin,
+                                                   const char *end, size_t &id,
+                                                   double &x, double &y,
+                                                   double &z);
+
+bool ADCIRCMODULES_EXPORT splitString2dmElementFormat(const char *begin,
+                                                      const char *end,
+                                                      size_t &id, size_t *nodes,
+                                                      size_t &numNodes);
+
+bool ADCIRCMODULES_EXPORT splitString2dmNodestringFormat(
+    const char *begin, const char *end, std::vector<size_t> &nodes,
+    bool &last);
 }  // namespace SMSIO
 
 namespace HMDFIO {
@@ -104,6 +123,11 @@ bool ADCIRCMODULES_EXPORT splitStringHmdfFormat(const std::string &data,
                                                 int &year, int &month, int &day,
                                                 int &hour, int &minute,
                                                 int &second, double &value);
+bool ADCIRCMODULES_EXPORT splitStringHmdfFormat(const char *begin,
+                                                const char *end, int &year,
+                                                int &month, int &day,
+                                                int &hour, int &minute,
+                                                int &second, double &value);
 }
 
 }  // namespace FileIO
@@ -0,0 +1,535 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "flatgeobufwriter.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "fileio.h"
+#include "logging.h"
+#include "spacefillingcurve.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Adcirc::Private;
+
+namespace {
+
+//...File signature for version 3 of the FlatGeobuf format
+constexpr std::array<char, 8> c_magic = {'f', 'g', 'b', 3, 'f', 'g', 'b', 0};
+
+//...Number of features encoded in memory at a time before being written
+constexpr size_t c_chunkSize = 65536;
+
+//...Size of a serialized R-tree node, four doubles and a 64-bit offset
+constexpr size_t c_nodeItemSize = 40;
+
+struct Box {
+  double xmin;
+  double ymin;
+  double xmax;
+  double ymax;
+
+  void expand(const Box &b) {
+    xmin = std::min(xmin, b.xmin);
+    ymin = std::min(ymin, b.ymin);
+    xmax = std::max(xmax, b.xmax);
+    ymax = std::max(ymax, b.ymax);
+  }
+};
+
+constexpr Box c_emptyBox = {std::numeric_limits<double>::max(),
+                            std::numeric_limits<double>::max(),
+                            std::numeric_limits<double>::lowest(),
+                            std::numeric_limits<double>::lowest()};
+
+struct NodeItem {
+  Box box;
+  uint64_t offset;
+};
+
+template <typename T>
+void append(std::vector<uint8_t> &data, T value) {
+  const size_t p = data.size();
+  data.resize(p + sizeof(T));
+  std::memcpy(&data[p], &value, sizeof(T));
+}
+
+/**
+ * @brief Minimal flatbuffers encoder for size prefixed buffers
+ *
+ * Objects are laid out front to back so that every offset points forward.
+ * Alignment is relative to the start of the size prefix, as it is for the
+ * buffers produced by the reference flatbuffers builder.
+ */
+class FlatBuffer {
+ public:
+  struct Field {
+    uint16_t id;
+    uint8_t size;
+  };
+
+  explicit FlatBuffer(std::vector<uint8_t> &data)
+      : m_data(data), m_base(data.size()) {
+    //...Space for the size prefix and the offset to the root table
+    this->m_data.resize(this->m_base + 8, 0);
+  }
+
+  size_t position() const { return this->m_data.size() - this->m_base; }
+
+  template <typename T>
+  void set(size_t position, T value) {
+    std::memcpy(&this->m_data[this->m_base + position], &value, sizeof(T));
+  }
+
+  void link(size_t slot, size_t target) {
+    this->set<uint32_t>(slot, static_cast<uint32_t>(target - slot));
+  }
+
+  size_t string(const std::string &s) {
+    this->align(4);
+    const size_t p = this->position();
+    append<uint32_t>(this->m_data, static_cast<uint32_t>(s.size()));
+    this->m_data.insert(this->m_data.end(), s.begin(), s.end());
+    this->m_data.push_back(0);
+    return p;
+  }
+
+  //...Vector of scalars, optionally followed by a repeat of its first
+  //   repeat values, which is used to close polygon rings
+  template <typename T>
+  size_t vector(const T *values, size_t n, size_t repeat = 0) {
+    this->align(std::max<size_t>(sizeof(T), 4), 4);
+    const size_t p = this->position();
+    append<uint32_t>(this->m_data, static_cast<uint32_t>(n + repeat));
+    const size_t q = this->m_data.size();
+    this->m_data.resize(q + (n + repeat) * sizeof(T));
+    if (n > 0) std::memcpy(&this->m_data[q], values, n * sizeof(T));
+    if (repeat > 0) {
+      std::memcpy(&this->m_data[q + n * sizeof(T)], values, repeat * sizeof(T));
+    }
+    return p;
+  }
+
+  //...Vector of offsets to tables. The slot for entry i is at p + 4 * (i + 1)
+  size_t offsetVector(size_t n) {
+    this->align(4);
+    const size_t p = this->position();
+    append<uint32_t>(this->m_data, static_cast<uint32_t>(n));
+    this->m_data.resize(this->m_data.size() + 4 * n, 0);
+    return p;
+  }
+
+  //...Writes a vtable followed by its table. Fields are laid out in the order
+  //   given and the position of each field is returned by its id
+  size_t table(std::initializer_list<Field> fields,
+               std::array<size_t, 16> &fieldPosition) {
+    std::array<uint16_t, 16> offset{};
+    size_t count = 0;
+    size_t inlineSize = 4;
+    for (const auto &f : fields) {
+      count = std::max<size_t>(count, f.id + 1);
+      inlineSize = (inlineSize + f.size - 1) / f.size * f.size;
+      offset[f.id] = static_cast<uint16_t>(inlineSize);
+      inlineSize += f.size;
+    }
+
+    this->align(2);
+    const size_t vtable = this->position();
+    append<uint16_t>(this->m_data, static_cast<uint16_t>(4 + 2 * count));
+    append<uint16_t>(this->m_data, static_cast<uint16_t>(inlineSize));
+    for (size_t i = 0; i < count; ++i) {
+      append<uint16_t>(this->m_data, offset[i]);
+    }
+
+    this->align(8);
+    const size_t t = this->position();
+    this->m_data.resize(this->m_data.size() + inlineSize, 0);
+    this->set<int32_t>(t, static_cast<int32_t>(t - vtable));
+    for (const auto &f : fields) fieldPosition[f.id] = t + offset[f.id];
+    return t;
+  }
+
+  void finish(size_t root) {
+    this->link(4, root);
+    this->set<uint32_t>(0, static_cast<uint32_t>(this->position() - 4));
+  }
+
+ private:
+  void align(size_t alignment, size_t extra = 0) {
+    while ((this->position() + extra) % alignment != 0) {
+      this->m_data.push_back(0);
+    }
+  }
+
+  std::vector<uint8_t> &m_data;
+  const size_t m_base;
+};
+
+void encodeFeature(const FlatGeobufFeature &f,
+                   FlatGeobufWriter::GeometryType type,
+                   std::vector<uint8_t> &data) {
+  FlatBuffer fb(data);
+  std::array<size_t, 16> featureField, geometryField;
+  const bool hasProperties = !f.properties().empty();
+
+  const size_t feature =
+      hasProperties ? fb.table({{0, 4}, {1, 4}}, featureField)
+                    : fb.table({{0, 4}}, featureField);
+  const size_t geometry = fb.table({{1, 4}}, geometryField);
+  fb.link(featureField[0], geometry);
+
+  //...Polygon rings are closed if the caller did not repeat the first point
+  const std::vector<double> &xy = f.xy();
+  const size_t n = xy.size();
+  const bool close = type == FlatGeobufWriter::Polygon && n >= 2 &&
+                     (xy[0] != xy[n - 2] || xy[1] != xy[n - 1]);
+  fb.link(geometryField[1], fb.vector(xy.data(), n, close ? 2 : 0));
+
+  if (hasProperties) {
+    fb.link(featureField[1],
+            fb.vector(f.properties().data(), f.properties().size()));
+  }
+  fb.finish(feature);
+}
+
+void encodeHeader(const std::string &name, FlatGeobufWriter::GeometryType type,
+                  const std::vector<std::pair<std::string, uint8_t>> &columns,
+                  uint64_t numFeatures, const Box &envelope, int epsg,
+                  std::vector<uint8_t> &data) {
+  FlatBuffer fb(data);
+  std::array<size_t, 16> headerField, field;
+
+  const size_t header =
+      epsg > 0
+          ? fb.table({{8, 8}, {0, 4}, {1, 4}, {7, 4}, {10, 4}, {9, 2}, {2, 1}},
+                     headerField)
+          : fb.table({{8, 8}, {0, 4}, {1, 4}, {7, 4}, {9, 2}, {2, 1}},
+                     headerField);
+
+  fb.set<uint64_t>(headerField[8], numFeatures);
+  fb.set<uint16_t>(headerField[9],
+                   numFeatures > 0 ? FlatGeobufWriter::nodeSize() : 0);
+  fb.set<uint8_t>(headerField[2], type);
+
+  fb.link(headerField[0], fb.string(name));
+
+  const std::array<double, 4> env = {envelope.xmin, envelope.ymin,
+                                     envelope.xmax, envelope.ymax};
+  fb.link(headerField[1], fb.vector(env.data(), numFeatures > 0 ? 4 : 0));
+
+  const size_t columnVector = fb.offsetVector(columns.size());
+  fb.link(headerField[7], columnVector);
+  for (size_t i = 0; i < columns.size(); ++i) {
+    const size_t column = fb.table({{0, 4}, {1, 1}}, field);
+    fb.set<uint8_t>(field[1], columns[i].second);
+    fb.link(columnVector + 4 * (i + 1), column);
+    fb.link(field[0], fb.string(columns[i].first));
+  }
+
+  if (epsg > 0) {
+    const size_t crs = fb.table({{0, 4}, {1, 4}}, field);
+    fb.set<int32_t>(field[1], epsg);
+    fb.link(headerField[10], crs);
+    fb.link(field[0], fb.string("EPSG"));
+  }
+
+  fb.finish(header);
+}
+
+Box featureBox(const FlatGeobufFeature &f) {
+  Box b = c_emptyBox;
+  const std::vector<double> &xy = f.xy();
+  for (size_t i = 0; i + 1 < xy.size(); i += 2) {
+    b.expand({xy[i], xy[i + 1], xy[i], xy[i + 1]});
+  }
+  return b;
+}
+
+/**
+ * @brief Computes the range of node positions occupied by each level of the
+ * packed R-tree. The first entry is the leaf level, which is stored last
+ */
+std::vector<std::pair<size_t, size_t>> levelBounds(size_t numItems,
+                                                   size_t nodeSize) {
+  std::vector<size_t> levelNumNodes(1, numItems);
+  size_t numNodes = numItems;
+  size_t n = numItems;
+  do {
+    n = (n + nodeSize - 1) / nodeSize;
+    numNodes += n;
+    levelNumNodes.push_back(n);
+  } while (n != 1);
+
+  std::vector<std::pair<size_t, size_t>> bounds;
+  for (const auto &size : levelNumNodes) {
+    numNodes -= size;
+    bounds.emplace_back(numNodes, numNodes + size);
+  }
+  return bounds;
+}
+
+void writeNodeItem(std::vector<uint8_t> &data, const Box &box,
+                   uint64_t offset) {
+  append<double>(data, box.xmin);
+  append<double>(data, box.ymin);
+  append<double>(data, box.xmax);
+  append<double>(data, box.ymax);
+  append<uint64_t>(data, offset);
+}
+
+}  // namespace
+
+/**
+ * @brief Removes the geometry and attribute values so that the object can be
+ * reused for the next feature
+ */
+void FlatGeobufFeature::clear() {
+  this->m_xy.clear();
+  this->m_properties.clear();
+}
+
+/**
+ * @brief Appends a vertex to the feature geometry
+ * @param[in] x x-coordinate
+ * @param[in] y y-coordinate
+ */
+void FlatGeobufFeature::addPoint(double x, double y) {
+  this->m_xy.push_back(x);
+  this->m_xy.push_back(y);
+}
+
+/**
+ * @brief Sets the value of an integer column. Columns that are not set are
+ * written as null
+ * @param[in] column column index returned by FlatGeobufWriter::addColumn
+ * @param[in] value column value
+ */
+void FlatGeobufFeature::setInteger(uint16_t column, int32_t value) {
+  append<uint16_t>(this->m_properties, column);
+  append<int32_t>(this->m_properties, value);
+}
+
+/**
+ * @brief Sets the value of a double precision column. Columns that are not
+ * set are written as null
+ * @param[in] column column index returned by FlatGeobufWriter::addColumn
+ * @param[in] value column value
+ */
+void FlatGeobufFeature::setDouble(uint16_t column, double value) {
+  append<uint16_t>(this->m_properties, column);
+  append<double>(this->m_properties, value);
+}
+
+const std::vector<double> &FlatGeobufFeature::xy() const {
+  return this->m_xy;
+}
+
+const std::vector<uint8_t> &FlatGeobufFeature::properties() const {
+  return this->m_properties;
+}
+
+/**
+ * @brief Constructor
+ * @param[in] filename name of the .fgb file to create
+ * @param[in] geometryType type of geometry of every feature in the file
+ * @param[in] epsg coordinate system of the features. Values less than or
+ * equal to zero are treated as unknown
+ */
+FlatGeobufWriter::FlatGeobufWriter(const std::string &filename,
+                                   GeometryType geometryType, int epsg)
+    : m_filename(filename), m_geometryType(geometryType), m_epsg(epsg) {}
+
+/**
+ * @brief Adds an attribute column to the file
+ * @param[in] name column name
+ * @param[in] type column data type
+ * @return index of the column used to set values on each feature
+ */
+uint16_t FlatGeobufWriter::addColumn(const std::string &name,
+                                     ColumnType type) {
+  this->m_columns.push_back({name, type});
+  return static_cast<uint16_t>(this->m_columns.size() - 1);
+}
+
+/**
+ * @brief Generates the features and writes the file
+ *
+ * The callback is called twice for each feature, once to compute its
+ * bounding box and encoded size and once to encode it into the output, and
+ * must produce the same feature both times.
+ *
+ * @param[in] numFeatures number of features to write
+ * @param[in] feature callback filling in the feature with the given index
+ */
+void FlatGeobufWriter::write(size_t numFeatures,
+                             const FeatureFunction &feature) {
+  std::ofstream out(this->m_filename, std::ios::binary);
+  if (!out.is_open()) {
+    adcircmodules_throw_exception("FlatGeobufWriter: Could not open " +
+                                  this->m_filename);
+  }
+
+  const GeometryType type = this->m_geometryType;
+  std::vector<Box> box(numFeatures);
+  std::vector<uint32_t> size(numFeatures);
+  std::exception_ptr error = nullptr;
+
+#pragma omp parallel default(none) \
+    shared(box, size, error, feature, numFeatures, type)
+  {
+    FlatGeobufFeature f;
+    std::vector<uint8_t> buffer;
+#pragma omp for schedule(static)
+    for (signed long long i = 0; i < static_cast<signed long long>(numFeatures);
+         ++i) {
+      try {
+        f.clear();
+        feature(i, f);
+        if (f.xy().empty()) {
+          adcircmodules_throw_exception(
+              "FlatGeobufWriter: Feature has no geometry");
+        }
+        box[i] = featureBox(f);
+        buffer.clear();
+        encodeFeature(f, type, buffer);
+        size[i] = static_cast<uint32_t>(buffer.size());
+      } catch (...) {
+#pragma omp critical(flatgeobuf_error)
+        if (!error) error = std::current_exception();
+      }
+    }
+  }
+  if (error) std::rethrow_exception(error);
+
+  Box extent = c_emptyBox;
+  for (const auto &b : box) extent.expand(b);
+
+  //...Order the features along a Hilbert curve through the extent
+  std::vector<std::pair<uint64_t, size_t>> key(numFeatures);
+#pragma omp parallel for schedule(static) default(none) \
+    shared(box, key, extent, numFeatures)
+  for (signed long long i = 0; i < static_cast<signed long long>(numFeatures);
+       ++i) {
+    const Box &b = box[i];
+    key[i] = {SpaceFillingCurve::hilbert(
+                  0.5 * (b.xmin + b.xmax), 0.5 * (b.ymin + b.ymax),
+                  extent.xmin, extent.ymin, extent.xmax, extent.ymax),
+              static_cast<size_t>(i)};
+  }
+  std::sort(key.begin(), key.end());
+
+  std::vector<size_t> order(numFeatures);
+  std::vector<uint64_t> offset(numFeatures + 1, 0);
+  for (size_t j = 0; j < numFeatures; ++j) {
+    order[j] = key[j].second;
+    offset[j + 1] = offset[j] + size[order[j]];
+  }
+  std::vector<std::pair<uint64_t, size_t>>().swap(key);
+
+  std::vector<uint8_t> buffer(c_magic.begin(), c_magic.end());
+  std::vector<std::pair<std::string, uint8_t>> columns;
+  for (const auto &c : this->m_columns) columns.emplace_back(c.name, c.type);
+  std::string name =
+      Adcirc::FileIO::Generic::getFileWithoutExtension(this->m_filename);
+  name = name.substr(name.find_last_of("/\\") + 1);
+  encodeHeader(name, type, columns, numFeatures, extent, this->m_epsg, buffer);
+  out.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+
+  //...Packed R-tree. The interior nodes are built from the leaves, which are
+  //   the feature bounding boxes in Hilbert order, and are stored first
+  if (numFeatures > 0) {
+    const auto bounds = levelBounds(numFeatures, nodeSize());
+    const size_t leafStart = bounds.front().first;
+    std::vector<NodeItem> node(leafStart);
+    auto item = [&](size_t pos) {
+      return pos >= leafStart ? box[order[pos - leafStart]] : node[pos].box;
+    };
+    for (size_t level = 0; level + 1 < bounds.size(); ++level) {
+      size_t pos = bounds[level].first;
+      size_t parent = bounds[level + 1].first;
+      while (pos < bounds[level].second) {
+        NodeItem n = {c_emptyBox, pos};
+        for (size_t j = 0; j < nodeSize() && pos < bounds[level].second;
+             ++j, ++pos) {
+          n.box.expand(item(pos));
+        }
+        node[parent++] = n;
+      }
+    }
+
+    buffer.clear();
+    for (const auto &n : node) writeNodeItem(buffer, n.box, n.offset);
+    for (size_t j = 0; j < numFeatures; ++j) {
+      writeNodeItem(buffer, box[order[j]], offset[j]);
+      if (buffer.size() >= c_chunkSize * c_nodeItemSize) {
+        out.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+        buffer.clear();
+      }
+    }
+    out.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+  }
+
+  //...Features are encoded in parallel a chunk at a time directly into their
+  //   position in the output
+  for (size_t c0 = 0; c0 < numFeatures; c0 += c_chunkSize) {
+    const size_t c1 = std::min(numFeatures, c0 + c_chunkSize);
+    buffer.resize(offset[c1] - offset[c0]);
+#pragma omp parallel default(none) \
+    shared(buffer, order, offset, size, error, feature, type, c0, c1)
+    {
+      FlatGeobufFeature f;
+      std::vector<uint8_t> encoded;
+#pragma omp for schedule(static)
+      for (signed long long j = c0; j < static_cast<signed long long>(c1);
+           ++j) {
+        try {
+          f.clear();
+          feature(order[j], f);
+          encoded.clear();
+          encodeFeature(f, type, encoded);
+          if (encoded.size() != size[order[j]]) {
+            adcircmodules_throw_exception(
+                "FlatGeobufWriter: Feature changed while writing");
+          }
+          std::memcpy(&buffer[offset[j] - offset[c0]], encoded.data(),
+                      encoded.size());
+        } catch (...) {
+#pragma omp critical(flatgeobuf_error)
+          if (!error) error = std::current_exception();
+        }
+      }
+    }
+    if (error) std::rethrow_exception(error);
+    out.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+  }
+
+  if (!out.good()) {
+    adcircmodules_throw_exception("FlatGeobufWriter: Error writing " +
+                                  this->m_filename);
+  }
+}
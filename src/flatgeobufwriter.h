@@ -0,0 +1,102 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_FLATGEOBUFWRITER_H
+#define ADCMOD_FLATGEOBUFWRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class FlatGeobufFeature
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Geometry and attribute values of a single feature passed to the
+ * FlatGeobufWriter
+ */
+class FlatGeobufFeature {
+ public:
+  FlatGeobufFeature() = default;
+
+  void clear();
+
+  void addPoint(double x, double y);
+  void setInteger(uint16_t column, int32_t value);
+  void setDouble(uint16_t column, double value);
+
+  const std::vector<double> &xy() const;
+  const std::vector<uint8_t> &properties() const;
+
+ private:
+  std::vector<double> m_xy;
+  std::vector<uint8_t> m_properties;
+};
+
+/**
+ * @class FlatGeobufWriter
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Writes features to a FlatGeobuf file without requiring GDAL
+ *
+ * Features are sorted along a Hilbert curve through the extent of the data
+ * and a packed Hilbert R-tree is written ahead of the features so that
+ * readers can fetch a bounding box with range requests. Features are
+ * requested from a callback, which may be called concurrently from several
+ * threads, and are encoded in parallel.
+ */
+class FlatGeobufWriter {
+ public:
+  enum GeometryType : uint8_t { Point = 1, LineString = 2, Polygon = 3 };
+  enum ColumnType : uint8_t { Integer = 5, Double = 10 };
+
+  using FeatureFunction = std::function<void(size_t, FlatGeobufFeature &)>;
+
+  FlatGeobufWriter(const std::string &filename, GeometryType geometryType,
+                   int epsg = 0);
+
+  uint16_t addColumn(const std::string &name, ColumnType type);
+
+  void write(size_t numFeatures, const FeatureFunction &feature);
+
+  /// Number of children of each node in the packed R-tree
+  static constexpr uint16_t nodeSize() { return 16; }
+
+ private:
+  struct Column {
+    std::string name;
+    ColumnType type;
+  };
+
+  std::string m_filename;
+  GeometryType m_geometryType;
+  int m_epsg;
+  std::vector<Column> m_columns;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_FLATGEOBUFWRITER_H
@@ -45,6 +45,44 @@ void Griddata::setRasterFile(const std::string &rasterFile) {
   this->m_impl->setRasterFile(rasterFile);
 }
 
+/**
+ * @brief Adds a raster to the raster stack used for interpolation
+ * @param[in] rasterFile raster file to add
+ *
+ * Rasters are used in order of priority. The primary raster has the highest
+ * priority, followed by the added rasters in the order they were added. Each
+ * node is interpolated using the highest priority raster that fully covers
+ * its search footprint. All rasters are assumed to use the coordinate system
+ * given by setEpsg.
+ */
+void Griddata::addRasterFile(const std::string &rasterFile) {
+  this->m_impl->addRasterFile(rasterFile);
+}
+
+/**
+ * @brief Returns the rasters used for interpolation in priority order
+ * @return vector of raster file names
+ */
+std::vector<std::string> Griddata::rasterFiles() const {
+  return this->m_impl->rasterFiles();
+}
+
+/**
+ * @brief Removes all rasters added with addRasterFile. The primary raster is
+ * retained
+ */
+void Griddata::clearRasterFiles() { this->m_impl->clearRasterFiles(); }
+
+/**
+ * @brief Returns the index of the raster in the raster stack used for each
+ * node during the last interpolation
+ * @return vector of raster indices, -1 where no raster covered the node. Empty
+ * when only a single raster was used
+ */
+std::vector<int> Griddata::nodeRasterIndices() const {
+  return this->m_impl->nodeRasterIndices();
+}
+
 /**
  * @brief Reads a lookup table to be used with the interpolation
  * @param[in] lookupTableFile name of lookup table
@@ -248,6 +286,28 @@ void Griddata::setShowProgressBar(bool showProgressBar) {
   this->m_impl->setShowProgressBar(showProgressBar);
 }
 
+/**
+ * @brief Returns the progress monitor used to report progress of
+ * interpolation operations
+ * @return progress monitor. If none has been set, the internal monitor, which
+ * follows the showProgressBar setting, is returned
+ */
+Adcirc::ProgressMonitor *Griddata::progressMonitor() {
+  return this->m_impl->progressMonitor();
+}
+
+/**
+ * @brief Sets a progress monitor used to report progress of interpolation
+ * operations. Calling cancel on the monitor from another thread stops the
+ * running operation, which then throws an exception
+ * @param[in] monitor progress monitor. The monitor is not owned by this object
+ * and must outlive any operation it is used with. Pass nullptr to restore the
+ * internal monitor
+ */
+void Griddata::setProgressMonitor(Adcirc::ProgressMonitor *monitor) {
+  this->m_impl->setProgressMonitor(monitor);
+}
+
 /**
  * @brief Returns the raster multiplier applied after interpolation is complete
  * @return raster multiplier
@@ -340,3 +400,152 @@ std::vector<double> Griddata::extents() const {
 double Griddata::thresholdValue() const {
   return this->m_impl->thresholdValue();
 }
+
+/**
+ * @brief Returns true if timing information will be reported after the
+ * interpolation completes
+ * @return benchmark mode status
+ */
+bool Griddata::benchmarkMode() const { return this->m_impl->benchmarkMode(); }
+
+/**
+ * @brief Enables reporting of per-method node throughput after the
+ * interpolation completes
+ * @param[in] benchmarkMode true if timing information should be reported
+ *
+ * Timing each node adds a small amount of overhead, so this should only be
+ * used when profiling
+ */
+void Griddata::setBenchmarkMode(bool benchmarkMode) {
+  this->m_impl->setBenchmarkMode(benchmarkMode);
+}
+
+/**
+ * @brief Returns the file used to cache interpolation results between runs
+ * @return cache file name. Empty if caching is disabled
+ */
+std::string Griddata::cacheFile() const { return this->m_impl->cacheFile(); }
+
+/**
+ * @brief Sets a file used to cache the results of computeValuesFromRaster
+ * between runs
+ * @param[in] cacheFile name of the cache file. An empty string disables
+ * caching
+ *
+ * The cache is keyed by a checksum of the raster contents and the global
+ * interpolation settings. When these match, nodes whose position, method,
+ * filter size and local mesh size are unchanged reuse the cached value and
+ * only the remaining nodes are interpolated. The cache is rewritten after
+ * each run. Node position hashes require the OpenSSL library.
+ */
+void Griddata::setCacheFile(const std::string &cacheFile) {
+  this->m_impl->setCacheFile(cacheFile);
+}
+
+/**
+ * @brief Returns true if reduced resolution overviews of the raster are used
+ * for large averaging windows
+ * @return overview status
+ */
+bool Griddata::useOverviews() const { return this->m_impl->useOverviews(); }
+
+/**
+ * @brief Enables the use of reduced resolution overviews of the raster
+ * @param[in] useOverviews true if overviews should be used
+ *
+ * When enabled, nodes using the average or Bilskie et al. methods are
+ * interpolated from the coarsest overview level whose cell size still
+ * resolves the averaging radius. Overviews stored with the raster are used
+ * when reading from disk. A pyramid is built when the raster is held in
+ * memory.
+ */
+void Griddata::setUseOverviews(bool useOverviews) {
+  this->m_impl->setUseOverviews(useOverviews);
+}
+
+/**
+ * @brief Returns the minimum number of overview cells required across the
+ * averaging radius
+ * @return overview tolerance
+ */
+double Griddata::overviewTolerance() const {
+  return this->m_impl->overviewTolerance();
+}
+
+/**
+ * @brief Sets the minimum number of overview cells required across the
+ * averaging radius before an overview level is selected
+ * @param[in] overviewTolerance tolerance. A value of 1.0 is the minimum
+ * resolution allowed by the Bilskie et al. criterion. Larger values select
+ * finer levels. Default is 4.0
+ */
+void Griddata::setOverviewTolerance(double overviewTolerance) {
+  this->m_impl->setOverviewTolerance(overviewTolerance);
+}
+
+/**
+ * @brief Queues a nodal attribute to be computed by computeAttributes
+ * @param[in] attributeName name of the nodal attribute to generate
+ * @param[in] method interpolation method used for this attribute
+ * @param[in] lookupTableFile lookup table used to convert raster classes to
+ * values. If empty, raw raster values are used
+ * @param[in] defaultValue default value written to the nodal attribute and
+ * used where no value can be computed
+ * @param[in] units units written to the nodal attribute
+ * @return index of the job
+ *
+ * The interpolation method is applied to nodes which have not been flagged
+ * with Interpolation::NoMethod. Filter sizes are taken from the per-node
+ * filter sizes.
+ */
+size_t Griddata::addAttributeJob(const std::string &attributeName, int method,
+                                 const std::string &lookupTableFile,
+                                 double defaultValue,
+                                 const std::string &units) {
+  return this->m_impl->addAttributeJob(attributeName, method, lookupTableFile,
+                                       defaultValue, units);
+}
+
+/**
+ * @brief Queues a 12 direction wind reduction attribute to be computed by
+ * computeAttributes
+ * @param[in] attributeName name of the nodal attribute to generate
+ * @param[in] lookupTableFile lookup table used to convert raster classes to
+ * values. If empty, raw raster values are used
+ * @param[in] defaultValue default value written to the nodal attribute
+ * @param[in] units units written to the nodal attribute
+ * @return index of the job
+ */
+size_t Griddata::addDirectionalWindJob(const std::string &attributeName,
+                                       const std::string &lookupTableFile,
+                                       double defaultValue,
+                                       const std::string &units) {
+  return this->m_impl->addDirectionalWindJob(attributeName, lookupTableFile,
+                                             defaultValue, units);
+}
+
+/**
+ * @brief Returns the number of queued attribute jobs
+ * @return number of attribute jobs
+ */
+size_t Griddata::numAttributeJobs() const {
+  return this->m_impl->numAttributeJobs();
+}
+
+/**
+ * @brief Removes all queued attribute jobs
+ */
+void Griddata::clearAttributeJobs() { this->m_impl->clearAttributeJobs(); }
+
+/**
+ * @brief Computes all queued attribute jobs in a single pass over the raster
+ * @param[in] nodalAttributes nodal attributes object that receives the results
+ *
+ * The raster is read once per node and shared by all jobs. Attributes that
+ * already exist in the nodal attributes object are overwritten, otherwise they
+ * are added.
+ */
+void Griddata::computeAttributes(
+    Adcirc::ModelParameters::NodalAttributes *nodalAttributes) {
+  this->m_impl->computeAttributes(nodalAttributes);
+}
@@ -24,6 +24,8 @@
 #include <string>
 #include <vector>
 #include "interpolationmethods.h"
+#include "nodalattributes.h"
+#include "progressmonitor.h"
 
 namespace Adcirc {
 
@@ -69,6 +71,11 @@ class Griddata {
   std::string ADCIRCMODULES_EXPORT rasterFile() const;
   void ADCIRCMODULES_EXPORT setRasterFile(const std::string &rasterFile);
 
+  void ADCIRCMODULES_EXPORT addRasterFile(const std::string &rasterFile);
+  std::vector<std::string> ADCIRCMODULES_EXPORT rasterFiles() const;
+  void ADCIRCMODULES_EXPORT clearRasterFiles();
+  std::vector<int> ADCIRCMODULES_EXPORT nodeRasterIndices() const;
+
   void ADCIRCMODULES_EXPORT readLookupTable(const std::string &lookupTableFile);
 
   std::vector<int> ADCIRCMODULES_EXPORT interpolationFlags() const;
@@ -94,12 +101,31 @@ class Griddata {
   std::vector<std::vector<double>> ADCIRCMODULES_EXPORT
   computeDirectionalWindReduction(bool useLookupTable = false);
 
+  size_t ADCIRCMODULES_EXPORT
+  addAttributeJob(const std::string &attributeName, int method,
+                  const std::string &lookupTableFile = std::string(),
+                  double defaultValue = 0.0,
+                  const std::string &units = "unitless");
+  size_t ADCIRCMODULES_EXPORT
+  addDirectionalWindJob(const std::string &attributeName,
+                        const std::string &lookupTableFile = std::string(),
+                        double defaultValue = 0.0,
+                        const std::string &units = "unitless");
+  size_t ADCIRCMODULES_EXPORT numAttributeJobs() const;
+  void ADCIRCMODULES_EXPORT clearAttributeJobs();
+
+  void ADCIRCMODULES_EXPORT
+  computeAttributes(Adcirc::ModelParameters::NodalAttributes *nodalAttributes);
+
   int ADCIRCMODULES_EXPORT epsg() const;
   void ADCIRCMODULES_EXPORT setEpsg(int epsg);
 
   bool ADCIRCMODULES_EXPORT showProgressBar() const;
   void ADCIRCMODULES_EXPORT setShowProgressBar(bool showProgressBar);
 
+  Adcirc::ProgressMonitor ADCIRCMODULES_EXPORT *progressMonitor();
+  void ADCIRCMODULES_EXPORT setProgressMonitor(Adcirc::ProgressMonitor *monitor);
+
   double ADCIRCMODULES_EXPORT rasterMultiplier() const;
   void ADCIRCMODULES_EXPORT setRasterMultiplier(double rasterMultiplier);
 
@@ -118,6 +144,18 @@ class Griddata {
 
   std::vector<double> extents() const;
 
+  bool ADCIRCMODULES_EXPORT benchmarkMode() const;
+  void ADCIRCMODULES_EXPORT setBenchmarkMode(bool benchmarkMode);
+
+  std::string ADCIRCMODULES_EXPORT cacheFile() const;
+  void ADCIRCMODULES_EXPORT setCacheFile(const std::string &cacheFile);
+
+  bool ADCIRCMODULES_EXPORT useOverviews() const;
+  void ADCIRCMODULES_EXPORT setUseOverviews(bool useOverviews);
+
+  double ADCIRCMODULES_EXPORT overviewTolerance() const;
+  void ADCIRCMODULES_EXPORT setOverviewTolerance(double overviewTolerance);
+
  private:
   std::unique_ptr<Adcirc::Private::GriddataPrivate> m_impl;
 };
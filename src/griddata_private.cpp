@@ -21,19 +21,33 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <exception>
 #include <fstream>
 #include <numeric>
 #include <utility>
 
+#include <sys/stat.h>
+
+#include "boost/format.hpp"
+#include "boost/geometry.hpp"
+#include "boost/geometry/index/rtree.hpp"
 #include "boost/progress.hpp"
 #include "constants.h"
 #include "default_values.h"
 #include "elementtable.h"
 #include "fileio.h"
+#include "griddatacache.h"
+#include "hash.h"
 #include "griddata.h"
 #include "logging.h"
+#include "spacefillingcurve.h"
 #include "stringconversion.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace Adcirc;
 using namespace Adcirc::Geometry;
 using namespace Adcirc::Interpolation;
@@ -56,18 +70,77 @@ constexpr std::array<std::array<short, 7>, 3> c_windDirectionLookup = {
      {{4, 0, 0, 0, 0, 0, 10}},
      {{4, 5, 6, 7, 8, 9, 10}}}};
 
+//...Number of work batches generated per thread when scheduling nodes. More
+//   batches improve load balance, fewer batches improve raster locality
+constexpr size_t c_batchesPerThread = 32;
+
+//...Number of interpolation methods tracked by the benchmark report
+constexpr size_t c_numMethods = 9;
+
+//...Number and size of the blocks sampled from each raster file when
+//   computing the raster checksum
+constexpr size_t c_checksumSamples = 8;
+constexpr size_t c_checksumSampleSize = 64 * 1024;
+
+static std::string methodName(size_t method) {
+  switch (method) {
+    case NoMethod:
+      return "NoMethod";
+    case Average:
+      return "Average";
+    case Nearest:
+      return "Nearest";
+    case Highest:
+      return "Highest";
+    case PlusTwoSigma:
+      return "PlusTwoSigma";
+    case BilskieEtAll:
+      return "BilskieEtAll";
+    case InverseDistanceWeighted:
+      return "InverseDistanceWeighted";
+    case InverseDistanceWeightedNPoints:
+      return "InverseDistanceWeightedNPoints";
+    case AverageNearestNPoints:
+      return "AverageNearestNPoints";
+    default:
+      return "Unknown";
+  }
+}
+
+static int threadIndex() {
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+static int threadCount() {
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+/**
+ * @brief Computes the result cache key of a node from the binary
+ * representation of its horizontal position. xxHash64 is always available,
+ * so this does not depend on OpenSSL and cannot throw
+ */
+static uint64_t positionKey(const Adcirc::Geometry::Node *n) {
+  const double xy[2] = {n->x(), n->y()};
+  Adcirc::Cryptography::Hash h(Adcirc::Cryptography::AdcmodXXH64);
+  h.addData(std::string(reinterpret_cast<const char *>(xy), sizeof(xy)));
+  std::unique_ptr<char[]> digest(h.getHash());
+  return GriddataCache::hashToKey(digest.get());
+}
+
 template <typename T>
 int sgn(T val) {
   return (T(0) < val) - (val < T(0));
 }
 
-bool GriddataPrivate::getKeyValue(unsigned short key, double &value) {
-  auto t = this->m_lookup.find(key);
-  if (t == this->m_lookup.end()) return false;
-  value = t->second;
-  return true;
-}
-
 Griddata::~Griddata() = default;
 
 GriddataPrivate::GriddataPrivate()
@@ -85,7 +158,12 @@ GriddataPrivate::GriddataPrivate()
       m_calculatePointPtr(nullptr),
       m_thresholdValue(0.0),
       m_thresholdMethod(Interpolation::Threshold::NoThreshold),
-      m_rasterInMemory(false) {}
+      m_rasterInMemory(false),
+      m_benchmarkMode(false),
+      m_useOverviews(false),
+      m_overviewTolerance(4.0),
+      m_progressMonitor(nullptr),
+      m_defaultMonitor(new Adcirc::ProgressMonitor()) {}
 
 GriddataPrivate::GriddataPrivate(Mesh *mesh, const std::string &rasterFile)
     : m_mesh(mesh),
@@ -100,6 +178,11 @@ GriddataPrivate::GriddataPrivate(Mesh *mesh, const std::string &rasterFile)
       m_thresholdValue(0.0),
       m_thresholdMethod(Interpolation::Threshold::NoThreshold),
       m_rasterInMemory(false),
+      m_benchmarkMode(false),
+      m_useOverviews(false),
+      m_overviewTolerance(4.0),
+      m_progressMonitor(nullptr),
+      m_defaultMonitor(new Adcirc::ProgressMonitor()),
       m_raster(new Adcirc::Raster::Rasterdata(rasterFile)) {
   this->m_interpolationFlags.resize(this->m_mesh->numNodes());
   std::fill(this->m_interpolationFlags.begin(),
@@ -114,6 +197,25 @@ void GriddataPrivate::setRasterFile(const std::string &rasterFile) {
   this->m_rasterFile = rasterFile;
 }
 
+void GriddataPrivate::addRasterFile(const std::string &rasterFile) {
+  this->m_rasterStack.push_back(rasterFile);
+}
+
+std::vector<std::string> GriddataPrivate::rasterFiles() const {
+  std::vector<std::string> files;
+  files.reserve(this->m_rasterStack.size() + 1);
+  files.push_back(this->m_rasterFile);
+  files.insert(files.end(), this->m_rasterStack.begin(),
+               this->m_rasterStack.end());
+  return files;
+}
+
+void GriddataPrivate::clearRasterFiles() { this->m_rasterStack.clear(); }
+
+std::vector<int> GriddataPrivate::nodeRasterIndices() const {
+  return this->m_nodeRaster;
+}
+
 double GriddataPrivate::rasterMultiplier() const {
   return this->m_rasterMultiplier;
 }
@@ -130,11 +232,39 @@ void GriddataPrivate::setShowProgressBar(bool showProgressBar) {
   this->m_showProgressBar = showProgressBar;
 }
 
+Adcirc::ProgressMonitor *GriddataPrivate::progressMonitor() {
+  if (this->m_progressMonitor) return this->m_progressMonitor;
+  this->m_defaultMonitor->setShowProgressBar(this->m_showProgressBar);
+  return this->m_defaultMonitor.get();
+}
+
+void GriddataPrivate::setProgressMonitor(Adcirc::ProgressMonitor *monitor) {
+  this->m_progressMonitor = monitor;
+}
+
+/**
+ * @brief Completes the progress report for an operation and aborts the
+ * operation if it was cancelled while running
+ */
+void GriddataPrivate::finishProgress() {
+  Adcirc::ProgressMonitor *monitor = this->progressMonitor();
+  monitor->finish();
+  if (monitor->isCancelled()) {
+    this->closeRasterStack();
+    adcircmodules_throw_exception("Griddata: Operation cancelled");
+  }
+}
+
 int GriddataPrivate::epsg() const { return this->m_epsg; }
 
 void GriddataPrivate::setEpsg(int epsg) { this->m_epsg = epsg; }
 
 void GriddataPrivate::readLookupTable(const std::string &lookupTableFile) {
+  GriddataPrivate::parseLookupTable(lookupTableFile, this->m_lookup);
+}
+
+void GriddataPrivate::parseLookupTable(
+    const std::string &lookupTableFile, DenseLookupTable &table) {
   std::fstream fid(lookupTableFile);
 
   std::string l;
@@ -151,9 +281,18 @@ void GriddataPrivate::readLookupTable(const std::string &lookupTableFile) {
       adcircmodules_throw_exception("Could not read the lookup table.");
     }
     bool ok;
-    size_t cls = StringConversion::stringToSizet(ls[0], ok);
+    int cls = StringConversion::stringToInt(ls[0], ok);
+    if (!ok || cls < 0 || cls > DenseLookupTable::maxKey()) {
+      fid.close();
+      adcircmodules_throw_exception(
+          "Lookup table class out of range: " + ls[0]);
+    }
     double v = StringConversion::stringToDouble(ls[1], ok);
-    this->m_lookup[cls] = v;
+    if (!ok) {
+      fid.close();
+      adcircmodules_throw_exception("Could not read the lookup table.");
+    }
+    table.set(cls, v);
   }
   fid.close();
   return;
@@ -222,24 +361,54 @@ void GriddataPrivate::setRasterInMemory(bool rasterInMemory) {
   this->m_rasterInMemory = rasterInMemory;
 }
 
+bool GriddataPrivate::benchmarkMode() const { return this->m_benchmarkMode; }
+
+void GriddataPrivate::setBenchmarkMode(bool benchmarkMode) {
+  this->m_benchmarkMode = benchmarkMode;
+}
+
+std::string GriddataPrivate::cacheFile() const { return this->m_cacheFile; }
+
+void GriddataPrivate::setCacheFile(const std::string &cacheFile) {
+  this->m_cacheFile = cacheFile;
+}
+
+bool GriddataPrivate::useOverviews() const { return this->m_useOverviews; }
+
+void GriddataPrivate::setUseOverviews(bool useOverviews) {
+  this->m_useOverviews = useOverviews;
+}
+
+double GriddataPrivate::overviewTolerance() const {
+  return this->m_overviewTolerance;
+}
+
+void GriddataPrivate::setOverviewTolerance(double overviewTolerance) {
+  if (overviewTolerance < 1.0) {
+    adcircmodules_throw_exception(
+        "Griddata: Overview tolerance must be at least 1.0");
+  }
+  this->m_overviewTolerance = overviewTolerance;
+}
+
 template <typename T>
 bool GriddataPrivate::pixelDataInRadius(Point &p, double radius,
                                         std::vector<double> &x,
                                         std::vector<double> &y,
                                         std::vector<T> &z,
-                                        std::vector<bool> &valid) {
+                                        std::vector<uint8_t> &valid) {
   Adcirc::Raster::Pixel ul, lr;
-  this->m_raster.get()->searchBoxAroundPoint(p.first, p.second, radius, ul, lr);
+  this->raster()->searchBoxAroundPoint(p.first, p.second, radius, ul, lr);
   bool r = false;
 
   if (ul.isValid() && lr.isValid()) {
-    this->m_raster.get()->pixelValues<T>(ul.i(), ul.j(), lr.i(), lr.j(), x, y,
+    this->raster()->pixelValues<T>(ul.i(), ul.j(), lr.i(), lr.j(), x, y,
                                          z);
     valid.resize(x.size());
     std::fill(valid.begin(), valid.end(), false);
 
     for (size_t i = 0; i < x.size(); ++i) {
-      if (z[i] != this->m_raster.get()->nodata<T>()) {
+      if (z[i] != this->raster()->nodata<T>()) {
         if (Constants::distance(p, x[i], y[i]) <= radius) {
           valid[i] = true;
           r = true;
@@ -294,35 +463,21 @@ double GriddataPrivate::calculatePoint(Point &p, double searchRadius,
 double GriddataPrivate::calculatePointFromLookup(Point &p, double searchRadius,
                                                  double gsMultiplier,
                                                  Interpolation::Method method) {
-  switch (method) {
-    case Average:
-      return this->calculateAverageFromLookup(p, searchRadius * gsMultiplier);
-    case Nearest:
-      return this->calculateNearestFromLookup(p, searchRadius * gsMultiplier);
-    case Highest:
-      return this->calculateHighestFromLookup(p, searchRadius * gsMultiplier);
-    case PlusTwoSigma:
-      return this->calculateOutsideStandardDeviationFromLookup(
-          p, searchRadius * gsMultiplier, 2);
-    case BilskieEtAll:
-      return this->calculateBilskieAveragingFromLookup(p, searchRadius,
-                                                       gsMultiplier);
-    case InverseDistanceWeighted:
-      return this->calculateInverseDistanceWeightedFromLookup(
-          p, searchRadius * gsMultiplier);
-    case InverseDistanceWeightedNPoints:
-      return this->calculateInverseDistanceWeightedNPointsFromLookup(
-          p, gsMultiplier);
-    case AverageNearestNPoints:
-      return this->calculateAverageNearestNFromLookup(p, gsMultiplier);
-    default:
-      return this->defaultValue();
+  PixelWindow window;
+  std::vector<double> z;
+  std::vector<uint8_t> valid;
+  if (!this->readPixelWindow<int>(
+          p, this->searchRadius(method, searchRadius, gsMultiplier), window)) {
+    return this->defaultValue();
   }
+  this->classifyWindow(window, &this->m_lookup, z, valid);
+  return this->reduceWindow(p, searchRadius, gsMultiplier, method, window, z,
+                            valid);
 }
 
 double GriddataPrivate::calculateAverage(Point &p, double w) {
   std::vector<double> x, y, z;
-  std::vector<bool> v;
+  std::vector<uint8_t> v;
   if (this->pixelDataInRadius(p, w, x, y, z, v)) {
     double a = 0.0;
     size_t n = 0;
@@ -338,51 +493,19 @@ double GriddataPrivate::calculateAverage(Point &p, double w) {
   }
 }
 
-double GriddataPrivate::calculateAverageFromLookup(Point &p, double w) {
-  std::vector<double> x, y;
-  std::vector<int> z;
-  std::vector<bool> v;
-  if (this->pixelDataInRadius(p, w, x, y, z, v)) {
-    size_t n = 0;
-    double a = 0.0;
-    for (size_t i = 0; i < x.size(); ++i) {
-      if (v[i]) {
-        double zl;
-        if (this->getKeyValue(z[i], zl)) {
-          a += zl;
-          n++;
-        }
-      }
-    }
-    return (n > 0 ? a / static_cast<double>(n) : this->defaultValue());
-  } else {
-    return this->defaultValue();
-  }
-}
-
 double GriddataPrivate::calculateBilskieAveraging(Point &p, double w,
                                                   double gsMultiplier) {
   double r;
-  if (this->calculateBilskieRadius(w, this->m_raster.get()->dx(), r)) {
+  if (this->calculateBilskieRadius(w, this->raster()->dx(), r)) {
     return this->calculateAverage(p, r * gsMultiplier);
   } else {
     return this->calculateNearest(p, w * gsMultiplier);
   }
 }
 
-double GriddataPrivate::calculateBilskieAveragingFromLookup(
-    Point &p, double w, double gsMultiplier) {
-  double r;
-  if (this->calculateBilskieRadius(w, this->m_raster.get()->dx(), r)) {
-    return this->calculateAverageFromLookup(p, r * gsMultiplier);
-  } else {
-    return this->calculateNearestFromLookup(p, w * gsMultiplier);
-  }
-}
-
 double GriddataPrivate::calculateInverseDistanceWeighted(Point &p, double w) {
   std::vector<double> x, y, z;
-  std::vector<bool> v;
+  std::vector<uint8_t> v;
   if (this->pixelDataInRadius(p, w, x, y, z, v)) {
     double n = 0.0;
     double d = 0.0;
@@ -403,7 +526,7 @@ double GriddataPrivate::calculateInverseDistanceWeighted(Point &p, double w) {
 double GriddataPrivate::calculateInverseDistanceWeightedNPoints(Point &p,
                                                                 double n) {
   std::vector<double> x, y, z;
-  std::vector<bool> v;
+  std::vector<uint8_t> v;
   int maxPoints = static_cast<size_t>(n);
 
   double w = this->calculateExpansionLevelForPoints(maxPoints);
@@ -432,7 +555,7 @@ bool sortPointsByIncreasingDistance(Point &a, Point &b) {
 
 double GriddataPrivate::calculateAverageNearestN(Point &p, double n) {
   std::vector<double> x, y, z;
-  std::vector<bool> v;
+  std::vector<uint8_t> v;
   size_t maxPoints = static_cast<size_t>(n);
   double w = this->calculateExpansionLevelForPoints(maxPoints);
   std::vector<Point> pts;
@@ -460,65 +583,6 @@ double GriddataPrivate::calculateAverageNearestN(Point &p, double n) {
   return this->defaultValue();
 }
 
-double GriddataPrivate::calculateAverageNearestNFromLookup(Point &p, double n) {
-  std::vector<double> x, y;
-  std::vector<int> z;
-  std::vector<bool> v;
-  size_t maxPoints = static_cast<size_t>(n);
-  double w = this->calculateExpansionLevelForPoints(maxPoints);
-  std::vector<Point> pts;
-
-  if (this->pixelDataInRadius(p, w, x, y, z, v)) {
-    pts.reserve(z.size());
-    for (size_t i = 0; i < z.size(); ++i) {
-      if (v[i]) {
-        double zl;
-        if (this->getKeyValue(z[i], zl)) {
-          pts.push_back(Point(Constants::distance(p, x[i], y[i]), zl));
-        }
-      }
-    }
-
-    if (pts.size() == 0) return this->defaultValue();
-
-    size_t np = std::min(pts.size(), maxPoints);
-    std::partial_sort(pts.begin(), pts.begin() + np, pts.end(),
-                      sortPointsByIncreasingDistance);
-
-    double val = 0.0;
-    for (size_t i = 0; i < np; i++) {
-      val += pts[i].second;
-    }
-    return val / static_cast<double>(np);
-  }
-  return this->defaultValue();
-}
-
-double GriddataPrivate::calculateInverseDistanceWeightedFromLookup(Point &p,
-                                                                   double w) {
-  std::vector<double> x, y;
-  std::vector<int> z;
-  std::vector<bool> v;
-  if (this->pixelDataInRadius(p, w, x, y, z, v)) {
-    double n = 0.0;
-    double d = 0.0;
-    size_t num = 0;
-    for (size_t i = 0; i < z.size(); ++i) {
-      if (v[i]) {
-        double zl;
-        if (this->getKeyValue(z[i], zl)) {
-          double dis = Constants::distance(p, x[i], y[i]);
-          n += zl / dis;
-          d += 1.0 / dis;
-          num++;
-        }
-      }
-    }
-    return num > 0 ? n / d : this->defaultValue();
-  }
-  return this->defaultValue();
-}
-
 double GriddataPrivate::calculateExpansionLevelForPoints(size_t n) {
   //...This tries to build out a box around a point at the
   // resolution of the raster. The hope is that by going 2
@@ -526,7 +590,7 @@ double GriddataPrivate::calculateExpansionLevelForPoints(size_t n) {
   // requested number of points, we'll always hit the request
   // unless we're in a severe nodata region
   int levels = std::floor(n / 8.0) + 2;
-  return this->m_raster.get()->dx() * static_cast<double>(levels);
+  return this->raster()->dx() * static_cast<double>(levels);
 }
 
 Adcirc::Interpolation::Threshold GriddataPrivate::thresholdMethod() const {
@@ -556,40 +620,10 @@ void GriddataPrivate::setThresholdValue(double filterValue) {
   m_thresholdValue = filterValue;
 }
 
-double GriddataPrivate::calculateInverseDistanceWeightedNPointsFromLookup(
-    Point &p, double n) {
-  std::vector<double> x, y;
-  std::vector<int> z;
-  std::vector<bool> v;
-  int maxPoints = static_cast<size_t>(n);
-
-  double w = calculateExpansionLevelForPoints(n);
-
-  if (this->pixelDataInRadius(p, w, x, y, z, v)) {
-    double val = 0.0;
-    double d = 0.0;
-    size_t np = 0;
-    for (size_t i = 0; i < z.size(); ++i) {
-      if (v[i]) {
-        double zl;
-        if (this->getKeyValue(z[i], zl)) {
-          double dis = Constants::distance(p, x[i], y[i]);
-          val += zl / dis;
-          d += 1.0 / dis;
-          np++;
-        }
-      }
-      if (np >= maxPoints) break;
-    }
-    return np > 0 ? val / d : this->defaultValue();
-  }
-  return this->defaultValue();
-}
-
 double GriddataPrivate::calculateOutsideStandardDeviation(Point &p, double w,
                                                           int n) {
   std::vector<double> x, y, z, z2;
-  std::vector<bool> v;
+  std::vector<uint8_t> v;
   z2.reserve(z.size());
   if (this->pixelDataInRadius(p, w, x, y, z, v)) {
     for (size_t i = 0; i < z.size(); ++i) {
@@ -615,110 +649,37 @@ double GriddataPrivate::calculateOutsideStandardDeviation(Point &p, double w,
   return this->defaultValue();
 }
 
-double GriddataPrivate::calculateOutsideStandardDeviationFromLookup(Point &p,
-                                                                    double w,
-                                                                    int n) {
-  std::vector<double> x, y, z2;
-  std::vector<int> z;
-  std::vector<bool> v;
-  z2.reserve(z.size());
-  if (this->pixelDataInRadius(p, w, x, y, z, v)) {
-    for (size_t i = 0; i < z.size(); ++i) {
-      if (v[i]) {
-        double zl;
-        if (this->getKeyValue(z[i], zl)) {
-          z2.push_back(zl);
-        }
-      }
-    }
-    double mean = std::accumulate(z2.begin(), z2.end(), 0.0) / z2.size();
-    double stddev = std::sqrt(
-        std::inner_product(z2.begin(), z2.end(), z2.begin(), 0.0) / z2.size() -
-        (mean * mean));
-    double cutoff = mean + n * stddev;
-    double a = 0.0;
-    size_t np = 0;
-    for (size_t i = 0; i < z2.size(); i++) {
-      if (z2[i] >= cutoff) {
-        a += z2[i];
-        np++;
-      }
-    }
-    return np > 0 ? a / static_cast<double>(np)
-                  : this->calculateAverageFromLookup(p, w);
-  }
-  return this->defaultValue();
-}
-
 double GriddataPrivate::calculateNearest(Point &p, double w) {
-  Adcirc::Raster::Pixel px = this->m_raster.get()->coordinateToPixel(p);
-  Point pxloc = this->m_raster.get()->pixelToCoordinate(px);
+  Adcirc::Raster::Pixel px = this->raster()->coordinateToPixel(p);
+  Point pxloc = this->raster()->pixelToCoordinate(px);
   double d = Constants::distance(p, pxloc);
   if (d > w) {
     return this->defaultValue();
   } else {
-    double z = this->m_raster.get()->pixelValue<double>(px);
-    return z != this->m_raster.get()->nodata<double>() ? z
+    double z = this->raster()->pixelValue<double>(px);
+    return z != this->raster()->nodata<double>() ? z
                                                        : this->defaultValue();
   }
 }
 
-double GriddataPrivate::calculateNearestFromLookup(Point &p, double w) {
-  Adcirc::Raster::Pixel px = this->m_raster.get()->coordinateToPixel(p);
-  Point pxloc = this->m_raster.get()->pixelToCoordinate(px);
-  double d = Constants::distance(p, pxloc);
-  if (d > w)
-    return this->defaultValue();
-  else {
-    int z = this->m_raster.get()->pixelValue<int>(px);
-    if (z != this->m_raster.get()->nodata<int>()) {
-      double zl;
-      return this->getKeyValue(z, zl) ? zl : this->defaultValue();
-    } else {
-      return this->defaultValue();
-    }
-  }
-}
-
 double GriddataPrivate::calculateHighest(Point &p, double w) {
   std::vector<double> x, y, z;
-  std::vector<bool> v;
+  std::vector<uint8_t> v;
   if (this->pixelDataInRadius(p, w, x, y, z, v)) {
-    double zm = std::numeric_limits<double>::min();
+    double zm = -std::numeric_limits<double>::max();
+    bool found = false;
     for (size_t i = 0; i < x.size(); ++i) {
       if (v[i]) {
-        if (z[i] > zm) {
-          zm = z[i];
-        }
+        zm = std::max(zm, z[i]);
+        found = true;
       }
     }
-    return zm;
+    return found ? zm : this->defaultValue();
   } else {
     return this->defaultValue();
   }
 }
 
-double GriddataPrivate::calculateHighestFromLookup(Point &p, double w) {
-  std::vector<double> x, y;
-  std::vector<int> z;
-  std::vector<bool> v;
-  if (this->pixelDataInRadius(p, w, x, y, z, v)) {
-    double zm = std::numeric_limits<double>::min();
-    for (size_t i = 0; i < x.size(); ++i) {
-      if (v[i]) {
-        double zl;
-        if (this->getKeyValue(z[i], zl)) {
-          if (zl > zm) {
-            zm = zl;
-          }
-        }
-      }
-    }
-    return zm != std::numeric_limits<double>::min() ? zm : this->defaultValue();
-  }
-  return this->defaultValue();
-}
-
 bool GriddataPrivate::computeWindDirectionAndWeight(Point &p, double x,
                                                     double y, double &w,
                                                     int &dir) {
@@ -763,7 +724,7 @@ std::vector<double> GriddataPrivate::calculateDirectionalWindFromRaster(
     Point &p) {
   double nearWeight = 0.0;
   std::vector<double> x, y, z, wind, weight;
-  std::vector<bool> v;
+  std::vector<uint8_t> v;
   wind.resize(12);
   weight.resize(12);
 
@@ -792,41 +753,19 @@ std::vector<double> GriddataPrivate::calculateDirectionalWindFromRaster(
 
 std::vector<double> GriddataPrivate::calculateDirectionalWindFromLookup(
     Point &p) {
-  double nearWeight = 0.0;
-  std::vector<double> x, y, wind, weight;
-  std::vector<int> z;
-  std::vector<bool> v;
-  wind.resize(12);
-  weight.resize(12);
-
-  std::fill(weight.begin(), weight.end(), 0.0);
-  std::fill(wind.begin(), wind.end(), 0.0);
-
-  this->pixelDataInRadius(p, this->windRadius(), x, y, z, v);
-
-  for (size_t i = 0; i < x.size(); ++i) {
-    if (v[i]) {
-      double zl;
-      if (this->getKeyValue(z[i], zl)) {
-        double w = 0.0;
-        int dir = 0;
-
-        if (this->computeWindDirectionAndWeight(p, x[i], y[i], w, dir)) {
-          weight[dir] += w;
-          wind[dir] += w * zl;
-        } else {
-          nearWeight += w;
-        }
-      }
-    }
+  PixelWindow window;
+  std::vector<double> z;
+  std::vector<uint8_t> valid;
+  if (!this->readPixelWindow<int>(p, this->windRadius(), window)) {
+    return std::vector<double>(12, 0.0);
   }
-
-  this->computeWeightedDirectionalWindValues(weight, wind, nearWeight);
-  return wind;
+  this->classifyWindow(window, &this->m_lookup, z, valid);
+  return this->reduceDirectionalWind(p, window, z, valid);
 }
 
 void GriddataPrivate::assignInterpolationFunctionPointer(bool useLookupTable) {
   if (useLookupTable) {
+    this->checkLookupTable();
     this->m_calculatePointPtr = &GriddataPrivate::calculatePointFromLookup;
   } else {
     this->m_calculatePointPtr = &GriddataPrivate::calculatePoint;
@@ -855,9 +794,17 @@ void GriddataPrivate::checkRasterOpen() {
   }
 }
 
+void GriddataPrivate::checkLookupTable() {
+  if (this->thresholdMethod() != Interpolation::Threshold::NoThreshold) {
+    adcircmodules_throw_exception(
+        "Cannot use thresholding and integer rasters");
+  }
+}
+
 void GriddataPrivate::assignDirectionalWindReductionFunctionPointer(
     bool useLookupTable) {
   if (useLookupTable) {
+    this->checkLookupTable();
     this->m_calculateDwindPtr =
         &GriddataPrivate::calculateDirectionalWindFromLookup;
   } else {
@@ -866,47 +813,640 @@ void GriddataPrivate::assignDirectionalWindReductionFunctionPointer(
   }
 }
 
+double GriddataPrivate::searchRadius(Interpolation::Method method,
+                                     double meshSize, double gsMultiplier) {
+  switch (method) {
+    case NoMethod:
+    case Nearest:
+      return 0.0;
+    case BilskieEtAll: {
+      double r;
+      if (this->calculateBilskieRadius(meshSize, this->raster()->dx(),
+                                       r)) {
+        return r * gsMultiplier;
+      } else {
+        return 0.0;
+      }
+    }
+    case InverseDistanceWeightedNPoints:
+    case AverageNearestNPoints:
+      return this->calculateExpansionLevelForPoints(
+          static_cast<size_t>(gsMultiplier));
+    default:
+      return meshSize * gsMultiplier;
+  }
+}
+
+double GriddataPrivate::searchRadiusForNode(size_t index, double meshSize) {
+  return this->searchRadius(
+      static_cast<Method>(this->m_interpolationFlags[index]), meshSize,
+      this->m_filterSize[index]);
+}
+
+/**
+ * @brief Generates the order in which nodes are processed and the batches of
+ * nodes that are handed to each thread
+ * @param[in] radius search radius for each node
+ * @param[out] order node indices sorted by search radius class and then
+ * position along a Hilbert curve
+ * @param[out] batches ranges in the order vector with approximately equal
+ * computational cost
+ *
+ * Nodes that are close to one another touch the same raster blocks, so
+ * processing them on the same thread in sequence keeps the raster cache warm.
+ * Nodes are first grouped by the size of the pixel window they will read so
+ * that a batch never mixes cheap and expensive nodes, then the cost of each
+ * node is estimated as the number of pixels in its window and the sorted list
+ * is cut into batches of roughly equal cost.
+ */
+void GriddataPrivate::buildSpatialSchedule(const std::vector<double> &radius,
+                                           std::vector<size_t> &order,
+                                           std::vector<NodeBatch> &batches) {
+  const size_t n = this->m_mesh->numNodes();
+  const bool grouped = !this->m_nodeRaster.empty();
+
+  std::vector<double> cost(n);
+  std::vector<uint64_t> key(n);
+  std::vector<int> radiusClass(n);
+
+  std::vector<double> x = this->m_mesh->x();
+  std::vector<double> y = this->m_mesh->y();
+  std::vector<uint64_t> hilbert = SpaceFillingCurve::hilbertKeys(x, y);
+
+  for (size_t i = 0; i < n; ++i) {
+    const double dx =
+        grouped && this->m_nodeRaster[i] >= 0
+            ? this->m_rasterStackInfo[this->m_nodeRaster[i]]->dx()
+            : this->m_raster.get()->dx();
+    double w = std::ceil(radius[i] / dx);
+    cost[i] = (2.0 * w + 1.0) * (2.0 * w + 1.0);
+    radiusClass[i] = static_cast<int>(std::log2(std::max(1.0, w)));
+    key[i] = hilbert[i];
+  }
+
+  order.resize(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    if (grouped && this->m_nodeRaster[a] != this->m_nodeRaster[b]) {
+      return this->m_nodeRaster[a] < this->m_nodeRaster[b];
+    }
+    if (radiusClass[a] != radiusClass[b]) {
+      return radiusClass[a] < radiusClass[b];
+    }
+    return key[a] < key[b];
+  });
+
+  const double totalCost = std::accumulate(cost.begin(), cost.end(), 0.0);
+  const double targetCost =
+      std::max(1.0, totalCost / static_cast<double>(threadCount() *
+                                                    c_batchesPerThread));
+
+  batches.clear();
+  size_t start = 0;
+  double batchCost = 0.0;
+  for (size_t k = 0; k < n; ++k) {
+    if (k > start &&
+        (radiusClass[order[k]] != radiusClass[order[start]] ||
+         (grouped && this->m_nodeRaster[order[k]] !=
+                         this->m_nodeRaster[order[start]]))) {
+      batches.push_back(NodeBatch(start, k));
+      start = k;
+      batchCost = 0.0;
+    }
+    batchCost += cost[order[k]];
+    if (batchCost >= targetCost) {
+      batches.push_back(NodeBatch(start, k + 1));
+      start = k + 1;
+      batchCost = 0.0;
+    }
+  }
+  if (start < n) batches.push_back(NodeBatch(start, n));
+  return;
+}
+
+Adcirc::Raster::Rasterdata *GriddataPrivate::raster() {
+  if (this->m_activeRaster.empty()) return this->m_raster.get();
+  Adcirc::Raster::Rasterdata *r = this->m_activeRaster[threadIndex()];
+  return r != nullptr ? r : this->m_raster.get();
+}
+
+/**
+ * @brief Opens the rasters in the raster stack and records their footprints
+ *
+ * The primary raster is always the first (highest priority) entry in the
+ * stack. When the rasters are held in memory, a single copy of each raster is
+ * shared by all threads. Otherwise, each thread opens its own handle the
+ * first time it needs a raster.
+ */
+void GriddataPrivate::openRasterStack() {
+  this->closeRasterStack();
+
+  this->m_rasterStackInfo.push_back(this->m_raster.get());
+  for (const auto &f : this->m_rasterStack) {
+    std::unique_ptr<Adcirc::Raster::Rasterdata> r(
+        new Adcirc::Raster::Rasterdata(f));
+    if (!r->open()) {
+      adcircmodules_throw_exception("Griddata: Could not open raster file " +
+                                    f);
+    }
+    if (this->m_rasterInMemory) {
+      r->read();
+    }
+    if (this->m_useOverviews) {
+      r->initializeOverviews();
+    }
+    this->m_rasterStackInfo.push_back(r.get());
+    this->m_rasterPool.push_back(std::move(r));
+  }
+
+  const size_t nt = static_cast<size_t>(threadCount());
+  this->m_activeRaster.assign(nt, nullptr);
+  this->m_threadRasters.assign(
+      nt, std::vector<Adcirc::Raster::Rasterdata *>(
+              this->m_rasterStackInfo.size(), nullptr));
+  for (size_t t = 0; t < nt; ++t) {
+    if (t == 0 || this->m_rasterInMemory) {
+      this->m_threadRasters[t] = this->m_rasterStackInfo;
+    }
+  }
+}
+
+void GriddataPrivate::closeRasterStack() {
+  this->m_activeRaster.clear();
+  this->m_threadRasters.clear();
+  this->m_rasterStackInfo.clear();
+  this->m_rasterPool.clear();
+}
+
+Adcirc::Raster::Rasterdata *GriddataPrivate::threadRaster(size_t index) {
+  const int t = threadIndex();
+  Adcirc::Raster::Rasterdata *r = this->m_threadRasters[t][index];
+  if (r == nullptr) {
+    std::unique_ptr<Adcirc::Raster::Rasterdata> rd(
+        new Adcirc::Raster::Rasterdata(
+            this->m_rasterStackInfo[index]->filename()));
+    bool success;
+#pragma omp critical
+    {
+      success = rd->open();
+      if (success && this->m_useOverviews) {
+        rd->initializeOverviews();
+      }
+      r = rd.get();
+      this->m_rasterPool.push_back(std::move(rd));
+    }
+    if (!success) {
+      //...Exceptions cannot leave the parallel region, so the failure is
+      //   recorded and raised once the region has finished
+      try {
+        adcircmodules_throw_exception("Griddata: Could not open raster file " +
+                                      r->filename());
+      } catch (...) {
+#pragma omp critical
+        {
+          if (!this->m_rasterError) {
+            this->m_rasterError = std::current_exception();
+          }
+        }
+      }
+      return nullptr;
+    }
+    this->m_threadRasters[t][index] = r;
+  }
+  return r;
+}
+
+/**
+ * @brief Assigns each node to a raster in the raster stack and computes the
+ * search radius for the node
+ * @param radiusForNode function returning the search radius for a node using
+ * the currently active raster
+ * @param radius search radius for each node
+ *
+ * Each node uses the highest priority raster that fully covers its search
+ * footprint. If no raster covers the footprint, the highest priority raster
+ * that contains the node is used. Nodes outside all rasters are assigned -1.
+ */
+template <typename F>
+void GriddataPrivate::assignRasters(F radiusForNode,
+                                    std::vector<double> &radius) {
+  namespace bg = boost::geometry;
+  namespace bgi = boost::geometry::index;
+  using point_t = bg::model::point<double, 2, bg::cs::cartesian>;
+  using box_t = bg::model::box<point_t>;
+  using value_t = std::pair<box_t, size_t>;
+
+  const size_t nn = this->m_mesh->numNodes();
+  radius.resize(nn);
+
+  if (this->m_rasterStack.empty()) {
+    this->m_nodeRaster.clear();
+    if (this->m_useOverviews) {
+      this->m_activeRaster.assign(threadCount(), nullptr);
+    }
+    for (size_t i = 0; i < nn; ++i) {
+      radius[i] = radiusForNode(i);
+    }
+    return;
+  }
+
+  this->openRasterStack();
+
+  std::vector<value_t> footprints;
+  for (size_t r = 0; r < this->m_rasterStackInfo.size(); ++r) {
+    const Adcirc::Raster::Rasterdata *rd = this->m_rasterStackInfo[r];
+    footprints.push_back(
+        value_t(box_t(point_t(rd->xmin(), rd->ymin()),
+                      point_t(rd->xmax(), rd->ymax())),
+                r));
+  }
+  const bgi::rtree<value_t, bgi::quadratic<16>> tree(footprints.begin(),
+                                                      footprints.end());
+
+  this->m_nodeRaster.assign(nn, -1);
+
+#pragma omp parallel for schedule(dynamic, 1024) default(none) \
+    shared(tree, radius, radiusForNode)
+  for (signed long long i = 0;
+       i < static_cast<signed long long>(this->m_mesh->numNodes()); ++i) {
+    const double x = this->m_mesh->node(i)->x();
+    const double y = this->m_mesh->node(i)->y();
+
+    std::vector<value_t> candidates;
+    tree.query(bgi::intersects(point_t(x, y)), std::back_inserter(candidates));
+    std::sort(candidates.begin(), candidates.end(),
+              [](const value_t &a, const value_t &b) {
+                return a.second < b.second;
+              });
+
+    radius[i] = 0.0;
+    for (const auto &c : candidates) {
+      this->m_activeRaster[threadIndex()] = this->m_rasterStackInfo[c.second];
+      const double r = radiusForNode(i);
+      const box_t search(point_t(x - r, y - r), point_t(x + r, y + r));
+      if (bg::covered_by(search, c.first)) {
+        this->m_nodeRaster[i] = static_cast<int>(c.second);
+        radius[i] = r;
+        break;
+      }
+    }
+
+    if (this->m_nodeRaster[i] == -1 && !candidates.empty()) {
+      const size_t r = candidates.front().second;
+      this->m_activeRaster[threadIndex()] = this->m_rasterStackInfo[r];
+      this->m_nodeRaster[i] = static_cast<int>(r);
+      radius[i] = radiusForNode(i);
+    }
+  }
+
+  std::fill(this->m_activeRaster.begin(), this->m_activeRaster.end(), nullptr);
+}
+
+/**
+ * @brief Makes the raster assigned to a node the active raster for the
+ * calling thread
+ * @param index node index
+ * @return false if the node is not covered by any raster
+ */
+bool GriddataPrivate::activateRasterForNode(size_t index) {
+  if (this->m_nodeRaster.empty()) {
+    if (!this->m_activeRaster.empty()) {
+      this->m_activeRaster[threadIndex()] = nullptr;
+    }
+    return true;
+  }
+  const int r = this->m_nodeRaster[index];
+  if (r < 0) return false;
+  Adcirc::Raster::Rasterdata *raster = this->threadRaster(r);
+  if (raster == nullptr) return false;
+  this->m_activeRaster[threadIndex()] = raster;
+  return true;
+}
+
+/**
+ * @brief Raises an error recorded while opening rasters inside a parallel
+ * region
+ */
+void GriddataPrivate::rethrowRasterError() {
+  if (!this->m_rasterError) return;
+  std::exception_ptr error = this->m_rasterError;
+  this->m_rasterError = nullptr;
+  this->closeRasterStack();
+  std::rethrow_exception(error);
+}
+
+/**
+ * @brief Replaces the active raster for the calling thread with the coarsest
+ * overview level that still resolves the averaging radius of the node
+ * @param index node index
+ * @param meshSize mesh size around the node, expressed as a radius
+ *
+ * Only the averaging methods are eligible. A level is acceptable when its
+ * cell size multiplied by the overview tolerance does not exceed the
+ * averaging radius, which is the Bilskie et al. criterion when the tolerance
+ * is 1.0.
+ */
+void GriddataPrivate::selectOverviewForNode(size_t index, double meshSize) {
+  if (!this->m_useOverviews) return;
+
+  Adcirc::Raster::Rasterdata *base = this->raster();
+  if (base->numOverviews() == 0) return;
+
+  double r;
+  switch (this->m_interpolationFlags[index]) {
+    case Average:
+      r = meshSize * this->m_filterSize[index];
+      break;
+    case BilskieEtAll:
+      if (!this->calculateBilskieRadius(meshSize, base->dx(), r)) return;
+      r *= this->m_filterSize[index];
+      break;
+    default:
+      return;
+  }
+
+  for (size_t k = base->numOverviews(); k > 0; --k) {
+    Adcirc::Raster::Rasterdata *level = base->overview(k - 1);
+    if (level->dx() * this->m_overviewTolerance <= r) {
+      this->m_activeRaster[threadIndex()] = level;
+      return;
+    }
+  }
+}
+
+void GriddataPrivate::reportBenchmark(
+    const std::vector<std::vector<size_t>> &count,
+    const std::vector<std::vector<double>> &time, double wallTime) {
+  size_t total = 0;
+  for (size_t m = 0; m < c_numMethods; ++m) {
+    size_t nodes = 0;
+    double seconds = 0.0;
+    for (size_t t = 0; t < count.size(); ++t) {
+      nodes += count[t][m];
+      seconds += time[t][m];
+    }
+    total += nodes;
+    if (nodes == 0) continue;
+    Adcirc::Logging::log(
+        boost::str(boost::format("Griddata benchmark: %-30s %10i nodes, "
+                                 "%12.4f thread-seconds, %14.2f nodes/s") %
+                   methodName(m) % nodes % seconds %
+                   (seconds > 0.0 ? static_cast<double>(nodes) / seconds
+                                  : 0.0)));
+  }
+  Adcirc::Logging::log(boost::str(
+      boost::format("Griddata benchmark: %i nodes in %0.4f seconds on %i "
+                    "threads, %0.2f nodes/s") %
+      total % wallTime % count.size() %
+      (wallTime > 0.0 ? static_cast<double>(total) / wallTime : 0.0)));
+}
+
 std::vector<double> GriddataPrivate::computeValuesFromRaster(
     bool useLookupTable) {
   this->checkRasterOpen();
   this->checkMatchingCoorindateSystems();
   this->assignInterpolationFunctionPointer(useLookupTable);
-  std::unique_ptr<boost::progress_display> progress(nullptr);
 
   if (this->m_rasterInMemory) {
     this->m_raster.get()->read();
   }
 
+  if (this->m_useOverviews) {
+    this->m_raster.get()->initializeOverviews();
+  }
+
   std::vector<double> gridsize = this->m_mesh->computeMeshSize();
   std::vector<double> result;
   result.resize(this->m_mesh->numNodes());
 
-  if (this->showProgressBar()) {
-    progress = std::unique_ptr<boost::progress_display>(
-        new boost::progress_display(this->m_mesh->numNodes()));
+  std::string key;
+  std::vector<uint64_t> positionHash;
+  std::vector<char> cached;
+  if (!this->m_cacheFile.empty()) {
+    key = this->cacheKey(useLookupTable);
+    this->readCachedValues(key, gridsize, positionHash, cached, result);
   }
 
-#pragma omp parallel for schedule(dynamic) default(none) \
-    shared(progress, result, gridsize)
-  for (signed long long i = 0;
-       i < static_cast<signed long long>(this->m_mesh->numNodes()); ++i) {
-    if (this->m_showProgressBar) {
-#pragma omp critical
-      ++(*progress.get());
+  std::vector<double> radius;
+  this->assignRasters(
+      [&](size_t i) {
+        return !cached.empty() && cached[i]
+                   ? 0.0
+                   : this->searchRadiusForNode(i, gridsize[i] * 0.5);
+      },
+      radius);
+
+  std::vector<size_t> order;
+  std::vector<NodeBatch> batches;
+  this->buildSpatialSchedule(radius, order, batches);
+
+  std::vector<std::vector<size_t>> benchCount(
+      threadCount(), std::vector<size_t>(c_numMethods, 0));
+  std::vector<std::vector<double>> benchTime(
+      threadCount(), std::vector<double>(c_numMethods, 0.0));
+  auto wallStart = std::chrono::steady_clock::now();
+
+  Adcirc::ProgressMonitor *monitor = this->progressMonitor();
+  monitor->begin(this->m_mesh->numNodes());
+
+#pragma omp parallel for schedule(dynamic, 1) default(none) \
+    shared(monitor, result, gridsize, order, batches, benchCount, benchTime, \
+           cached)
+  for (signed long long b = 0; b < static_cast<signed long long>(batches.size());
+       ++b) {
+    if (monitor->isCancelled()) continue;
+    for (size_t k = batches[b].first; k < batches[b].second; ++k) {
+      const size_t i = order[k];
+      if (!cached.empty() && cached[i]) continue;
+
+      std::chrono::steady_clock::time_point nodeStart;
+      if (this->m_benchmarkMode) {
+        nodeStart = std::chrono::steady_clock::now();
+      }
+
+      Point p(this->m_mesh->node(i)->x(), this->m_mesh->node(i)->y());
+      Method m = static_cast<Method>(this->m_interpolationFlags[i]);
+      double v = this->defaultValue();
+      if (this->activateRasterForNode(i)) {
+        this->selectOverviewForNode(i, gridsize[i] * 0.5);
+        v = (this->*m_calculatePointPtr)(p, gridsize[i] * 0.5,
+                                         this->m_filterSize[i], m);
+      }
+      result[i] = v * this->m_rasterMultiplier + this->m_datumShift;
+
+      if (this->m_benchmarkMode && static_cast<size_t>(m) < c_numMethods) {
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - nodeStart;
+        benchCount[threadIndex()][m]++;
+        benchTime[threadIndex()][m] += elapsed.count();
+      }
     }
+    monitor->increment(batches[b].second - batches[b].first);
+  }
+  this->finishProgress();
+  this->rethrowRasterError();
+
+  if (this->m_benchmarkMode) {
+    std::chrono::duration<double> wall =
+        std::chrono::steady_clock::now() - wallStart;
+    this->reportBenchmark(benchCount, benchTime, wall.count());
+  }
+
+  this->closeRasterStack();
 
-    Point p(this->m_mesh->node(i)->x(), this->m_mesh->node(i)->y());
-    Method m = static_cast<Method>(this->m_interpolationFlags[i]);
-    double v = (this->*m_calculatePointPtr)(p, gridsize[i] * 0.5,
-                                            this->m_filterSize[i], m);
-    result[i] = v * this->m_rasterMultiplier + this->m_datumShift;
+  if (!this->m_cacheFile.empty()) {
+    this->writeCachedValues(key, gridsize, positionHash, result);
   }
 
   return result;
 }
 
+/**
+ * @brief Computes a checksum identifying the rasters used for interpolation
+ * @return checksum string
+ *
+ * Hashing the full contents of large rasters on every run would cost as much
+ * as the interpolation the cache is meant to avoid. Instead, each raster is
+ * identified by its file size and modification time, its georeferencing,
+ * dimensions and data type, and a few blocks sampled evenly through the file
+ */
+std::string GriddataPrivate::rasterChecksum() const {
+  Adcirc::Cryptography::Hash h(Adcirc::Cryptography::AdcmodXXH64);
+  std::string buffer(c_checksumSampleSize, 0);
+  for (const auto &f : this->rasterFiles()) {
+    struct stat st;
+    std::ifstream fid(f, std::ios::binary);
+    if (!fid.is_open() || stat(f.c_str(), &st) != 0) {
+      adcircmodules_throw_exception("Griddata: Could not open raster file " +
+                                    f);
+    }
+    const uint64_t fileSize = static_cast<uint64_t>(st.st_size);
+    h.addData(boost::str(boost::format("%s %i %i") % f % fileSize %
+                         static_cast<int64_t>(st.st_mtime)));
+
+    Adcirc::Raster::Rasterdata r(f);
+    if (!r.open()) {
+      adcircmodules_throw_exception("Griddata: Could not open raster file " +
+                                    f);
+    }
+    h.addData(boost::str(
+        boost::format("%i %i %0.12e %0.12e %0.12e %0.12e %i %0.12e %i %s") %
+        r.nx() % r.ny() % r.xmin() % r.ymax() % r.dx() % r.dy() %
+        r.rasterType() % r.nodata<double>() % r.nodata<int>() %
+        r.projectionString()));
+    r.close();
+
+    const uint64_t span =
+        fileSize > c_checksumSampleSize ? fileSize - c_checksumSampleSize : 0;
+    for (size_t k = 0; k < c_checksumSamples; ++k) {
+      const uint64_t offset = span * k / (c_checksumSamples - 1);
+      fid.seekg(static_cast<std::streamoff>(offset));
+      fid.read(&buffer[0], c_checksumSampleSize);
+      const std::streamsize n = fid.gcount();
+      fid.clear();
+      if (n > 0) h.addData(buffer.substr(0, static_cast<size_t>(n)));
+    }
+  }
+  std::unique_ptr<char[]> digest(h.getHash());
+  return std::string(digest.get());
+}
+
+/**
+ * @brief Generates the key that identifies a result cache. The key changes
+ * whenever the raster or any setting that affects every node changes
+ * @param useLookupTable true if a lookup table is used
+ * @return cache key
+ */
+std::string GriddataPrivate::cacheKey(bool useLookupTable) const {
+  Adcirc::Cryptography::Hash h(Adcirc::Cryptography::AdcmodXXH64);
+  h.addData(this->rasterChecksum());
+  h.addData(boost::str(
+      boost::format("%i %i %i %i %0.12e %0.12e %0.12e %0.12e %i %i %0.12e") %
+      this->m_epsg % useLookupTable % this->m_rasterInMemory %
+      static_cast<int>(this->m_thresholdMethod) % this->m_thresholdValue %
+      this->m_defaultValue % this->m_rasterMultiplier % this->m_datumShift %
+      this->m_raster.get()->rasterType() % this->m_useOverviews %
+      this->m_overviewTolerance));
+  if (useLookupTable) {
+    for (int k = this->m_lookup.minimumKey(); k <= this->m_lookup.maximumKey();
+         ++k) {
+      double v;
+      if (this->m_lookup.value(k, v)) {
+        h.addData(boost::str(boost::format("%i %0.12e") % k % v));
+      }
+    }
+  }
+  std::unique_ptr<char[]> digest(h.getHash());
+  return std::string(digest.get());
+}
+
+/**
+ * @brief Reads the result cache and determines which nodes can be reused
+ * @param key cache key for the current settings
+ * @param gridsize mesh size around each node
+ * @param positionHash position key of each node
+ * @param cached set to 1 for nodes whose value was taken from the cache
+ * @param result values for the cached nodes
+ * @return number of nodes taken from the cache
+ */
+size_t GriddataPrivate::readCachedValues(const std::string &key,
+                                         const std::vector<double> &gridsize,
+                                         std::vector<uint64_t> &positionHash,
+                                         std::vector<char> &cached,
+                                         std::vector<double> &result) {
+  const size_t nn = this->m_mesh->numNodes();
+  positionHash.resize(nn);
+  cached.assign(nn, 0);
+
+#pragma omp parallel for schedule(static) default(none) shared(positionHash)
+  for (signed long long i = 0;
+       i < static_cast<signed long long>(this->m_mesh->numNodes()); ++i) {
+    positionHash[i] = positionKey(this->m_mesh->node(i));
+  }
+
+  GriddataCache cache;
+  if (!cache.read(this->m_cacheFile, key)) return 0;
+
+  size_t n = 0;
+  for (size_t i = 0; i < nn; ++i) {
+    double v;
+    if (cache.find(positionHash[i], this->m_interpolationFlags[i],
+                   this->m_filterSize[i], gridsize[i], v)) {
+      result[i] = v;
+      cached[i] = 1;
+      n++;
+    }
+  }
+
+  Adcirc::Logging::log(boost::str(
+      boost::format("Griddata: Reusing %i of %i nodes from cache, %i nodes "
+                    "will be recomputed") %
+      n % nn % (nn - n)));
+  return n;
+}
+
+/**
+ * @brief Writes the values for all nodes to the result cache
+ * @param key cache key for the current settings
+ * @param gridsize mesh size around each node
+ * @param positionHash position key of each node
+ * @param result interpolated values
+ */
+void GriddataPrivate::writeCachedValues(
+    const std::string &key, const std::vector<double> &gridsize,
+    const std::vector<uint64_t> &positionHash,
+    const std::vector<double> &result) {
+  GriddataCache cache;
+  for (size_t i = 0; i < this->m_mesh->numNodes(); ++i) {
+    cache.add(positionHash[i], this->m_interpolationFlags[i],
+              this->m_filterSize[i], gridsize[i], result[i]);
+  }
+  cache.write(this->m_cacheFile, key);
+}
+
 template <typename T>
-void GriddataPrivate::thresholdData(std::vector<T> &z, std::vector<bool> &v) {
+void GriddataPrivate::thresholdData(std::vector<T> &z,
+                                    std::vector<uint8_t> &v) {
   if (std::is_same<T, int>::value)
     adcircmodules_throw_exception(
         "Cannot use thresholding and integer rasters");
@@ -938,7 +1478,6 @@ void GriddataPrivate::thresholdData(std::vector<T> &z, std::vector<bool> &v) {
 
 std::vector<std::vector<double>>
 GriddataPrivate::computeDirectionalWindReduction(bool useLookupTable) {
-  std::unique_ptr<boost::progress_display> progress(nullptr);
   this->checkRasterOpen();
   this->checkMatchingCoorindateSystems();
   this->assignDirectionalWindReductionFunctionPointer(useLookupTable);
@@ -950,27 +1489,524 @@ GriddataPrivate::computeDirectionalWindReduction(bool useLookupTable) {
   std::vector<std::vector<double>> result;
   result.resize(this->m_mesh->numNodes());
 
-  if (this->showProgressBar()) {
-    progress = std::unique_ptr<boost::progress_display>(
-        new boost::progress_display(this->m_mesh->numNodes()));
+  std::vector<double> radius;
+  this->assignRasters(
+      [&](size_t i) {
+        return this->m_interpolationFlags[i] != NoMethod ? this->windRadius()
+                                                         : 0.0;
+      },
+      radius);
+
+  std::vector<size_t> order;
+  std::vector<NodeBatch> batches;
+  this->buildSpatialSchedule(radius, order, batches);
+
+  auto wallStart = std::chrono::steady_clock::now();
+
+  Adcirc::ProgressMonitor *monitor = this->progressMonitor();
+  monitor->begin(this->m_mesh->numNodes());
+
+#pragma omp parallel for schedule(dynamic, 1) default(none) \
+    shared(monitor, result, order, batches)
+  for (signed long long b = 0; b < static_cast<signed long long>(batches.size());
+       ++b) {
+    if (monitor->isCancelled()) continue;
+    for (size_t k = batches[b].first; k < batches[b].second; ++k) {
+      const size_t i = order[k];
+      if (this->m_interpolationFlags[i] != NoMethod &&
+          this->activateRasterForNode(i)) {
+        Point p(this->m_mesh->node(i)->x(), this->m_mesh->node(i)->y());
+        result[i] = (this->*m_calculateDwindPtr)(p);
+      } else {
+        result[i] = std::vector<double>(12, this->defaultValue());
+      }
+    }
+    monitor->increment(batches[b].second - batches[b].first);
+  }
+  this->finishProgress();
+  this->rethrowRasterError();
+
+  if (this->m_benchmarkMode) {
+    std::chrono::duration<double> wall =
+        std::chrono::steady_clock::now() - wallStart;
+    Adcirc::Logging::log(boost::str(
+        boost::format("Griddata benchmark: directional wind reduction for %i "
+                      "nodes in %0.4f seconds, %0.2f nodes/s") %
+        this->m_mesh->numNodes() % wall.count() %
+        (wall.count() > 0.0
+             ? static_cast<double>(this->m_mesh->numNodes()) / wall.count()
+             : 0.0)));
   }
 
-#pragma omp parallel for schedule(dynamic) default(none) \
-    shared(progress, result)
-  for (unsigned long long i = 0;
-       i < static_cast<unsigned long long>(this->m_mesh->numNodes()); ++i) {
-    if (this->m_showProgressBar) {
-#pragma omp critical
-      ++(*progress);
+  this->closeRasterStack();
+  return result;
+}
+
+size_t GriddataPrivate::addAttributeJob(const std::string &attributeName,
+                                        int method,
+                                        const std::string &lookupTableFile,
+                                        double defaultValue,
+                                        const std::string &units) {
+  AttributeJob job;
+  job.name = attributeName;
+  job.units = units;
+  job.method = static_cast<Interpolation::Method>(method);
+  job.directionalWind = false;
+  job.defaultValue = defaultValue;
+  job.useLookupTable = !lookupTableFile.empty();
+  if (job.useLookupTable) {
+    GriddataPrivate::parseLookupTable(lookupTableFile, job.lookup);
+  }
+  this->m_jobs.push_back(job);
+  return this->m_jobs.size() - 1;
+}
+
+size_t GriddataPrivate::addDirectionalWindJob(
+    const std::string &attributeName, const std::string &lookupTableFile,
+    double defaultValue, const std::string &units) {
+  size_t index = this->addAttributeJob(attributeName, Average, lookupTableFile,
+                                       defaultValue, units);
+  this->m_jobs[index].directionalWind = true;
+  return index;
+}
+
+size_t GriddataPrivate::numAttributeJobs() const { return this->m_jobs.size(); }
+
+void GriddataPrivate::clearAttributeJobs() { this->m_jobs.clear(); }
+
+template <typename T>
+bool GriddataPrivate::readPixelWindow(Point &p, double radius,
+                                      PixelWindow &window) {
+  Adcirc::Raster::Pixel ul, lr;
+  this->raster()->searchBoxAroundPoint(p.first, p.second, radius, ul,
+                                             lr);
+  if (!ul.isValid() || !lr.isValid()) return false;
+
+  window.ibegin = ul.i();
+  window.jbegin = ul.j();
+  window.nx = lr.i() - ul.i() + 1;
+  window.ny = lr.j() - ul.j() + 1;
+  const size_t n = window.nx * window.ny;
+
+  std::vector<T> z(n);
+  window.x.resize(n);
+  window.y.resize(n);
+  this->raster()->pixelValues<T>(ul.i(), ul.j(), lr.i(), lr.j(),
+                                       window.x, window.y, z);
+
+  const T nodata = this->raster()->nodata<T>();
+  window.z.resize(n);
+  window.valid.resize(n);
+  window.distance.resize(n);
+  for (size_t k = 0; k < n; ++k) {
+    window.z[k] = static_cast<double>(z[k]);
+    window.valid[k] = z[k] != nodata;
+    window.distance[k] = Constants::distance(p, window.x[k], window.y[k]);
+  }
+  return true;
+}
+
+void GriddataPrivate::classifyWindow(const PixelWindow &window,
+                                     const DenseLookupTable *lookup,
+                                     std::vector<double> &z,
+                                     std::vector<uint8_t> &valid) {
+  if (lookup != nullptr) {
+    lookup->classify(window.z, window.valid, z, valid);
+  } else {
+    z = window.z;
+    valid = window.valid;
+    if (this->thresholdMethod() != Interpolation::Threshold::NoThreshold) {
+      this->thresholdData(z, valid);
+    }
+  }
+}
+
+/**
+ * @brief Visits the valid pixels of a window that fall within a radius of a
+ * point, in the same order they would be read for that radius alone
+ */
+template <typename F>
+void GriddataPrivate::forEachPixelInRadius(Point &p, double w,
+                                           const PixelWindow &window,
+                                           const std::vector<uint8_t> &valid,
+                                           F f) {
+  Adcirc::Raster::Pixel ul, lr;
+  this->raster()->searchBoxAroundPoint(p.first, p.second, w, ul, lr);
+  if (!ul.isValid() || !lr.isValid()) return;
+
+  const size_t i0 = std::max(ul.i(), window.ibegin);
+  const size_t j0 = std::max(ul.j(), window.jbegin);
+  const size_t i1 = std::min(lr.i(), window.ibegin + window.nx - 1);
+  const size_t j1 = std::min(lr.j(), window.jbegin + window.ny - 1);
+
+  for (size_t j = j0; j <= j1; ++j) {
+    size_t k = (j - window.jbegin) * window.nx + (i0 - window.ibegin);
+    for (size_t i = i0; i <= i1; ++i, ++k) {
+      if (valid[k] && window.distance[k] <= w) {
+        if (!f(k)) return;
+      }
+    }
+  }
+}
+
+double GriddataPrivate::reduceWindow(Point &p, double searchRadius,
+                                     double gsMultiplier,
+                                     Interpolation::Method method,
+                                     const PixelWindow &window,
+                                     const std::vector<double> &z,
+                                     const std::vector<uint8_t> &valid) {
+  switch (method) {
+    case Average:
+      return this->reduceAverage(p, searchRadius * gsMultiplier, window, z,
+                                 valid);
+    case Nearest:
+      return this->reduceNearest(p, searchRadius * gsMultiplier, window, z,
+                                 valid);
+    case Highest:
+      return this->reduceHighest(p, searchRadius * gsMultiplier, window, z,
+                                 valid);
+    case PlusTwoSigma:
+      return this->reduceOutsideStandardDeviation(
+          p, searchRadius * gsMultiplier, 2, window, z, valid);
+    case BilskieEtAll: {
+      double r;
+      if (this->calculateBilskieRadius(searchRadius,
+                                       this->raster()->dx(), r)) {
+        return this->reduceAverage(p, r * gsMultiplier, window, z, valid);
+      } else {
+        return this->reduceNearest(p, searchRadius * gsMultiplier, window, z,
+                                   valid);
+      }
+    }
+    case InverseDistanceWeighted:
+      return this->reduceInverseDistanceWeighted(
+          p, searchRadius * gsMultiplier, window, z, valid);
+    case InverseDistanceWeightedNPoints:
+      return this->reduceInverseDistanceWeightedNPoints(p, gsMultiplier,
+                                                        window, z, valid);
+    case AverageNearestNPoints:
+      return this->reduceAverageNearestN(p, gsMultiplier, window, z, valid);
+    default:
+      return this->defaultValue();
+  }
+}
+
+double GriddataPrivate::reduceAverage(Point &p, double w,
+                                      const PixelWindow &window,
+                                      const std::vector<double> &z,
+                                      const std::vector<uint8_t> &valid) {
+  double a = 0.0;
+  size_t n = 0;
+  this->forEachPixelInRadius(p, w, window, valid, [&](size_t k) {
+    a += z[k];
+    n++;
+    return true;
+  });
+  return n > 0 ? a / static_cast<double>(n) : this->defaultValue();
+}
+
+double GriddataPrivate::reduceNearest(Point &p, double w,
+                                      const PixelWindow &window,
+                                      const std::vector<double> &z,
+                                      const std::vector<uint8_t> &valid) {
+  Adcirc::Raster::Pixel px = this->raster()->coordinateToPixel(p);
+  if (!px.isValid()) return this->defaultValue();
+  Point pxloc = this->raster()->pixelToCoordinate(px);
+  if (Constants::distance(p, pxloc) > w) return this->defaultValue();
+  if (px.i() < window.ibegin || px.j() < window.jbegin ||
+      px.i() >= window.ibegin + window.nx ||
+      px.j() >= window.jbegin + window.ny) {
+    return this->defaultValue();
+  }
+  size_t k = (px.j() - window.jbegin) * window.nx + (px.i() - window.ibegin);
+  return valid[k] ? z[k] : this->defaultValue();
+}
+
+double GriddataPrivate::reduceHighest(Point &p, double w,
+                                      const PixelWindow &window,
+                                      const std::vector<double> &z,
+                                      const std::vector<uint8_t> &valid) {
+  double zm = -std::numeric_limits<double>::max();
+  bool found = false;
+  this->forEachPixelInRadius(p, w, window, valid, [&](size_t k) {
+    zm = std::max(zm, z[k]);
+    found = true;
+    return true;
+  });
+  return found ? zm : this->defaultValue();
+}
+
+double GriddataPrivate::reduceOutsideStandardDeviation(
+    Point &p, double w, int n, const PixelWindow &window,
+    const std::vector<double> &z, const std::vector<uint8_t> &valid) {
+  std::vector<double> z2;
+  this->forEachPixelInRadius(p, w, window, valid, [&](size_t k) {
+    z2.push_back(z[k]);
+    return true;
+  });
+  if (z2.empty()) return this->defaultValue();
+
+  double mean = std::accumulate(z2.begin(), z2.end(), 0.0) / z2.size();
+  double stddev = std::sqrt(
+      std::inner_product(z2.begin(), z2.end(), z2.begin(), 0.0) / z2.size() -
+      (mean * mean));
+  double cutoff = mean + n * stddev;
+  double a = 0.0;
+  size_t np = 0;
+  for (auto v : z2) {
+    if (v >= cutoff) {
+      a += v;
+      np++;
     }
+  }
+  return np > 0 ? a / static_cast<double>(np)
+                : this->reduceAverage(p, w, window, z, valid);
+}
+
+double GriddataPrivate::reduceInverseDistanceWeighted(
+    Point &p, double w, const PixelWindow &window, const std::vector<double> &z,
+    const std::vector<uint8_t> &valid) {
+  double n = 0.0;
+  double d = 0.0;
+  size_t num = 0;
+  this->forEachPixelInRadius(p, w, window, valid, [&](size_t k) {
+    n += z[k] / window.distance[k];
+    d += 1.0 / window.distance[k];
+    num++;
+    return true;
+  });
+  return num > 0 ? n / d : this->defaultValue();
+}
+
+double GriddataPrivate::reduceInverseDistanceWeightedNPoints(
+    Point &p, double n, const PixelWindow &window, const std::vector<double> &z,
+    const std::vector<uint8_t> &valid) {
+  size_t maxPoints = static_cast<size_t>(n);
+  double w = this->calculateExpansionLevelForPoints(maxPoints);
+  double val = 0.0;
+  double d = 0.0;
+  size_t np = 0;
+  this->forEachPixelInRadius(p, w, window, valid, [&](size_t k) {
+    val += z[k] / window.distance[k];
+    d += 1.0 / window.distance[k];
+    np++;
+    return np < maxPoints;
+  });
+  return np > 0 ? val / d : this->defaultValue();
+}
+
+double GriddataPrivate::reduceAverageNearestN(
+    Point &p, double n, const PixelWindow &window, const std::vector<double> &z,
+    const std::vector<uint8_t> &valid) {
+  size_t maxPoints = static_cast<size_t>(n);
+  double w = this->calculateExpansionLevelForPoints(maxPoints);
+  std::vector<Point> pts;
+  this->forEachPixelInRadius(p, w, window, valid, [&](size_t k) {
+    pts.push_back(Point(window.distance[k], z[k]));
+    return true;
+  });
+  if (pts.empty()) return this->defaultValue();
+
+  size_t np = std::min(pts.size(), maxPoints);
+  std::partial_sort(pts.begin(), pts.begin() + np, pts.end(),
+                    sortPointsByIncreasingDistance);
+  double val = 0.0;
+  for (size_t i = 0; i < np; i++) {
+    val += pts[i].second;
+  }
+  return val / static_cast<double>(np);
+}
+
+std::vector<double> GriddataPrivate::reduceDirectionalWind(
+    Point &p, const PixelWindow &window, const std::vector<double> &z,
+    const std::vector<uint8_t> &valid) {
+  double nearWeight = 0.0;
+  std::vector<double> wind(12, 0.0), weight(12, 0.0);
+
+  this->forEachPixelInRadius(
+      p, this->windRadius(), window, valid, [&](size_t k) {
+        double w = 0.0;
+        int dir = 0;
+        if (this->computeWindDirectionAndWeight(p, window.x[k], window.y[k], w,
+                                                dir)) {
+          weight[dir] += w;
+          wind[dir] += w * z[k];
+        } else {
+          nearWeight += w;
+        }
+        return true;
+      });
+
+  this->computeWeightedDirectionalWindValues(weight, wind, nearWeight);
+  return wind;
+}
+
+/**
+ * @brief Computes every queued attribute job in a single pass over the mesh
+ * @param nodalAttributes object that receives the computed attributes
+ *
+ * For each node, the raster window large enough to satisfy every job is read
+ * once and then each job classifies and reduces that same window.
+ */
+void GriddataPrivate::computeAttributes(
+    Adcirc::ModelParameters::NodalAttributes *nodalAttributes) {
+  if (this->m_jobs.empty()) {
+    adcircmodules_throw_exception("Griddata: No attribute jobs defined.");
+  }
+  if (nodalAttributes == nullptr) {
+    adcircmodules_throw_exception("Griddata: Nodal attributes not allocated.");
+  }
+
+  this->checkRasterOpen();
+  this->checkMatchingCoorindateSystems();
+
+  if (this->thresholdMethod() != Interpolation::Threshold::NoThreshold) {
+    for (const auto &j : this->m_jobs) {
+      if (j.useLookupTable) {
+        adcircmodules_throw_exception(
+            "Cannot use thresholding and integer rasters");
+      }
+    }
+  }
+
+  if (this->m_rasterInMemory) {
+    this->m_raster.get()->read();
+  }
+
+  const size_t nn = this->m_mesh->numNodes();
+  std::vector<double> gridsize = this->m_mesh->computeMeshSize();
+
+  std::vector<double> radius;
+  this->assignRasters(
+      [&](size_t i) {
+        double rmax = 0.0;
+        if (this->m_interpolationFlags[i] == NoMethod) return rmax;
+        for (const auto &j : this->m_jobs) {
+          double r = j.directionalWind
+                         ? this->windRadius()
+                         : this->searchRadius(j.method, gridsize[i] * 0.5,
+                                              this->m_filterSize[i]);
+          rmax = std::max(rmax, r);
+        }
+        return rmax;
+      },
+      radius);
+
+  std::vector<size_t> order;
+  std::vector<NodeBatch> batches;
+  this->buildSpatialSchedule(radius, order, batches);
+
+  std::vector<std::vector<double>> values(this->m_jobs.size());
+  for (size_t j = 0; j < this->m_jobs.size(); ++j) {
+    size_t nv = this->m_jobs[j].directionalWind ? 12 : 1;
+    values[j].resize(nn * nv, this->m_jobs[j].defaultValue);
+  }
+
+  Adcirc::ProgressMonitor *monitor = this->progressMonitor();
+  monitor->begin(nn);
+
+#pragma omp parallel for schedule(dynamic, 1) default(none) \
+    shared(monitor, gridsize, radius, order, batches, values)
+  for (signed long long b = 0; b < static_cast<signed long long>(batches.size());
+       ++b) {
+    if (monitor->isCancelled()) continue;
+    PixelWindow window;
+    std::vector<double> z;
+    std::vector<uint8_t> valid;
+
+    for (size_t k = batches[b].first; k < batches[b].second; ++k) {
+      const size_t i = order[k];
+      const bool active = this->m_interpolationFlags[i] != NoMethod &&
+                          this->activateRasterForNode(i);
 
-    if (this->m_interpolationFlags[i] != NoMethod) {
       Point p(this->m_mesh->node(i)->x(), this->m_mesh->node(i)->y());
-      result[i] = (this->*m_calculateDwindPtr)(p);
-    } else {
-      result[i] = std::vector<double>(12, this->defaultValue());
+      bool ok = false;
+      if (active) {
+        const bool integerRaster = this->raster()->rasterType() !=
+                                   Adcirc::Raster::Rasterdata::Double;
+        ok = integerRaster
+                 ? this->readPixelWindow<int>(p, radius[i], window)
+                 : this->readPixelWindow<double>(p, radius[i], window);
+      }
+
+      //...Post processing matches computeValuesFromRaster and
+      //   computeDirectionalWindReduction, with the job default taking the
+      //   place of the Griddata default value
+      for (size_t j = 0; j < this->m_jobs.size(); ++j) {
+        const AttributeJob &job = this->m_jobs[j];
+        if (job.directionalWind) {
+          auto out = values[j].begin() + i * 12;
+          if (!active) {
+            std::fill(out, out + 12, job.defaultValue);
+          } else if (!ok) {
+            std::fill(out, out + 12, 0.0);
+          } else {
+            this->classifyWindow(
+                window, job.useLookupTable ? &job.lookup : nullptr, z, valid);
+            std::vector<double> w =
+                this->reduceDirectionalWind(p, window, z, valid);
+            std::copy(w.begin(), w.end(), out);
+          }
+        } else {
+          double v = this->defaultValue();
+          if (ok) {
+            this->classifyWindow(
+                window, job.useLookupTable ? &job.lookup : nullptr, z, valid);
+            v = this->reduceWindow(p, gridsize[i] * 0.5,
+                                   this->m_filterSize[i], job.method, window,
+                                   z, valid);
+          }
+          if (v == this->defaultValue()) v = job.defaultValue;
+          values[j][i] = v * this->m_rasterMultiplier + this->m_datumShift;
+        }
+      }
     }
+    monitor->increment(batches[b].second - batches[b].first);
   }
+  this->finishProgress();
+  this->rethrowRasterError();
 
-  return result;
+  this->closeRasterStack();
+
+  if (nodalAttributes->numNodes() == 0) {
+    nodalAttributes->setMesh(this->m_mesh);
+    nodalAttributes->setNumNodes(nn);
+  } else if (nodalAttributes->numNodes() != nn) {
+    adcircmodules_throw_exception(
+        "Griddata: Number of nodes does not match the nodal attributes.");
+  }
+
+  for (size_t j = 0; j < this->m_jobs.size(); ++j) {
+    const AttributeJob &job = this->m_jobs[j];
+    const size_t nv = job.directionalWind ? 12 : 1;
+
+    size_t index = adcircmodules_default_value<size_t>();
+    for (size_t k = 0; k < nodalAttributes->numParameters(); ++k) {
+      if (nodalAttributes->attributeNames(k) == job.name) {
+        index = k;
+        break;
+      }
+    }
+
+    if (index == adcircmodules_default_value<size_t>()) {
+      Adcirc::ModelParameters::AttributeMetadata metadata(job.name, job.units,
+                                                          nv);
+      metadata.setDefaultValue(job.defaultValue);
+      nodalAttributes->addAttribute(metadata, values[j]);
+    } else {
+      if (nodalAttributes->metadata(index)->numberOfValues() != nv) {
+        adcircmodules_throw_exception(
+            "Griddata: Existing nodal attribute has a different number of "
+            "values.");
+      }
+      for (size_t i = 0; i < nn; ++i) {
+        Adcirc::ModelParameters::Attribute a =
+            nodalAttributes->attribute(index, i);
+        for (size_t v = 0; v < nv; ++v) {
+          a.setValue(v, values[j][i * nv + v]);
+        }
+      }
+    }
+  }
+  return;
 }
@@ -20,13 +20,17 @@
 #define ADCMOD_GRIDDATAPRIVATE_H
 
 #include <cmath>
+#include <cstdint>
+#include <exception>
 #include <memory>
 #include <string>
 #include <utility>
-#include "adcmap.h"
 #include "constants.h"
+#include "denselookuptable.h"
 #include "interpolationmethods.h"
 #include "mesh.h"
+#include "nodalattributes.h"
+#include "progressmonitor.h"
 #include "rasterdata.h"
 
 namespace Adcirc {
@@ -42,6 +46,11 @@ class GriddataPrivate {
   std::string rasterFile() const;
   void setRasterFile(const std::string &rasterFile);
 
+  void addRasterFile(const std::string &rasterFile);
+  std::vector<std::string> rasterFiles() const;
+  void clearRasterFiles();
+  std::vector<int> nodeRasterIndices() const;
+
   void readLookupTable(const std::string &lookupTableFile);
 
   std::vector<int> interpolationFlags() const;
@@ -63,12 +72,27 @@ class GriddataPrivate {
   std::vector<std::vector<double>> computeDirectionalWindReduction(
       bool useLookupTable = false);
 
+  size_t addAttributeJob(const std::string &attributeName, int method,
+                         const std::string &lookupTableFile,
+                         double defaultValue, const std::string &units);
+  size_t addDirectionalWindJob(const std::string &attributeName,
+                               const std::string &lookupTableFile,
+                               double defaultValue, const std::string &units);
+  size_t numAttributeJobs() const;
+  void clearAttributeJobs();
+  void computeAttributes(
+      Adcirc::ModelParameters::NodalAttributes *nodalAttributes);
+
   int epsg() const;
   void setEpsg(int epsg);
 
   bool showProgressBar() const;
   void setShowProgressBar(bool showProgressBar);
 
+  Adcirc::ProgressMonitor *progressMonitor();
+  void setProgressMonitor(Adcirc::ProgressMonitor *monitor);
+  void finishProgress();
+
   double rasterMultiplier() const;
   void setRasterMultiplier(double rasterMultiplier);
 
@@ -89,8 +113,42 @@ class GriddataPrivate {
 
   std::vector<double> extents() const;
 
+  bool benchmarkMode() const;
+  void setBenchmarkMode(bool benchmarkMode);
+
+  std::string cacheFile() const;
+  void setCacheFile(const std::string &cacheFile);
+
+  bool useOverviews() const;
+  void setUseOverviews(bool useOverviews);
+
+  double overviewTolerance() const;
+  void setOverviewTolerance(double overviewTolerance);
+
  private:
-  bool getKeyValue(unsigned short key, double &value);
+  /// Group of consecutive entries in the spatially sorted node list
+  using NodeBatch = std::pair<size_t, size_t>;
+
+  /// Attribute generated during a single pass batch interpolation
+  struct AttributeJob {
+    std::string name;
+    std::string units;
+    Interpolation::Method method;
+    bool directionalWind;
+    bool useLookupTable;
+    double defaultValue;
+    DenseLookupTable lookup;
+  };
+
+  /// Block of raster pixels read once and shared between computations
+  struct PixelWindow {
+    size_t ibegin, jbegin, nx, ny;
+    std::vector<double> x, y, z, distance;
+    std::vector<uint8_t> valid;
+  };
+
+  static void parseLookupTable(const std::string &lookupTableFile,
+                               DenseLookupTable &table);
 
   double calculatePoint(Point &p, double searchRadius, double gsMultiplier,
                         Interpolation::Method method);
@@ -105,15 +163,6 @@ class GriddataPrivate {
 
   double calculatePointFromLookup(Point &p, double w, double gsMultiplier,
                                   Interpolation::Method method);
-  double calculateAverageFromLookup(Point &p, double w);
-  double calculateNearestFromLookup(Point &p, double w);
-  double calculateHighestFromLookup(Point &p, double w);
-  double calculateOutsideStandardDeviationFromLookup(Point &p, double w, int n);
-  double calculateBilskieAveragingFromLookup(Point &p, double w,
-                                             double gsMultiplier);
-  double calculateInverseDistanceWeightedFromLookup(Point &p, double w);
-  double calculateInverseDistanceWeightedNPointsFromLookup(Point &p, double n);
-  double calculateAverageNearestNFromLookup(Point &p, double n);
 
   double (GriddataPrivate::*m_calculatePointPtr)(Point &p, double w,
                                                  double gsMultiplier,
@@ -127,10 +176,10 @@ class GriddataPrivate {
   template <typename T>
   bool pixelDataInRadius(Point &p, double radius, std::vector<double> &x,
                          std::vector<double> &y, std::vector<T> &z,
-                         std::vector<bool> &valid);
+                         std::vector<uint8_t> &valid);
 
   template <typename T>
-  void thresholdData(std::vector<T> &z, std::vector<bool> &v);
+  void thresholdData(std::vector<T> &z, std::vector<uint8_t> &v);
 
   std::vector<double> calculateDirectionalWindFromRaster(Point &p);
   std::vector<double> calculateDirectionalWindFromLookup(Point &p);
@@ -146,10 +195,83 @@ class GriddataPrivate {
 
   void checkMatchingCoorindateSystems();
   void checkRasterOpen();
+  void checkLookupTable();
   void assignDirectionalWindReductionFunctionPointer(bool useLookupTable);
   void assignInterpolationFunctionPointer(bool useLookupTable);
   double calculateExpansionLevelForPoints(size_t n);
 
+  double searchRadius(Interpolation::Method method, double meshSize,
+                      double gsMultiplier);
+  double searchRadiusForNode(size_t index, double meshSize);
+
+  template <typename T>
+  bool readPixelWindow(Point &p, double radius, PixelWindow &window);
+  void classifyWindow(const PixelWindow &window,
+                      const DenseLookupTable *lookup, std::vector<double> &z,
+                      std::vector<uint8_t> &valid);
+  double reduceWindow(Point &p, double searchRadius, double gsMultiplier,
+                      Interpolation::Method method, const PixelWindow &window,
+                      const std::vector<double> &z,
+                      const std::vector<uint8_t> &valid);
+  double reduceAverage(Point &p, double w, const PixelWindow &window,
+                       const std::vector<double> &z,
+                       const std::vector<uint8_t> &valid);
+  double reduceNearest(Point &p, double w, const PixelWindow &window,
+                       const std::vector<double> &z,
+                       const std::vector<uint8_t> &valid);
+  double reduceHighest(Point &p, double w, const PixelWindow &window,
+                       const std::vector<double> &z,
+                       const std::vector<uint8_t> &valid);
+  double reduceOutsideStandardDeviation(Point &p, double w, int n,
+                                        const PixelWindow &window,
+                                        const std::vector<double> &z,
+                                        const std::vector<uint8_t> &valid);
+  double reduceInverseDistanceWeighted(Point &p, double w,
+                                       const PixelWindow &window,
+                                       const std::vector<double> &z,
+                                       const std::vector<uint8_t> &valid);
+  double reduceInverseDistanceWeightedNPoints(
+      Point &p, double n, const PixelWindow &window,
+      const std::vector<double> &z, const std::vector<uint8_t> &valid);
+  double reduceAverageNearestN(Point &p, double n, const PixelWindow &window,
+                               const std::vector<double> &z,
+                               const std::vector<uint8_t> &valid);
+  std::vector<double> reduceDirectionalWind(Point &p,
+                                            const PixelWindow &window,
+                                            const std::vector<double> &z,
+                                            const std::vector<uint8_t> &valid);
+  template <typename F>
+  void forEachPixelInRadius(Point &p, double w, const PixelWindow &window,
+                            const std::vector<uint8_t> &valid, F f);
+  void buildSpatialSchedule(const std::vector<double> &radius,
+                            std::vector<size_t> &order,
+                            std::vector<NodeBatch> &batches);
+
+  Adcirc::Raster::Rasterdata *raster();
+  Adcirc::Raster::Rasterdata *threadRaster(size_t index);
+  void openRasterStack();
+  void closeRasterStack();
+  template <typename F>
+  void assignRasters(F radiusForNode, std::vector<double> &radius);
+  bool activateRasterForNode(size_t index);
+  void rethrowRasterError();
+  void selectOverviewForNode(size_t index, double meshSize);
+
+  std::string rasterChecksum() const;
+  std::string cacheKey(bool useLookupTable) const;
+  size_t readCachedValues(const std::string &key,
+                          const std::vector<double> &gridsize,
+                          std::vector<uint64_t> &positionHash,
+                          std::vector<char> &cached,
+                          std::vector<double> &result);
+  void writeCachedValues(const std::string &key,
+                         const std::vector<double> &gridsize,
+                         const std::vector<uint64_t> &positionHash,
+                         const std::vector<double> &result);
+  void reportBenchmark(const std::vector<std::vector<size_t>> &count,
+                       const std::vector<std::vector<double>> &time,
+                       double wallTime);
+
   std::vector<double> m_filterSize;
   double m_defaultValue;
   Adcirc::Geometry::Mesh *m_mesh;
@@ -157,7 +279,16 @@ class GriddataPrivate {
   std::string m_rasterFile;
   std::vector<int> m_interpolationFlags;
   int m_epsg;
-  Adcirc::adcmap<unsigned short, double> m_lookup;
+  DenseLookupTable m_lookup;
+  std::vector<AttributeJob> m_jobs;
+
+  std::vector<std::string> m_rasterStack;
+  std::vector<Adcirc::Raster::Rasterdata *> m_rasterStackInfo;
+  std::vector<std::vector<Adcirc::Raster::Rasterdata *>> m_threadRasters;
+  std::vector<std::unique_ptr<Adcirc::Raster::Rasterdata>> m_rasterPool;
+  std::exception_ptr m_rasterError;
+  std::vector<Adcirc::Raster::Rasterdata *> m_activeRaster;
+  std::vector<int> m_nodeRaster;
 
   Interpolation::Threshold m_thresholdMethod;
   double m_rasterMultiplier;
@@ -165,6 +296,12 @@ class GriddataPrivate {
   double m_thresholdValue;
   bool m_showProgressBar;
   bool m_rasterInMemory;
+  bool m_benchmarkMode;
+  bool m_useOverviews;
+  double m_overviewTolerance;
+  std::string m_cacheFile;
+  Adcirc::ProgressMonitor *m_progressMonitor;
+  std::unique_ptr<Adcirc::ProgressMonitor> m_defaultMonitor;
 };
 
 }  // namespace Private
@@ -0,0 +1,202 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "griddatacache.h"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#include "binaryio.h"
+#include "logging.h"
+
+using namespace Adcirc::Private;
+
+static const char c_magic[] = "ADCMOD_GRIDDATA_CACHE";
+
+GriddataCache::GriddataCache() = default;
+
+void GriddataCache::clear() {
+  this->m_entries.clear();
+  this->m_index.clear();
+}
+
+size_t GriddataCache::size() const { return this->m_entries.size(); }
+
+/**
+ * @brief Converts a hexadecimal hash string to a 64-bit key using the
+ * leading 16 characters
+ * @param hash hash string
+ * @return 64-bit key
+ */
+uint64_t GriddataCache::hashToKey(const std::string &hash) {
+  uint64_t k = 0;
+  for (size_t i = 0; i < std::min<size_t>(16, hash.size()); ++i) {
+    const char c = hash[i];
+    uint64_t v = 0;
+    if (c >= '0' && c <= '9') {
+      v = c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      v = c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      v = c - 'A' + 10;
+    }
+    k = (k << 4) | v;
+  }
+  return k;
+}
+
+void GriddataCache::add(uint64_t positionHash, int method, double filterSize,
+                        double meshSize, double value) {
+  this->m_index[positionHash] = this->m_entries.size();
+  this->m_entries.push_back(
+      Entry{positionHash, method, filterSize, meshSize, value});
+}
+
+bool GriddataCache::find(uint64_t positionHash, int method, double filterSize,
+                         double meshSize, double &value) const {
+  auto it = this->m_index.find(positionHash);
+  if (it == this->m_index.end()) return false;
+  const Entry &e = this->m_entries[it->second];
+  if (e.method != method) return false;
+  if (std::abs(e.filterSize - filterSize) >
+      c_tolerance * std::max(1.0, std::abs(filterSize))) {
+    return false;
+  }
+  if (std::abs(e.meshSize - meshSize) >
+      c_tolerance * std::max(1.0, std::abs(meshSize))) {
+    return false;
+  }
+  value = e.value;
+  return true;
+}
+
+/**
+ * @brief Reads a cache file
+ * @param filename name of the cache file
+ * @param key key describing the raster and interpolation parameters
+ * @return true if the file exists and was generated with the same key
+ */
+bool GriddataCache::read(const std::string &filename, const std::string &key) {
+  this->clear();
+
+  std::ifstream fid(filename, std::ios::binary);
+  if (!fid.is_open()) return false;
+
+  char magic[sizeof(c_magic)];
+  char header[sizeof(uint32_t) + sizeof(uint64_t)];
+  uint32_t version = 0;
+  uint64_t keyLength = 0, n = 0;
+  fid.read(magic, sizeof(c_magic));
+  fid.read(header, sizeof(header));
+  const char *pos = header;
+  BinaryIO::extract(pos, header + sizeof(header), version);
+  BinaryIO::extract(pos, header + sizeof(header), keyLength);
+  if (!fid || std::memcmp(magic, c_magic, sizeof(c_magic)) != 0 ||
+      version != c_version) {
+    Adcirc::Logging::warning("Griddata: Ignoring unrecognized cache file " +
+                             filename);
+    return false;
+  }
+
+  std::string fileKey(keyLength == key.size() ? keyLength : 0, ' ');
+  fid.read(&fileKey[0], fileKey.size());
+  if (!fid || fileKey != key) {
+    Adcirc::Logging::log(
+        "Griddata: Cache was generated with different raster or "
+        "interpolation parameters and will be rebuilt");
+    return false;
+  }
+
+  char count[sizeof(uint64_t)];
+  fid.read(count, sizeof(count));
+  pos = count;
+  BinaryIO::extract(pos, count + sizeof(count), n);
+
+  //...The remainder of the file must hold exactly n entries
+  const std::streamoff start = fid.tellg();
+  fid.seekg(0, std::ios::end);
+  const std::streamoff remaining = fid.tellg() - start;
+  fid.seekg(start);
+  if (!fid || remaining < 0 ||
+      static_cast<uint64_t>(remaining) != n * c_recordSize) {
+    Adcirc::Logging::warning("Griddata: Cache file " + filename +
+                             " is truncated and will be rebuilt");
+    return false;
+  }
+
+  std::vector<char> buffer(n * c_recordSize);
+  fid.read(buffer.data(), buffer.size());
+  if (!fid) {
+    Adcirc::Logging::warning("Griddata: Cache file " + filename +
+                             " is truncated and will be rebuilt");
+    return false;
+  }
+
+  this->m_entries.resize(n);
+  pos = buffer.data();
+  const char *end = pos + buffer.size();
+  for (auto &e : this->m_entries) {
+    int32_t method;
+    BinaryIO::extract(pos, end, e.positionHash);
+    BinaryIO::extract(pos, end, method);
+    BinaryIO::extract(pos, end, e.filterSize);
+    BinaryIO::extract(pos, end, e.meshSize);
+    BinaryIO::extract(pos, end, e.value);
+    e.method = method;
+  }
+
+  this->m_index.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    this->m_index[this->m_entries[i].positionHash] = i;
+  }
+  return true;
+}
+
+/**
+ * @brief Writes the cache to a file
+ * @param filename name of the cache file
+ * @param key key describing the raster and interpolation parameters
+ */
+void GriddataCache::write(const std::string &filename,
+                          const std::string &key) const {
+  std::ofstream fid(filename, std::ios::binary | std::ios::trunc);
+  if (!fid.is_open()) {
+    adcircmodules_throw_exception("Griddata: Could not open cache file " +
+                                  filename);
+  }
+
+  //...The header and entries are serialized field by field so that the file
+  //   does not depend on the padding of the Entry structure
+  const uint64_t n = this->m_entries.size();
+  std::vector<char> buffer(c_magic, c_magic + sizeof(c_magic));
+  buffer.reserve(buffer.size() + key.size() + 20 + n * c_recordSize);
+  BinaryIO::append(buffer, c_version);
+  BinaryIO::append(buffer, static_cast<uint64_t>(key.size()));
+  buffer.insert(buffer.end(), key.begin(), key.end());
+  BinaryIO::append(buffer, n);
+  for (const auto &e : this->m_entries) {
+    BinaryIO::append(buffer, e.positionHash);
+    BinaryIO::append(buffer, static_cast<int32_t>(e.method));
+    BinaryIO::append(buffer, e.filterSize);
+    BinaryIO::append(buffer, e.meshSize);
+    BinaryIO::append(buffer, e.value);
+  }
+  fid.write(buffer.data(), buffer.size());
+  fid.close();
+}
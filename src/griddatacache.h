@@ -0,0 +1,90 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_GRIDDATACACHE_H
+#define ADCMOD_GRIDDATACACHE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "adcircmodules_global.h"
+#include "adcmap.h"
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class GriddataCache
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Persistent store of interpolated nodal values used to avoid
+ * recomputing nodes that have not changed between runs
+ *
+ * The cache is identified by a key describing the raster and interpolation
+ * parameters. Each entry is identified by the position hash of the node and
+ * is only reused when the interpolation method, filter size and local mesh
+ * size for the node are unchanged.
+ */
+class GriddataCache {
+ public:
+  GriddataCache();
+
+  bool ADCIRCMODULES_EXPORT read(const std::string &filename,
+                                 const std::string &key);
+  void ADCIRCMODULES_EXPORT write(const std::string &filename,
+                                  const std::string &key) const;
+
+  void ADCIRCMODULES_EXPORT clear();
+  size_t ADCIRCMODULES_EXPORT size() const;
+
+  void ADCIRCMODULES_EXPORT add(uint64_t positionHash, int method,
+                                double filterSize, double meshSize,
+                                double value);
+
+  bool ADCIRCMODULES_EXPORT find(uint64_t positionHash, int method,
+                                 double filterSize, double meshSize,
+                                 double &value) const;
+
+  static uint64_t ADCIRCMODULES_EXPORT hashToKey(const std::string &hash);
+
+ private:
+  static constexpr uint32_t c_version = 2;
+
+  //...Size of an entry in the file: position hash, method, filter size,
+  //   mesh size and value
+  static constexpr size_t c_recordSize = 8 + 4 + 3 * 8;
+  static constexpr double c_tolerance = 1e-9;
+
+  struct Entry {
+    uint64_t positionHash;
+    int method;
+    double filterSize;
+    double meshSize;
+    double value;
+  };
+
+  std::vector<Entry> m_entries;
+  Adcirc::adcmap<uint64_t, size_t> m_index;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_GRIDDATACACHE_H
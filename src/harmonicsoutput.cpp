@@ -246,5 +246,66 @@ size_t HarmonicsOutput::nodeIdToArrayIndex(size_t id) {
  */
 int HarmonicsOutput::filetype() const { return this->m_impl->filetype(); }
 
+/**
+ * @brief Returns the memory used for each batch of times when streaming
+ * predictions to an output file
+ * @return buffer size in bytes
+ */
+size_t HarmonicsOutput::predictionBufferSize() const {
+  return this->m_impl->predictionBufferSize();
+}
+
+/**
+ * @brief Sets the memory used for each batch of times when streaming
+ * predictions to an output file. At least one time is always evaluated in
+ * each batch
+ * @param[in] bytes buffer size in bytes
+ */
+void HarmonicsOutput::setPredictionBufferSize(size_t bytes) {
+  this->m_impl->setPredictionBufferSize(bytes);
+}
+
+/**
+ * @brief Reconstructs the water level or velocity at all nodes from the
+ * harmonic constituents
+ * @param[in] time time in seconds since the harmonic analysis reference time
+ * @return output record containing the prediction
+ */
+Adcirc::Output::OutputRecord HarmonicsOutput::predict(double time) {
+  return this->m_impl->predict(time);
+}
+
+/**
+ * @brief Reconstructs the water level or velocity at all nodes for a range of
+ * times and writes each time as a record of an output file
+ * @param[in] writer open output file that receives the records
+ * @param[in] startTime first time, in seconds since the reference time
+ * @param[in] endTime last time, in seconds since the reference time
+ * @param[in] dt interval between predictions in seconds
+ *
+ * Times are evaluated in batches sized to bound memory use, so the full
+ * prediction is never held in memory at once
+ */
+void HarmonicsOutput::predict(Adcirc::Output::WriteOutput* writer,
+                              double startTime, double endTime, double dt) {
+  this->m_impl->predict(writer, startTime, endTime, dt);
+}
+
+/**
+ * @brief Reconstructs time series of water level or velocity at a set of nodes
+ * @param[in] nodes array positions of the nodes to predict
+ * @param[in] referenceDate date corresponding to time zero
+ * @param[in] startTime first time, in seconds since the reference date
+ * @param[in] endTime last time, in seconds since the reference date
+ * @param[in] dt interval between predictions in seconds
+ * @return Hmdf object with one station for each node
+ */
+Adcirc::Output::Hmdf HarmonicsOutput::predict(const std::vector<size_t>& nodes,
+                                              const Adcirc::CDate& referenceDate,
+                                              double startTime, double endTime,
+                                              double dt) {
+  return this->m_impl->predict(nodes, referenceDate, startTime, endTime, dt);
+}
+
 }  // namespace Harmonics
 }  // namespace Adcirc
@@ -3,15 +3,22 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 #include "adcircmodules_global.h"
+#include "cdate.h"
 #include "filetypes.h"
 #include "harmonicsrecord.h"
+#include "hmdf.h"
+#include "outputrecord.h"
 
 namespace Adcirc {
 namespace Private {
 // Forward declaration for pimpl class
 class HarmonicsOutputPrivate;
 }  // namespace Private
+namespace Output {
+class WriteOutput;
+}
 namespace Harmonics {
 
 /**
@@ -95,6 +102,20 @@ class HarmonicsOutput {
 
   int ADCIRCMODULES_EXPORT filetype() const;
 
+  size_t ADCIRCMODULES_EXPORT predictionBufferSize() const;
+
+  void ADCIRCMODULES_EXPORT setPredictionBufferSize(size_t bytes);
+
+  Adcirc::Output::OutputRecord ADCIRCMODULES_EXPORT predict(double time);
+
+  void ADCIRCMODULES_EXPORT predict(Adcirc::Output::WriteOutput* writer,
+                                    double startTime, double endTime,
+                                    double dt);
+
+  Adcirc::Output::Hmdf ADCIRCMODULES_EXPORT
+  predict(const std::vector<size_t>& nodes, const Adcirc::CDate& referenceDate,
+          double startTime, double endTime, double dt);
+
  private:
   std::unique_ptr<Adcirc::Private::HarmonicsOutputPrivate> m_impl;
 };
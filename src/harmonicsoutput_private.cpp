@@ -18,7 +18,9 @@
 //------------------------------------------------------------------------*/
 #include "harmonicsoutput_private.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -26,6 +28,7 @@
 
 #include "boost/algorithm/string.hpp"
 #include "boost/format.hpp"
+#include "adcirc_outputfiles.h"
 #include "default_values.h"
 #include "fileio.h"
 #include "filetypes.h"
@@ -33,16 +36,85 @@
 #include "logging.h"
 #include "netcdf.h"
 #include "stringconversion.h"
+#include "writeoutput.h"
 
 using namespace Adcirc::Harmonics;
 using namespace Adcirc::Private;
 
+namespace {
+/// Number of values read or written in each node x constituent block
+constexpr size_t c_netcdfBlockSize = 2097152;
+
+/// Default memory used for each batch of times when streaming predictions to
+/// a file
+constexpr size_t c_predictionBufferSize = 268435456;
+
+/// Number of rows transposed together so that a tile of the block and the
+/// column segments it touches stay in cache
+constexpr size_t c_transposeTile = 64;
+
+/**
+ * @brief Transposes a row major block of rows x cols values into the columns
+ * beginning at the given row offset
+ */
+void transposeToColumns(const double* block, size_t rows, size_t cols,
+                        size_t offset,
+                        std::vector<std::vector<double>>& columns) {
+  for (size_t r0 = 0; r0 < rows; r0 += c_transposeTile) {
+    const size_t r1 = std::min(rows, r0 + c_transposeTile);
+    for (size_t c = 0; c < cols; ++c) {
+      double* out = columns[c].data() + offset;
+      for (size_t r = r0; r < r1; ++r) {
+        out[r] = block[r * cols + c];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Transposes the columns beginning at the given row offset into a row
+ * major block of rows x cols values
+ */
+void transposeToRows(const std::vector<std::vector<double>>& columns,
+                     size_t offset, size_t rows, size_t cols, double* block) {
+  for (size_t r0 = 0; r0 < rows; r0 += c_transposeTile) {
+    const size_t r1 = std::min(rows, r0 + c_transposeTile);
+    for (size_t c = 0; c < cols; ++c) {
+      const double* in = columns[c].data() + offset;
+      for (size_t r = r0; r < r1; ++r) {
+        block[r * cols + c] = in[r];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Generates the times from startTime to endTime, inclusive, at an
+ * interval of dt
+ */
+std::vector<double> predictionTimes(double startTime, double endTime,
+                                    double dt) {
+  if (!(dt > 0.0) || !(endTime >= startTime)) {
+    adcircmodules_throw_exception(
+        "HarmonicsOutput: Invalid time range for prediction");
+  }
+  size_t n =
+      static_cast<size_t>(std::floor((endTime - startTime) / dt + 1e-6)) + 1;
+  std::vector<double> times(n);
+  for (size_t i = 0; i < n; ++i) {
+    times[i] = startTime + static_cast<double>(i) * dt;
+  }
+  return times;
+}
+}  // namespace
+
 HarmonicsOutput::~HarmonicsOutput() = default;
 
 HarmonicsOutputPrivate::HarmonicsOutputPrivate(const std::string& filename)
     : m_filename(filename),
       m_numNodes(0),
       m_numConstituents(0),
+      m_predictionBufferSize(c_predictionBufferSize),
       m_isVelocity(false),
       m_filetype(Adcirc::Harmonics::HarmonicsUnknown) {}
 
@@ -385,16 +457,21 @@ void HarmonicsOutputPrivate::writeNetcdfFormatElevation(const int& ncid) {
   nc_inq_varid(ncid, "amp", &varid[0]);
   nc_inq_varid(ncid, "phs", &varid[1]);
 
+  std::vector<std::vector<double>> columns(this->numConstituents());
   for (size_t i = 0; i < this->numConstituents(); ++i) {
-    size_t start[2], count[2];
-    start[0] = 0;
-    start[1] = i;
-    count[0] = this->numNodes();
-    count[1] = 1;
+    columns[i] = this->m_amplitude[i].values();
+  }
+  if (this->writeNetcdfColumns(ncid, varid[0], columns) != NC_NOERR) {
+    nc_close(ncid);
+    adcircmodules_throw_exception("Error writing harmonic elevation data");
+  }
 
-    nc_put_vara(ncid, varid[0], start, count,
-                this->m_amplitude[i].values().data());
-    nc_put_vara(ncid, varid[1], start, count, this->m_phase[i].values().data());
+  for (size_t i = 0; i < this->numConstituents(); ++i) {
+    columns[i] = this->m_phase[i].values();
+  }
+  if (this->writeNetcdfColumns(ncid, varid[1], columns) != NC_NOERR) {
+    nc_close(ncid);
+    adcircmodules_throw_exception("Error writing harmonic elevation data");
   }
 }
 
@@ -405,24 +482,51 @@ void HarmonicsOutputPrivate::writeNetcdfFormatVelocity(const int& ncid) {
   nc_inq_varid(ncid, "v_amp", &varid[2]);
   nc_inq_varid(ncid, "v_phs", &varid[3]);
 
-  for (size_t i = 0; i < this->numConstituents(); ++i) {
-    size_t start[2], count[2];
-    start[0] = 0;
-    start[1] = i;
-    count[0] = this->numNodes();
-    count[1] = 1;
+  std::vector<Adcirc::Harmonics::HarmonicsRecord>* records[4] = {
+      &this->m_uamplitude, &this->m_uphase, &this->m_vamplitude,
+      &this->m_vphase};
 
-    nc_put_vara(ncid, varid[0], start, count,
-                this->m_uamplitude[i].values().data());
-    nc_put_vara(ncid, varid[1], start, count,
-                this->m_uphase[i].values().data());
-    nc_put_vara(ncid, varid[2], start, count,
-                this->m_vamplitude[i].values().data());
-    nc_put_vara(ncid, varid[3], start, count,
-                this->m_vphase[i].values().data());
+  std::vector<std::vector<double>> columns(this->numConstituents());
+  for (size_t v = 0; v < 4; ++v) {
+    for (size_t i = 0; i < this->numConstituents(); ++i) {
+      columns[i] = (*records[v])[i].values();
+    }
+    if (this->writeNetcdfColumns(ncid, varid[v], columns) != NC_NOERR) {
+      nc_close(ncid);
+      adcircmodules_throw_exception("Error writing harmonic velocity data");
+    }
   }
 }
 
+/**
+ * @brief Writes a node x constituent variable from per-constituent columns
+ * @param[in] ncid netcdf file id
+ * @param[in] varid variable to write
+ * @param[in] columns one vector of node values for each constituent
+ * @return netcdf error code
+ *
+ * The columns are transposed into contiguous blocks of rows so that each
+ * write covers whole rows of the variable instead of a strided column
+ */
+int HarmonicsOutputPrivate::writeNetcdfColumns(
+    int ncid, int varid, const std::vector<std::vector<double>>& columns) {
+  const size_t nc = columns.size();
+  if (nc == 0 || this->numNodes() == 0) return NC_NOERR;
+
+  const size_t blockRows = std::max<size_t>(1, c_netcdfBlockSize / nc);
+  std::vector<double> block(std::min(blockRows, this->numNodes()) * nc);
+
+  for (size_t r = 0; r < this->numNodes(); r += blockRows) {
+    const size_t rows = std::min(blockRows, this->numNodes() - r);
+    transposeToRows(columns, r, rows, nc, block.data());
+    size_t start[2] = {r, 0};
+    size_t count[2] = {rows, nc};
+    int ierr = nc_put_vara_double(ncid, varid, start, count, block.data());
+    if (ierr != NC_NOERR) return ierr;
+  }
+  return NC_NOERR;
+}
+
 void HarmonicsOutputPrivate::getFiletype() {
   if (Adcirc::Harmonics::checkFiletypeNetcdfHarmonics(this->filename())) {
     this->m_filetype = Adcirc::Harmonics::HarmonicsNetcdf;
@@ -831,27 +935,57 @@ void HarmonicsOutputPrivate::readNetcdfFormatHeader(int ncid,
   return;
 }
 
+/**
+ * @brief Reads a node x constituent variable into per-constituent columns
+ * @param[in] ncid netcdf file id
+ * @param[in] varid variable to read
+ * @param[out] columns one vector of node values for each constituent
+ * @return netcdf error code
+ *
+ * The variable is read in contiguous blocks of whole rows, which follows the
+ * on-disk layout and chunking of the file, and each block is transposed in
+ * memory
+ */
+int HarmonicsOutputPrivate::readNetcdfColumns(
+    int ncid, int varid, std::vector<std::vector<double>>& columns) {
+  const size_t nc = this->numConstituents();
+  columns.resize(nc);
+  for (auto& c : columns) {
+    c.resize(this->numNodes());
+  }
+  if (nc == 0 || this->numNodes() == 0) return NC_NOERR;
+
+  const size_t blockRows = std::max<size_t>(1, c_netcdfBlockSize / nc);
+  std::vector<double> block(std::min(blockRows, this->numNodes()) * nc);
+
+  for (size_t r = 0; r < this->numNodes(); r += blockRows) {
+    const size_t rows = std::min(blockRows, this->numNodes() - r);
+    size_t start[2] = {r, 0};
+    size_t count[2] = {rows, nc};
+    int ierr = nc_get_vara_double(ncid, varid, start, count, block.data());
+    if (ierr != NC_NOERR) return ierr;
+    transposeToColumns(block.data(), rows, nc, r, columns);
+  }
+  return NC_NOERR;
+}
+
 void HarmonicsOutputPrivate::readNetcdfElevationData(int ncid,
                                                      std::vector<int>& varids) {
   assert(varids.size() == 2);
 
-  std::vector<double> v(this->numNodes());
-  size_t start[2], count[2];
+  std::vector<std::vector<double>> columns;
+  if (this->readNetcdfColumns(ncid, varids[0], columns) != NC_NOERR) {
+    adcircmodules_throw_exception("Error reading harmonic elevation data");
+  }
   for (size_t i = 0; i < this->numConstituents(); ++i) {
-    start[0] = 0;
-    start[1] = i;
-    count[0] = this->numNodes();
-    count[1] = 1;
-    int ierr = nc_get_vara(ncid, varids[0], start, count, v.data());
-    if (ierr != NC_NOERR) {
-      adcircmodules_throw_exception("Error reading harmonic elevation data");
-    }
-    this->amplitude(i)->set(v);
-    ierr = nc_get_vara(ncid, varids[1], start, count, v.data());
-    if (ierr != NC_NOERR) {
-      adcircmodules_throw_exception("Error reading harmonic elevation data");
-    }
-    this->phase(i)->set(v);
+    this->amplitude(i)->set(columns[i]);
+  }
+
+  if (this->readNetcdfColumns(ncid, varids[1], columns) != NC_NOERR) {
+    adcircmodules_throw_exception("Error reading harmonic elevation data");
+  }
+  for (size_t i = 0; i < this->numConstituents(); ++i) {
+    this->phase(i)->set(columns[i]);
   }
 
   return;
@@ -861,41 +995,176 @@ void HarmonicsOutputPrivate::readNetcdfVelocityData(int ncid,
                                                     std::vector<int>& varids) {
   assert(varids.size() == 4);
 
-  std::vector<double> v(this->numNodes());
-  size_t start[2], count[2];
+  std::vector<Adcirc::Harmonics::HarmonicsRecord>* records[4] = {
+      &this->m_uamplitude, &this->m_uphase, &this->m_vamplitude,
+      &this->m_vphase};
 
-  for (size_t i = 0; i < this->numConstituents(); ++i) {
-    start[0] = 0;
-    start[1] = i;
-    count[0] = this->numNodes();
-    count[1] = 1;
-
-    int ierr = nc_get_vara(ncid, varids[0], start, count, v.data());
-    if (ierr != NC_NOERR) {
+  std::vector<std::vector<double>> columns;
+  for (size_t v = 0; v < 4; ++v) {
+    if (this->readNetcdfColumns(ncid, varids[v], columns) != NC_NOERR) {
       adcircmodules_throw_exception("Error reading harmonic velocity data");
     }
-    std::vector<double> ua(v.data(), v.data() + this->numNodes());
-    this->u_amplitude(i)->set(ua);
+    for (size_t i = 0; i < this->numConstituents(); ++i) {
+      (*records[v])[i].set(columns[i]);
+    }
+  }
 
-    ierr = nc_get_vara(ncid, varids[1], start, count, v.data());
-    if (ierr != NC_NOERR) {
-      adcircmodules_throw_exception("Error reading harmonic velocity data");
+  return;
+}
+
+/**
+ * @brief Builds the synthesis objects for the data in this file. Elevation
+ * files produce one object and velocity files produce one for each component
+ */
+std::vector<std::unique_ptr<HarmonicsSynthesis>>
+HarmonicsOutputPrivate::synthesis(const std::vector<size_t>& nodes) {
+  if (this->numConstituents() == 0 || this->numNodes() == 0) {
+    adcircmodules_throw_exception(
+        "HarmonicsOutput: No harmonic data available for prediction");
+  }
+
+  auto pointers = [](std::vector<Adcirc::Harmonics::HarmonicsRecord>& r) {
+    std::vector<Adcirc::Harmonics::HarmonicsRecord*> p;
+    p.reserve(r.size());
+    for (auto& v : r) {
+      p.push_back(&v);
     }
-    this->u_phase(i)->set(v);
+    return p;
+  };
 
-    ierr = nc_get_vara(ncid, varids[2], start, count, v.data());
-    if (ierr != NC_NOERR) {
-      adcircmodules_throw_exception("Error reading harmonic velocity data");
+  std::vector<std::unique_ptr<HarmonicsSynthesis>> s;
+  if (this->isVelocity()) {
+    s.emplace_back(new HarmonicsSynthesis(pointers(this->m_uamplitude),
+                                          pointers(this->m_uphase), nodes));
+    s.emplace_back(new HarmonicsSynthesis(pointers(this->m_vamplitude),
+                                          pointers(this->m_vphase), nodes));
+  } else {
+    s.emplace_back(new HarmonicsSynthesis(pointers(this->m_amplitude),
+                                          pointers(this->m_phase), nodes));
+  }
+  return s;
+}
+
+Adcirc::Output::OutputMetadata HarmonicsOutputPrivate::predictionMetadata()
+    const {
+  return this->isVelocity() ? c_outputMetadata[7] : c_outputMetadata[4];
+}
+
+size_t HarmonicsOutputPrivate::predictionBufferSize() const {
+  return this->m_predictionBufferSize;
+}
+
+void HarmonicsOutputPrivate::setPredictionBufferSize(size_t bytes) {
+  this->m_predictionBufferSize = bytes;
+}
+
+Adcirc::Output::OutputRecord HarmonicsOutputPrivate::predict(double time) {
+  auto s = this->synthesis(std::vector<size_t>());
+  size_t nn = s[0]->numNodes();
+
+  std::vector<std::vector<double>> values(s.size(), std::vector<double>(nn));
+  for (size_t k = 0; k < s.size(); ++k) {
+    double* out = values[k].data();
+    s[k]->evaluate(&time, 1, &out);
+  }
+
+  Adcirc::Output::OutputMetadata metadata = this->predictionMetadata();
+  Adcirc::Output::OutputRecord record(0, nn, metadata);
+  if (this->isVelocity()) {
+    record.setAll(nn, values[0].data(), values[1].data());
+  } else {
+    record.setAll(nn, values[0].data());
+  }
+  record.setTime(time);
+  return record;
+}
+
+void HarmonicsOutputPrivate::predict(Adcirc::Output::WriteOutput* writer,
+                                     double startTime, double endTime,
+                                     double dt) {
+  if (writer == nullptr) {
+    adcircmodules_throw_exception("HarmonicsOutput: Invalid output writer");
+  }
+
+  std::vector<double> times = predictionTimes(startTime, endTime, dt);
+  auto s = this->synthesis(std::vector<size_t>());
+  size_t nn = s[0]->numNodes();
+
+  size_t batch =
+      this->m_predictionBufferSize / (sizeof(double) * nn * s.size());
+  batch = std::max<size_t>(1, std::min(batch, times.size()));
+
+  std::vector<std::vector<double>> buffer(s.size() * batch,
+                                          std::vector<double>(nn));
+  std::vector<double*> pointers(batch);
+  Adcirc::Output::OutputMetadata metadata = this->predictionMetadata();
+
+  for (size_t first = 0; first < times.size(); first += batch) {
+    size_t n = std::min(batch, times.size() - first);
+    for (size_t k = 0; k < s.size(); ++k) {
+      for (size_t t = 0; t < n; ++t) {
+        pointers[t] = buffer[k * batch + t].data();
+      }
+      s[k]->evaluate(times.data() + first, n, pointers.data());
     }
-    this->v_amplitude(i)->set(v);
 
-    ierr = nc_get_vara(ncid, varids[3], start, count, v.data());
-    if (ierr != NC_NOERR) {
-      adcircmodules_throw_exception("Error reading harmonic velocity data");
+    for (size_t t = 0; t < n; ++t) {
+      Adcirc::Output::OutputRecord record(first + t, nn, metadata);
+      if (this->isVelocity()) {
+        record.setAll(nn, buffer[t].data(), buffer[batch + t].data());
+      } else {
+        record.setAll(nn, buffer[t].data());
+      }
+      record.setTime(times[first + t]);
+      writer->write(&record);
+    }
+  }
+  return;
+}
+
+Adcirc::Output::Hmdf HarmonicsOutputPrivate::predict(
+    const std::vector<size_t>& nodes, const Adcirc::CDate& referenceDate,
+    double startTime, double endTime, double dt) {
+  if (nodes.empty()) {
+    adcircmodules_throw_exception(
+        "HarmonicsOutput: No nodes specified for prediction");
+  }
+
+  std::vector<double> times = predictionTimes(startTime, endTime, dt);
+  auto s = this->synthesis(nodes);
+
+  //...Values are stored time major, one row of stations for each time
+  std::vector<std::vector<double>> values(
+      s.size(), std::vector<double>(times.size() * nodes.size()));
+  std::vector<double*> pointers(times.size());
+  for (size_t k = 0; k < s.size(); ++k) {
+    for (size_t t = 0; t < times.size(); ++t) {
+      pointers[t] = values[k].data() + t * nodes.size();
     }
+    s[k]->evaluate(times.data(), times.size(), pointers.data());
+  }
 
-    this->v_phase(i)->set(v);
+  Adcirc::Output::Hmdf h(this->isVelocity());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    Adcirc::Output::HmdfStation station(this->isVelocity());
+    station.setId(std::to_string(nodes[i] + 1));
+    station.setName(std::to_string(nodes[i] + 1));
+    station.setStationIndex(i);
+    h.addStation(std::move(station));
   }
 
-  return;
+  h.allocate(times.size());
+  for (size_t t = 0; t < times.size(); ++t) {
+    h.setTime(t, referenceDate + times[t]);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      if (this->isVelocity()) {
+        h.setValue(i, t, values[0][t * nodes.size() + i],
+                   values[1][t * nodes.size() + i]);
+      } else {
+        h.setValue(i, t, values[0][t * nodes.size() + i]);
+      }
+    }
+  }
+  h.setSuccess(true);
+  return h;
 }
@@ -19,11 +19,22 @@
 #ifndef ADCMOD_HARMONICSOUTPUTPRIVATE_H
 #define ADCMOD_HARMONICSOUTPUTPRIVATE_H
 
+#include <memory>
 #include <string>
 #include <vector>
 #include "adcmap.h"
+#include "cdate.h"
 #include "filetypes.h"
 #include "harmonicsrecord.h"
+#include "harmonicssynthesis.h"
+#include "hmdf.h"
+#include "outputrecord.h"
+
+namespace Adcirc {
+namespace Output {
+class WriteOutput;
+}
+}  // namespace Adcirc
 
 namespace Adcirc {
 namespace Private {
@@ -76,6 +87,16 @@ class HarmonicsOutputPrivate {
 
   int filetype() const;
 
+  size_t predictionBufferSize() const;
+  void setPredictionBufferSize(size_t bytes);
+
+  Adcirc::Output::OutputRecord predict(double time);
+  void predict(Adcirc::Output::WriteOutput* writer, double startTime,
+               double endTime, double dt);
+  Adcirc::Output::Hmdf predict(const std::vector<size_t>& nodes,
+                               const Adcirc::CDate& referenceDate,
+                               double startTime, double endTime, double dt);
+
  private:
   int m_filetype;
   bool m_isVelocity;
@@ -83,6 +104,7 @@ class HarmonicsOutputPrivate {
   std::vector<std::string> m_consituentNames;
   size_t m_numConstituents;
   size_t m_numNodes;
+  size_t m_predictionBufferSize;
   std::vector<Adcirc::Harmonics::HarmonicsRecord> m_amplitude;
   std::vector<Adcirc::Harmonics::HarmonicsRecord> m_phase;
   std::vector<Adcirc::Harmonics::HarmonicsRecord> m_uamplitude;
@@ -113,10 +135,17 @@ class HarmonicsOutputPrivate {
   void writeNetcdfFormatElevation(const int& ncid);
   void writeNetcdfFormatVelocity(const int& ncid);
   void writeNetcdfHeader(const int& ncid);
+  int writeNetcdfColumns(int ncid, int varid,
+                         const std::vector<std::vector<double>>& columns);
 
   void readNetcdfFormatHeader(int ncid, std::vector<int>& varids);
+  std::vector<std::unique_ptr<HarmonicsSynthesis>> synthesis(
+      const std::vector<size_t>& nodes);
+  Adcirc::Output::OutputMetadata predictionMetadata() const;
   void readNetcdfElevationData(int ncid, std::vector<int>& varids);
   void readNetcdfVelocityData(int ncid, std::vector<int>& varids);
+  int readNetcdfColumns(int ncid, int varid,
+                        std::vector<std::vector<double>>& columns);
 };
 }  // namespace Private
 }  // namespace Adcirc
@@ -0,0 +1,160 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "harmonicssynthesis.h"
+#include <algorithm>
+#include <cmath>
+#include "constants.h"
+#include "logging.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Adcirc::Private;
+
+namespace {
+/// Number of nodes evaluated together so that the coefficients of every
+/// constituent for the block stay in cache while all times are summed
+constexpr size_t c_synthesisBlockSize = 512;
+}  // namespace
+
+/**
+ * @brief Constructs the synthesis coefficients for a set of constituents
+ * @param[in] amplitude amplitude record for each constituent
+ * @param[in] phase phase record, in degrees, for each constituent
+ * @param[in] nodes array positions of the nodes to evaluate. All nodes are
+ * evaluated when empty
+ */
+HarmonicsSynthesis::HarmonicsSynthesis(
+    const std::vector<Adcirc::Harmonics::HarmonicsRecord *> &amplitude,
+    const std::vector<Adcirc::Harmonics::HarmonicsRecord *> &phase,
+    const std::vector<size_t> &nodes)
+    : m_numNodes(0), m_numConstituents(amplitude.size()) {
+  if (amplitude.size() != phase.size()) {
+    adcircmodules_throw_exception(
+        "HarmonicsSynthesis: Amplitude and phase records do not match");
+  }
+
+  this->m_frequency.resize(this->m_numConstituents);
+  this->m_nodalFactor.resize(this->m_numConstituents);
+  this->m_equilibriumArg.resize(this->m_numConstituents);
+
+  for (size_t j = 0; j < this->m_numConstituents; ++j) {
+    std::vector<double> a = amplitude[j]->values();
+    std::vector<double> p = phase[j]->values();
+    if (a.size() != p.size()) {
+      adcircmodules_throw_exception(
+          "HarmonicsSynthesis: Amplitude and phase records do not match");
+    }
+
+    if (j == 0) {
+      this->m_numNodes = nodes.empty() ? a.size() : nodes.size();
+      this->m_inPhase.resize(this->m_numConstituents * this->m_numNodes);
+      this->m_quadrature.resize(this->m_numConstituents * this->m_numNodes);
+    } else if (nodes.empty() && a.size() != this->m_numNodes) {
+      adcircmodules_throw_exception(
+          "HarmonicsSynthesis: Constituents have different numbers of nodes");
+    }
+
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      if (nodes[i] >= a.size()) {
+        adcircmodules_throw_exception(
+            "HarmonicsSynthesis: Node index out of range");
+      }
+    }
+
+    this->m_frequency[j] = amplitude[j]->frequency();
+    this->m_nodalFactor[j] = amplitude[j]->nodalFactor();
+    this->m_equilibriumArg[j] =
+        amplitude[j]->equilibriumArg() * Adcirc::Constants::deg2rad();
+
+    double *inPhase = this->m_inPhase.data() + j * this->m_numNodes;
+    double *quadrature = this->m_quadrature.data() + j * this->m_numNodes;
+
+#pragma omp parallel for schedule(static) default(none) \
+    shared(a, p, nodes, inPhase, quadrature)
+    for (signed long long i = 0;
+         i < static_cast<signed long long>(this->m_numNodes); ++i) {
+      size_t k = nodes.empty() ? static_cast<size_t>(i) : nodes[i];
+      double g = p[k] * Adcirc::Constants::deg2rad();
+      inPhase[i] = a[k] * std::cos(g);
+      quadrature[i] = a[k] * std::sin(g);
+    }
+  }
+}
+
+/**
+ * @brief Returns the number of nodes evaluated by this object
+ */
+size_t HarmonicsSynthesis::numNodes() const { return this->m_numNodes; }
+
+/**
+ * @brief Returns the number of constituents summed by this object
+ */
+size_t HarmonicsSynthesis::numConstituents() const {
+  return this->m_numConstituents;
+}
+
+/**
+ * @brief Evaluates the constituent sum at a set of times
+ * @param[in] times times, in seconds since the harmonic reference time
+ * @param[in] numTimes number of times
+ * @param[out] output numTimes arrays that each receive numNodes values
+ *
+ * For each constituent f*A*cos(w*t + V - G) is expanded as
+ * f*cos(w*t + V) * A*cos(G) + f*sin(w*t + V) * A*sin(G), so the
+ * trigonometric terms depend only on time and the node loop is a
+ * multiply-add over contiguous arrays that the compiler can vectorize
+ */
+void HarmonicsSynthesis::evaluate(const double *times, size_t numTimes,
+                                  double *const *output) const {
+  std::vector<double> c(numTimes * this->m_numConstituents);
+  std::vector<double> s(numTimes * this->m_numConstituents);
+  for (size_t t = 0; t < numTimes; ++t) {
+    for (size_t j = 0; j < this->m_numConstituents; ++j) {
+      double arg = this->m_frequency[j] * times[t] + this->m_equilibriumArg[j];
+      double f = this->m_nodalFactor[j];
+      c[t * this->m_numConstituents + j] = f * std::cos(arg);
+      s[t * this->m_numConstituents + j] = f * std::sin(arg);
+    }
+  }
+
+  signed long long nBlocks = static_cast<signed long long>(
+      (this->m_numNodes + c_synthesisBlockSize - 1) / c_synthesisBlockSize);
+
+#pragma omp parallel for schedule(static) default(none) \
+    shared(c, s, output, numTimes, nBlocks)
+  for (signed long long b = 0; b < nBlocks; ++b) {
+    size_t n0 = static_cast<size_t>(b) * c_synthesisBlockSize;
+    size_t n1 = std::min(this->m_numNodes, n0 + c_synthesisBlockSize);
+    for (size_t t = 0; t < numTimes; ++t) {
+      double *out = output[t];
+      std::fill(out + n0, out + n1, 0.0);
+      for (size_t j = 0; j < this->m_numConstituents; ++j) {
+        double ct = c[t * this->m_numConstituents + j];
+        double st = s[t * this->m_numConstituents + j];
+        const double *a = this->m_inPhase.data() + j * this->m_numNodes;
+        const double *q = this->m_quadrature.data() + j * this->m_numNodes;
+        for (size_t n = n0; n < n1; ++n) {
+          out[n] += ct * a[n] + st * q[n];
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,67 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_HARMONICSSYNTHESIS_H
+#define ADCMOD_HARMONICSSYNTHESIS_H
+
+#include <cstddef>
+#include <vector>
+#include "harmonicsrecord.h"
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class HarmonicsSynthesis
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Reconstructs a time series from harmonic constituents
+ *
+ * The amplitude and phase of each constituent are converted once into in-phase
+ * and quadrature coefficients stored contiguously by constituent. Each time
+ * then only requires one cosine and sine per constituent, and the nodal sum
+ * is a streaming multiply-add over the coefficient arrays.
+ */
+class HarmonicsSynthesis {
+ public:
+  HarmonicsSynthesis(
+      const std::vector<Adcirc::Harmonics::HarmonicsRecord *> &amplitude,
+      const std::vector<Adcirc::Harmonics::HarmonicsRecord *> &phase,
+      const std::vector<size_t> &nodes = std::vector<size_t>());
+
+  size_t numNodes() const;
+  size_t numConstituents() const;
+
+  void evaluate(const double *times, size_t numTimes,
+                double *const *output) const;
+
+ private:
+  size_t m_numNodes;
+  size_t m_numConstituents;
+  std::vector<double> m_frequency;
+  std::vector<double> m_nodalFactor;
+  std::vector<double> m_equilibriumArg;
+  std::vector<double> m_inPhase;
+  std::vector<double> m_quadrature;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_HARMONICSSYNTHESIS_H
@@ -18,18 +18,57 @@
 //------------------------------------------------------------------------*/
 #include "hash_private.h"
 
+#include <cstdio>
+
 #include "logging.h"
 
 using namespace Adcirc::Private;
 
-HashPrivate::HashPrivate(Adcirc::Cryptography::HashType h)
-    : m_hashType(h), m_started(false) {
-#ifdef ADCMOD_HAVE_OPENSSL
-  this->addDataPtr = nullptr;
-  this->getHashPtr = nullptr;
-#endif
+namespace {
+//...xxHash64 constants
+constexpr uint64_t c_xxhPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t c_xxhPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t c_xxhPrime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t c_xxhPrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t c_xxhPrime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t xxhRotate(uint64_t x, int r) {
+  return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t xxhRead64(const unsigned char *p) {
+  uint64_t v = 0;
+  for (int i = 7; i >= 0; --i) v = (v << 8) | p[i];
+  return v;
+}
+
+inline uint64_t xxhRead32(const unsigned char *p) {
+  uint64_t v = 0;
+  for (int i = 3; i >= 0; --i) v = (v << 8) | p[i];
+  return v;
 }
 
+inline uint64_t xxhRound(uint64_t acc, uint64_t input) {
+  acc += input * c_xxhPrime2;
+  acc = xxhRotate(acc, 31);
+  return acc * c_xxhPrime1;
+}
+
+inline uint64_t xxhMerge(uint64_t acc, uint64_t v) {
+  acc ^= xxhRound(0, v);
+  return acc * c_xxhPrime1 + c_xxhPrime4;
+}
+}  // namespace
+
+HashPrivate::HashPrivate(Adcirc::Cryptography::HashType h)
+    : m_hashType(h),
+      m_started(false),
+      addDataPtr(nullptr),
+      getHashPtr(nullptr),
+      m_xxhState{0, 0, 0, 0},
+      m_xxhLength(0),
+      m_xxhBufferSize(0) {}
+
 Adcirc::Cryptography::HashType HashPrivate::hashType() const {
   return this->m_hashType;
 }
@@ -44,21 +83,20 @@ void HashPrivate::setHashType(const Adcirc::Cryptography::HashType &hashType) {
   return;
 }
 
-#ifndef ADCMOD_HAVE_OPENSSL
-void HashPrivate::addData(const std::string &s) {
-  adcircmodules_throw_exception("OpenSSL library not enabled.");
-  return;
-}
-
-char *HashPrivate::getHash() {
-  adcircmodules_throw_exception("OpenSSL library not enabled.");
-  return nullptr;
-}
-
-#else
 void HashPrivate::initialize() {
   this->m_started = true;
   switch (this->m_hashType) {
+    case Adcirc::Cryptography::HashType::AdcmodXXH64:
+      this->m_xxhState[0] = c_xxhPrime1 + c_xxhPrime2;
+      this->m_xxhState[1] = c_xxhPrime2;
+      this->m_xxhState[2] = 0;
+      this->m_xxhState[3] = 0 - c_xxhPrime1;
+      this->m_xxhLength = 0;
+      this->m_xxhBufferSize = 0;
+      this->addDataPtr = &HashPrivate::addDataXxh64;
+      this->getHashPtr = &HashPrivate::getXxh64;
+      break;
+#ifdef ADCMOD_HAVE_OPENSSL
     case Adcirc::Cryptography::HashType::AdcmodMD5:
       MD5_Init(&this->m_md5ctx);
       this->addDataPtr = &HashPrivate::addDataMd5;
@@ -74,6 +112,7 @@ void HashPrivate::initialize() {
       this->addDataPtr = &HashPrivate::addDataSha256;
       this->getHashPtr = &HashPrivate::getSha256;
       break;
+#endif
     default:
       break;
   }
@@ -82,12 +121,120 @@ void HashPrivate::initialize() {
 
 void HashPrivate::addData(const std::string &s) {
   if (!this->m_started) this->initialize();
+  if (this->addDataPtr == nullptr) {
+    adcircmodules_throw_exception("OpenSSL library not enabled.");
+  }
   (this->*addDataPtr)(s);
   return;
 }
 
-char *HashPrivate::getHash() { return (this->*getHashPtr)(); }
+char *HashPrivate::getHash() {
+  if (!this->m_started) this->initialize();
+  if (this->getHashPtr == nullptr) {
+    adcircmodules_throw_exception("OpenSSL library not enabled.");
+  }
+  return (this->*getHashPtr)();
+}
 
+char *HashPrivate::getDigest(size_t length, unsigned char data[]) {
+  char *mdString = new char[length * 2 + 1];
+  for (size_t i = 0; i < length; ++i)
+    sprintf(&mdString[i * 2], "%02x", static_cast<unsigned int>(data[i]));
+  return mdString;
+}
+
+/**
+ * @brief Adds data to the xxHash64 state. xxHash64 is a fast,
+ * non-cryptographic hash suited to change detection of large data
+ * @param[in] data data to add to the hash
+ */
+void HashPrivate::addDataXxh64(const std::string &data) {
+  const unsigned char *p = reinterpret_cast<const unsigned char *>(data.data());
+  size_t n = data.size();
+  this->m_xxhLength += n;
+
+  if (this->m_xxhBufferSize + n < 32) {
+    std::memcpy(this->m_xxhBuffer + this->m_xxhBufferSize, p, n);
+    this->m_xxhBufferSize += n;
+    return;
+  }
+
+  if (this->m_xxhBufferSize > 0) {
+    const size_t fill = 32 - this->m_xxhBufferSize;
+    std::memcpy(this->m_xxhBuffer + this->m_xxhBufferSize, p, fill);
+    for (size_t i = 0; i < 4; ++i) {
+      this->m_xxhState[i] =
+          xxhRound(this->m_xxhState[i], xxhRead64(this->m_xxhBuffer + 8 * i));
+    }
+    p += fill;
+    n -= fill;
+    this->m_xxhBufferSize = 0;
+  }
+
+  uint64_t v[4] = {this->m_xxhState[0], this->m_xxhState[1],
+                   this->m_xxhState[2], this->m_xxhState[3]};
+  while (n >= 32) {
+    v[0] = xxhRound(v[0], xxhRead64(p));
+    v[1] = xxhRound(v[1], xxhRead64(p + 8));
+    v[2] = xxhRound(v[2], xxhRead64(p + 16));
+    v[3] = xxhRound(v[3], xxhRead64(p + 24));
+    p += 32;
+    n -= 32;
+  }
+  std::memcpy(this->m_xxhState, v, sizeof(v));
+
+  if (n > 0) {
+    std::memcpy(this->m_xxhBuffer, p, n);
+    this->m_xxhBufferSize = n;
+  }
+}
+
+char *HashPrivate::getXxh64() {
+  const uint64_t *v = this->m_xxhState;
+  uint64_t h;
+  if (this->m_xxhLength >= 32) {
+    h = xxhRotate(v[0], 1) + xxhRotate(v[1], 7) + xxhRotate(v[2], 12) +
+        xxhRotate(v[3], 18);
+    for (size_t i = 0; i < 4; ++i) h = xxhMerge(h, v[i]);
+  } else {
+    h = v[2] + c_xxhPrime5;
+  }
+  h += this->m_xxhLength;
+
+  const unsigned char *p = this->m_xxhBuffer;
+  size_t n = this->m_xxhBufferSize;
+  while (n >= 8) {
+    h ^= xxhRound(0, xxhRead64(p));
+    h = xxhRotate(h, 27) * c_xxhPrime1 + c_xxhPrime4;
+    p += 8;
+    n -= 8;
+  }
+  if (n >= 4) {
+    h ^= xxhRead32(p) * c_xxhPrime1;
+    h = xxhRotate(h, 23) * c_xxhPrime2 + c_xxhPrime3;
+    p += 4;
+    n -= 4;
+  }
+  while (n > 0) {
+    h ^= (*p) * c_xxhPrime5;
+    h = xxhRotate(h, 11) * c_xxhPrime1;
+    ++p;
+    --n;
+  }
+  h ^= h >> 33;
+  h *= c_xxhPrime2;
+  h ^= h >> 29;
+  h *= c_xxhPrime3;
+  h ^= h >> 32;
+
+  unsigned char digest[8];
+  for (size_t i = 0; i < 8; ++i) {
+    digest[i] = static_cast<unsigned char>(h >> (56 - 8 * i));
+  }
+  return this->getDigest(8, digest);
+}
+
+#ifdef ADCMOD_HAVE_OPENSSL
 void HashPrivate::addDataMd5(const std::string &data) {
   MD5_Update(&this->m_md5ctx, &data[0], data.length());
   return;
@@ -103,13 +250,6 @@ void HashPrivate::addDataSha256(const std::string &data) {
   return;
 }
 
-char *HashPrivate::getDigest(size_t length, unsigned char data[]) {
-  char *mdString = new char[length * 2 + 1];
-  for (size_t i = 0; i < length; ++i)
-    sprintf(&mdString[i * 2], "%02x", static_cast<unsigned int>(data[i]));
-  return mdString;
-}
-
 char *HashPrivate::getMd5() {
   unsigned char digest[MD5_DIGEST_LENGTH];
   MD5_Final(digest, &this->m_md5ctx);
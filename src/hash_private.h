@@ -24,6 +24,7 @@
 #include <openssl/sha.h>
 #endif
 
+#include <cstdint>
 #include <cstring>
 #include <string>
 #include "hashtype.h"
@@ -44,9 +45,22 @@ class HashPrivate {
   Adcirc::Cryptography::HashType m_hashType;
   bool m_started;
 
-#ifdef ADCMOD_HAVE_OPENSSL
   void initialize();
 
+  void addDataXxh64(const std::string &data);
+  char *getXxh64();
+
+  char *getDigest(size_t length, unsigned char data[]);
+
+  void (HashPrivate::*addDataPtr)(const std::string &data);
+  char *(HashPrivate::*getHashPtr)();
+
+  uint64_t m_xxhState[4];
+  uint64_t m_xxhLength;
+  unsigned char m_xxhBuffer[32];
+  size_t m_xxhBufferSize;
+
+#ifdef ADCMOD_HAVE_OPENSSL
   void addDataMd5(const std::string &data);
   void addDataSha1(const std::string &data);
   void addDataSha256(const std::string &data);
@@ -55,11 +69,6 @@ class HashPrivate {
   char *getSha1();
   char *getMd5();
 
-  char *getDigest(size_t length, unsigned char data[]);
-
-  void (HashPrivate::*addDataPtr)(const std::string &data);
-  char *(HashPrivate::*getHashPtr)();
-
   MD5_CTX m_md5ctx;
   SHA_CTX m_sha1ctx;
   SHA256_CTX m_sha256ctx;
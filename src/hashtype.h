@@ -22,7 +22,7 @@
 namespace Adcirc {
 
 namespace Cryptography {
-enum HashType { NullHash, AdcmodMD5, AdcmodSHA1, AdcmodSHA256 };
+enum HashType { NullHash, AdcmodMD5, AdcmodSHA1, AdcmodSHA256, AdcmodXXH64 };
 
 constexpr HashType AdcircDefaultHash = HashType::AdcmodSHA1;
 
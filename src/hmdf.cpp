@@ -18,7 +18,12 @@
 //------------------------------------------------------------------------*/
 #include "hmdf.h"
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 
 #if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
@@ -31,14 +36,22 @@
 #include "boost/algorithm/string/replace.hpp"
 #include "boost/format.hpp"
 #include "cdate.h"
+#include "coordinatetransform.h"
 #include "ezproj.h"
 #include "fileio.h"
 #include "formatting.h"
 #include "logging.h"
+#include "mappedfile.h"
 #include "netcdf.h"
 #include "netcdftimeseries.h"
+#include "textio.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace Adcirc::Output;
+using namespace Adcirc::Private;
 
 #define NCCHECK(ierr)     \
   if (ierr != NC_NOERR) { \
@@ -46,7 +59,233 @@ using namespace Adcirc::Output;
     return ierr;          \
   }
 
-Hmdf::Hmdf(bool isVector) : m_isVector(isVector) { this->init(); }
+namespace {
+
+/**
+ * @brief Calendar fields of a time on the proleptic Gregorian calendar
+ */
+struct HmdfDateFields {
+  int year;
+  int month;
+  int day;
+  int hour;
+  int minute;
+  int second;
+  int millisecond;
+};
+
+/**
+ * @brief Station header lines and data samples found in one block of an
+ * IMEDS file. Each header is recorded with the number of samples that
+ * preceded it in the block so that blocks can be parsed independently and
+ * joined afterwards
+ */
+struct ImedsBlock {
+  std::vector<long long> seconds;
+  std::vector<double> values;
+  std::vector<size_t> headerPosition;
+  std::vector<std::pair<const char *, const char *>> headerLine;
+  bool invalidDate = false;
+};
+
+/// Length of the station name and id strings in netCDF files
+constexpr size_t c_netcdfNameLength = 200;
+
+/// Bounds on the number of samples in a netCDF chunk
+constexpr size_t c_netcdfMinChunk = 1024;
+constexpr size_t c_netcdfMaxChunk = 1048576;
+
+/// Blocks smaller than this are not worth splitting across threads
+constexpr size_t c_minImedsBlockSize = 1048576;
+
+std::chrono::system_clock::time_point hmdfEpoch() {
+  static const std::chrono::system_clock::time_point epoch =
+      Adcirc::CDate(1970, 1, 1, 0, 0, 0).time_point();
+  return epoch;
+}
+
+/**
+ * @brief Number of days between 1970-01-01 and the specified civil date
+ */
+long long daysFromCivil(long long y, int m, int d) {
+  y -= m <= 2;
+  const long long era = (y >= 0 ? y : y - 399) / 400;
+  const long long yoe = y - era * 400;
+  const long long doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+  const long long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+/**
+ * @brief Civil date of the day that is z days after 1970-01-01
+ */
+void civilFromDays(long long z, int &y, int &m, int &d) {
+  z += 719468;
+  const long long era = (z >= 0 ? z : z - 146096) / 146097;
+  const long long doe = z - era * 146097;
+  const long long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const long long doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const long long mp = (5 * doy + 2) / 153;
+  d = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+  m = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+  y = static_cast<int>(yoe + era * 400 + (m <= 2));
+}
+
+/**
+ * @brief Checks a date with the same rules that CDate uses when it is
+ * constructed from its components
+ */
+bool isValidCivil(int y, int m, int d) {
+  if (y < -32767 || y > 32767 || m < 1 || m > 12 || d < 1) return false;
+  static const int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  const bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+  return d <= (m == 2 && leap ? 29 : days[m - 1]);
+}
+
+HmdfDateFields splitEpochMs(long long ms) {
+  long long days = ms / 86400000;
+  long long rem = ms % 86400000;
+  if (rem < 0) {
+    rem += 86400000;
+    days -= 1;
+  }
+  HmdfDateFields f;
+  civilFromDays(days, f.year, f.month, f.day);
+  f.hour = static_cast<int>(rem / 3600000);
+  f.minute = static_cast<int>((rem / 60000) % 60);
+  f.second = static_cast<int>((rem / 1000) % 60);
+  f.millisecond = static_cast<int>(rem % 1000);
+  return f;
+}
+
+/**
+ * @brief Appends a value using the printf format %width.precisione. The
+ * decimal separator is always a period regardless of the C locale
+ */
+void appendScientific(std::string &s, double value, int width, int precision) {
+  char buffer[64];
+  int n = snprintf(buffer, sizeof(buffer), "%*.*e", width, precision, value);
+  if (n < 0) return;
+  if (static_cast<size_t>(n) >= sizeof(buffer)) n = sizeof(buffer) - 1;
+  TextIO::fixDecimalPoint(buffer, buffer + n);
+  s.append(buffer, static_cast<size_t>(n));
+}
+
+/**
+ * @brief Appends a date as "yyyy mm dd hh mm ss " for IMEDS files
+ */
+void appendImedsDate(std::string &s, const HmdfDateFields &f) {
+  TextIO::appendInteger(s, f.year, 4, '0');
+  s += ' ';
+  TextIO::appendInteger(s, f.month, 2, '0');
+  s += ' ';
+  TextIO::appendInteger(s, f.day, 2, '0');
+  s += ' ';
+  TextIO::appendInteger(s, f.hour, 2, '0');
+  s += ' ';
+  TextIO::appendInteger(s, f.minute, 2, '0');
+  s += ' ';
+  TextIO::appendInteger(s, f.second, 2, '0');
+  s += ' ';
+}
+
+/**
+ * @brief Appends a date in the format produced by CDate::toString followed by
+ * the csv separator
+ */
+void appendCsvDate(std::string &s, const HmdfDateFields &f) {
+  TextIO::appendInteger(s, f.year, 4, '0');
+  s += '-';
+  TextIO::appendInteger(s, f.month, 2, '0');
+  s += '-';
+  TextIO::appendInteger(s, f.day, 2, '0');
+  s += ' ';
+  TextIO::appendInteger(s, f.hour, 2, '0');
+  s += ':';
+  TextIO::appendInteger(s, f.minute, 2, '0');
+  s += ':';
+  TextIO::appendInteger(s, f.second, 2, '0');
+  s += '.';
+  TextIO::appendInteger(s, f.millisecond, 4, '0');
+  s += ',';
+}
+
+/**
+ * @brief Parses the data lines and station headers of one block of an IMEDS
+ * file. Any line that is not a data record begins a new station
+ */
+void parseImedsBlock(const char *begin, const char *end, ImedsBlock &block) {
+  block.seconds.reserve(static_cast<size_t>(end - begin) / 32);
+  block.values.reserve(static_cast<size_t>(end - begin) / 32);
+  const char *p = begin;
+  while (p < end) {
+    auto line = TextIO::nextLine(p, end);
+    int year, month, day, hour, minute, second;
+    double value;
+    if (Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(
+            line.first, line.second, year, month, day, hour, minute, second,
+            value)) {
+      if (!isValidCivil(year, month, day)) {
+        block.invalidDate = true;
+        return;
+      }
+      block.seconds.push_back(daysFromCivil(year, month, day) * 86400 +
+                              static_cast<long long>(hour) * 3600 +
+                              static_cast<long long>(minute) * 60 + second);
+      block.values.push_back(value);
+    } else if (!TextIO::isBlank(line.first, line.second)) {
+      block.headerPosition.push_back(block.values.size());
+      block.headerLine.push_back(line);
+    }
+  }
+}
+
+/**
+ * @brief Splits a character range into blocks that begin on a line boundary
+ */
+std::vector<const char *> splitImedsBlocks(const char *begin, const char *end) {
+  const size_t size = static_cast<size_t>(end - begin);
+  size_t nblocks = 1;
+#ifdef _OPENMP
+  nblocks = static_cast<size_t>(omp_get_max_threads()) * 4;
+#endif
+  nblocks = std::max<size_t>(
+      1, std::min(nblocks, size / c_minImedsBlockSize));
+
+  std::vector<const char *> boundary(nblocks + 1, end);
+  boundary[0] = begin;
+  for (size_t i = 1; i < nblocks; ++i) {
+    const char *p = std::max(begin + i * (size / nblocks), boundary[i - 1]);
+    if (p != end && p != begin && *(p - 1) != '\n') {
+      const char *eol = static_cast<const char *>(
+          std::memchr(p, '\n', static_cast<size_t>(end - p)));
+      p = eol ? eol + 1 : end;
+    }
+    boundary[i] = p;
+  }
+  return boundary;
+}
+
+void parseImedsStationHeader(const char *begin, const char *end,
+                             Adcirc::Output::HmdfStation &station) {
+  std::string line =
+      Adcirc::FileIO::Generic::sanitizeString(std::string(begin, end));
+  std::vector<std::string> list;
+  Adcirc::FileIO::Generic::splitString(line, list);
+  if (list.size() < 3) {
+    adcircmodules_throw_exception("Hmdf: Invalid station header: " + line);
+  }
+  station.setName(list[0]);
+  station.setLongitude(stod(list[2]));
+  station.setLatitude(stod(list[1]));
+}
+
+}  // namespace
+
+Hmdf::Hmdf(bool isVector)
+    : m_isVector(isVector), m_columnar(false), m_numSnaps(0) {
+  this->init();
+}
 
 void Hmdf::init() {
   this->setHeader1("");
@@ -70,16 +309,29 @@ void Hmdf::reproject(int epsg) {
         "Error: Must define projection before reprojecting");
   }
 
-  Ezproj p;
+  if (this->m_station.empty()) {
+    this->setEpsg(epsg);
+    return;
+  }
+
+  std::vector<double> x(this->m_station.size());
+  std::vector<double> y(this->m_station.size());
+  for (size_t i = 0; i < this->m_station.size(); ++i) {
+    x[i] = this->m_station[i].longitude();
+    y[i] = this->m_station[i].latitude();
+  }
+
+  bool islatlon;
+  int ierr = Adcirc::Private::CoordinateTransform::reproject(this->m_epsg,
+                                                             epsg, x, y,
+                                                             islatlon);
+  if (ierr != Ezproj::NoError) {
+    adcircmodules_throw_exception("Hmdf: Proj4 library error");
+  }
 
-  for (auto &m : this->m_station) {
-    double x = m.longitude();
-    double y = m.latitude();
-    double outx, outy;
-    bool islatlon;
-    p.transform(this->m_epsg, epsg, x, y, outx, outy, islatlon);
-    m.setLongitude(outx);
-    m.setLatitude(outy);
+  for (size_t i = 0; i < this->m_station.size(); ++i) {
+    this->m_station[i].setLongitude(x[i]);
+    this->m_station[i].setLatitude(y[i]);
   }
   this->setEpsg(epsg);
   return;
@@ -89,6 +341,7 @@ bool Hmdf::isVector() const { return this->m_isVector; }
 
 void Hmdf::clear() {
   this->m_station.clear();
+  this->clearColumnar();
   this->init();
   return;
 }
@@ -135,6 +388,10 @@ void Hmdf::setStation(size_t index, HmdfStation &station) {
 }
 
 void Hmdf::addStation(const HmdfStation &station) {
+  if (this->m_columnar) {
+    adcircmodules_throw_exception(
+        "Cannot add stations after columnar storage has been allocated.");
+  }
   if (station.isVector() != this->m_isVector) {
     adcircmodules_throw_exception(
         "Cannot mix vector and scalar station types.");
@@ -142,6 +399,18 @@ void Hmdf::addStation(const HmdfStation &station) {
   this->m_station.push_back(station);
 }
 
+void Hmdf::addStation(HmdfStation &&station) {
+  if (this->m_columnar) {
+    adcircmodules_throw_exception(
+        "Cannot add stations after columnar storage has been allocated.");
+  }
+  if (station.isVector() != this->m_isVector) {
+    adcircmodules_throw_exception(
+        "Cannot mix vector and scalar station types.");
+  }
+  this->m_station.push_back(std::move(station));
+}
+
 bool Hmdf::success() const { return this->m_success; }
 
 void Hmdf::setSuccess(bool success) { this->m_success = success; }
@@ -150,59 +419,112 @@ bool Hmdf::null() const { return this->m_null; }
 
 void Hmdf::setNull(bool null) { this->m_null = null; }
 
+/**
+ * @brief Reads an IMEDS formatted file
+ * @param[in] filename name of the file to read
+ * @return 0 on success
+ *
+ * The file is mapped into memory and split into blocks on line boundaries
+ * that are parsed in parallel. The stations are assembled afterwards in file
+ * order, so the result is the same as reading the file line by line.
+ */
 int Hmdf::readImeds(const std::string &filename) {
   if (this->m_isVector) {
     adcircmodules_throw_exception(
         "imeds format files cannot contain vector data.");
   }
-  std::ifstream fid(filename.c_str());
-  if (fid.bad()) return -1;
-
-  //...Read Header
-  std::string templine;
-  std::getline(fid, templine);
-  this->m_header1 = Adcirc::FileIO::Generic::sanitizeString(templine);
-  std::getline(fid, templine);
-  this->m_header2 = Adcirc::FileIO::Generic::sanitizeString(templine);
-  std::getline(fid, templine);
-  this->m_header3 = Adcirc::FileIO::Generic::sanitizeString(templine);
-
-  //...Read Body
-  std::getline(fid, templine);
-
-  while (!fid.eof()) {
-    HmdfStation station(false);
+  if (this->m_columnar) {
+    adcircmodules_throw_exception(
+        "Cannot add stations after columnar storage has been allocated.");
+  }
 
-    templine = Adcirc::FileIO::Generic::sanitizeString(templine);
+  Adcirc::Private::MappedFile file;
+  if (!file.open(filename)) return -1;
 
-    std::vector<std::string> templist;
-    Adcirc::FileIO::Generic::splitString(templine, templist);
+  const char *p = file.data();
+  const char *end = file.end();
 
-    station.setName(templist[0]);
-    station.setLongitude(stod(templist[2]));
-    station.setLatitude(stod(templist[1]));
+  //...Read Header
+  auto line = TextIO::nextLine(p, end);
+  this->m_header1 = Adcirc::FileIO::Generic::sanitizeString(
+      std::string(line.first, line.second));
+  line = TextIO::nextLine(p, end);
+  this->m_header2 = Adcirc::FileIO::Generic::sanitizeString(
+      std::string(line.first, line.second));
+  line = TextIO::nextLine(p, end);
+  this->m_header3 = Adcirc::FileIO::Generic::sanitizeString(
+      std::string(line.first, line.second));
+
+  //...The first line of the body always begins a station
+  std::vector<std::pair<const char *, const char *>> headers;
+  while (p < end) {
+    line = TextIO::nextLine(p, end);
+    if (!TextIO::isBlank(line.first, line.second)) {
+      headers.push_back(line);
+      break;
+    }
+  }
 
-    while (!fid.eof()) {
-      std::getline(fid, templine);
+  //...Parse the remainder of the body in parallel
+  std::vector<const char *> boundary = splitImedsBlocks(p, end);
+  std::vector<ImedsBlock> blocks(boundary.size() - 1);
+  signed long long nblocks = static_cast<signed long long>(blocks.size());
 
-      int year, month, day, hour, minute, second;
-      double value;
+#pragma omp parallel for schedule(dynamic, 1) default(none) shared(blocks, boundary, nblocks)
+  for (signed long long i = 0; i < nblocks; ++i) {
+    parseImedsBlock(boundary[i], boundary[i + 1], blocks[i]);
+  }
 
-      bool status = Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(
-          templine, year, month, day, hour, minute, second, value);
+  //...Count the samples that belong to each station
+  std::vector<size_t> count(headers.size(), 0);
+  for (auto &b : blocks) {
+    if (b.invalidDate) adcircmodules_throw_exception("Invalid date");
+    size_t previous = 0;
+    for (size_t j = 0; j < b.headerPosition.size(); ++j) {
+      count.back() += b.headerPosition[j] - previous;
+      previous = b.headerPosition[j];
+      headers.push_back(b.headerLine[j]);
+      count.push_back(0);
+    }
+    if (!count.empty()) count.back() += b.values.size() - previous;
+  }
 
-      if (status) {
-        Adcirc::CDate d(year, month, day, hour, minute, second);
+  std::vector<HmdfStation> stations;
+  stations.reserve(headers.size());
+  for (size_t i = 0; i < headers.size(); ++i) {
+    stations.emplace_back(false);
+    parseImedsStationHeader(headers[i].first, headers[i].second, stations[i]);
+    stations[i].m_date.reserve(count[i]);
+    stations[i].m_data_u.reserve(count[i]);
+  }
 
-        //...Append to the station data
-        station.setNext(d, value);
-      } else {
-        break;
-      }
+  //...Move the samples into the stations
+  const auto epoch = hmdfEpoch();
+  size_t current = 0;
+  auto append = [&](const ImedsBlock &b, size_t first, size_t last) {
+    if (current >= stations.size()) return;
+    HmdfStation &s = stations[current];
+    for (size_t j = first; j < last; ++j) {
+      s.m_date.emplace_back(epoch + std::chrono::seconds(b.seconds[j]));
+      s.m_data_u.push_back(b.values[j]);
+    }
+  };
+
+  for (auto &b : blocks) {
+    size_t previous = 0;
+    for (size_t j = 0; j < b.headerPosition.size(); ++j) {
+      append(b, previous, b.headerPosition[j]);
+      previous = b.headerPosition[j];
+      current++;
     }
+    append(b, previous, b.values.size());
+    b = ImedsBlock();
+  }
 
-    //...Add the station
-    this->addStation(station);
+  //...Add the stations
+  this->m_station.reserve(this->m_station.size() + stations.size());
+  for (auto &s : stations) {
+    this->m_station.push_back(std::move(s));
   }
 
   this->setNull(false);
@@ -245,27 +567,50 @@ void Hmdf::copyStationList(Adcirc::Output::Hmdf &templateStations) {
 }
 
 int Hmdf::writeCsv(const std::string &filename) {
-  std::string value;
   std::ofstream out(filename);
 
+  //...Dates on the shared time axis are only formatted once
+  std::vector<std::string> prefix;
+  if (this->m_columnar) {
+    prefix.resize(this->m_numSnaps);
+    for (size_t i = 0; i < this->m_numSnaps; ++i) {
+      appendCsvDate(prefix[i], splitEpochMs(this->m_time[i]));
+    }
+  }
+
+  std::string block;
   for (size_t s = 0; s < this->nstations(); ++s) {
     out << boost::str(boost::format("Station %4.4i\n") % (s + 1));
     out << boost::str(boost::format("Datum: %s\n") % this->datum());
     out << boost::str(boost::format("Units: %s\n") % this->units());
 
-    for (size_t i = 0; i < this->station(s)->numSnaps(); i++) {
-      if (this->isVector()) {
-        double value1 = this->station(s)->data_u(i);
-        double value2 = this->station(s)->data_v(i);
-        out << boost::str(boost::format("%s,%10.4e,%10.4e\n") %
-                          this->station(s)->date(i).toString() % value1 %
-                          value2);
+    const HmdfStation &station = this->m_station[s];
+    const size_t n = this->m_columnar ? this->m_numSnaps : station.numSnaps();
+    const double *u = this->m_columnar
+                          ? this->m_values_u.data() + s * this->m_numSnaps
+                          : station.m_data_u.data();
+    const double *v = nullptr;
+    if (this->m_isVector) {
+      v = this->m_columnar ? this->m_values_v.data() + s * this->m_numSnaps
+                           : station.m_data_v.data();
+    }
+
+    block.clear();
+    block.reserve(n * (v ? 48 : 37));
+    for (size_t i = 0; i < n; ++i) {
+      if (this->m_columnar) {
+        block += prefix[i];
       } else {
-        double value = this->station(s)->data(i);
-        out << boost::str(boost::format("%s,%10.4e\n") %
-                          this->station(s)->date(i).toString() % value);
+        appendCsvDate(block, splitEpochMs(Hmdf::toEpochMs(station.m_date[i])));
+      }
+      appendScientific(block, u[i], 10, 4);
+      if (v) {
+        block += ',';
+        appendScientific(block, v[i], 10, 4);
       }
+      block += '\n';
     }
+    out.write(block.data(), static_cast<std::streamsize>(block.size()));
     out << "\n\n\n";
   }
   out.close();
@@ -273,7 +618,11 @@ int Hmdf::writeCsv(const std::string &filename) {
 }
 
 int Hmdf::writeImeds(const std::string &filename) {
-  std::string value;
+  if (this->m_isVector) {
+    adcircmodules_throw_exception(
+        "Attempt to retrieve scalar data from vector station.");
+  }
+
   std::ofstream out(filename);
 
   out << "% IMEDS generic format\n";
@@ -281,31 +630,89 @@ int Hmdf::writeImeds(const std::string &filename) {
   out << "% ADCIRCModules UTC " << this->datum() << " " << this->units()
       << "\n";
 
+  //...Dates on the shared time axis are only formatted once
+  std::vector<std::string> prefix;
+  if (this->m_columnar) {
+    prefix.resize(this->m_numSnaps);
+    for (size_t i = 0; i < this->m_numSnaps; ++i) {
+      appendImedsDate(prefix[i], splitEpochMs(this->m_time[i]));
+    }
+  }
+
+  std::string block;
   for (size_t s = 0; s < this->nstations(); ++s) {
-    std::string stationname = this->station(s)->name();
+    const HmdfStation &station = this->m_station[s];
+    std::string stationname = station.name();
     boost::algorithm::replace_all(stationname, " ", "_");
     boost::algorithm::replace_all(stationname, ",", "_");
     boost::algorithm::replace_all(stationname, "__", "_");
 
     out << boost::str(boost::format("%s   %16.10f   %16.10f\n") % stationname %
-                      this->station(s)->latitude() %
-                      this->station(s)->longitude());
-
-    for (size_t i = 0; i < this->station(s)->numSnaps(); ++i) {
-      double value = this->station(s)->data(i);
-      out << boost::str(
-          boost::format("%04.4i %02.2i %02.2i %02.2i %02.2i %02.2i %10.6e\n") %
-          this->station(s)->date(i).year() % this->station(s)->date(i).month() %
-          this->station(s)->date(i).day() % this->station(s)->date(i).hour() %
-          this->station(s)->date(i).minute() %
-          this->station(s)->date(i).second() % value);
+                      station.latitude() % station.longitude());
+
+    const size_t n = this->m_columnar ? this->m_numSnaps : station.numSnaps();
+    const double *u = this->m_columnar
+                          ? this->m_values_u.data() + s * this->m_numSnaps
+                          : station.m_data_u.data();
+
+    block.clear();
+    block.reserve(n * 34);
+    for (size_t i = 0; i < n; ++i) {
+      if (this->m_columnar) {
+        block += prefix[i];
+      } else {
+        appendImedsDate(block,
+                        splitEpochMs(Hmdf::toEpochMs(station.m_date[i])));
+      }
+      appendScientific(block, u[i], 10, 6);
+      block += '\n';
     }
+    out.write(block.data(), static_cast<std::streamsize>(block.size()));
   }
   out.close();
   return 0;
 }
 
-int Hmdf::writeNetcdf(const std::string &filename) {
+/**
+ * @brief Writes the stations to a netCDF file
+ * @param[in] filename name of the file to write
+ * @param[in] layout arrangement of the stations in the file
+ * @return 0 on success, otherwise a netCDF error code
+ *
+ * The station variables layout defines a time and data variable for each
+ * station. The other layouts follow the CF timeSeries feature type and store
+ * all stations in a single data variable, which avoids defining thousands of
+ * netCDF objects for large station lists. The ragged array layout stores the
+ * stations one after another with a row_size variable giving the number of
+ * samples in each. The orthogonal array layout stores a station by time
+ * array and requires that all stations share a time axis.
+ */
+int Hmdf::writeNetcdf(const std::string &filename, HmdfNetcdfLayout layout) {
+  if (this->m_isVector &&
+      (this->m_columnar || layout != HmdfNetcdfStationVariables)) {
+    adcircmodules_throw_exception(
+        "Attempt to retrieve scalar data from vector station.");
+  }
+
+  switch (layout) {
+    case HmdfNetcdfStationVariables:
+      return this->writeNetcdfStationVariables(filename);
+    case HmdfNetcdfRaggedArray:
+      return this->writeNetcdfTimeSeries(filename, false);
+    case HmdfNetcdfOrthogonalArray:
+      if (!this->hasSharedTimeAxis()) {
+        adcircmodules_throw_exception(
+            "Hmdf: The orthogonal netCDF layout requires that all stations "
+            "share a time axis");
+      }
+      return this->writeNetcdfTimeSeries(filename, true);
+    case HmdfNetcdfTimeSeries:
+      return this->writeNetcdfTimeSeries(filename, this->hasSharedTimeAxis());
+  }
+  return 1;
+}
+
+int Hmdf::writeNetcdfStationVariables(const std::string &filename) {
   int ncid;
   int dimid_nstations, dimid_stationNameLength;
   int varid_stationName, varid_stationx, varid_stationy;
@@ -319,37 +726,23 @@ int Hmdf::writeNetcdf(const std::string &filename) {
 
   //...Dimensions
   NCCHECK(nc_def_dim(ncid, "numStations", this->nstations(), &dimid_nstations))
-  NCCHECK(nc_def_dim(ncid, "stationNameLen", 200, &dimid_stationNameLength))
+  NCCHECK(nc_def_dim(ncid, "stationNameLen", c_netcdfNameLength,
+                     &dimid_stationNameLength))
   for (size_t i = 0; i < this->nstations(); i++) {
     std::string dimname =
         boost::str(boost::format("stationLength_%04.4i") % (i + 1));
     int d;
-    NCCHECK(nc_def_dim(ncid, dimname.c_str(), this->station(i)->numSnaps(), &d))
+    const size_t length =
+        this->m_columnar ? this->m_numSnaps : this->station(i)->numSnaps();
+    NCCHECK(nc_def_dim(ncid, dimname.c_str(), length, &d))
     dimid_stationLength.push_back(d);
   }
 
   //...Variables
-  int stationNameDims[2] = {dimid_nstations, dimid_stationNameLength};
-  int nstationDims[1] = {dimid_nstations};
-  int wgs84[1] = {4326};
-
-  NCCHECK(nc_def_var(ncid, "stationName", NC_CHAR, 2, stationNameDims,
-                     &varid_stationName))
-  NCCHECK(nc_def_var(ncid, "stationId", NC_CHAR, 2, stationNameDims,
-                     &varid_stationId))
-  NCCHECK(nc_def_var(ncid, "stationXCoordinate", NC_DOUBLE, 1, nstationDims,
-                     &varid_stationx))
-  NCCHECK(nc_def_var(ncid, "stationYCoordinate", NC_DOUBLE, 1, nstationDims,
-                     &varid_stationy))
-  NCCHECK(nc_put_att_text(ncid, varid_stationx, "HorizontalProjectionName", 5,
-                          "WGS84"))
-  NCCHECK(nc_put_att_text(ncid, varid_stationy, "HorizontalProjectionName", 5,
-                          "WGS84"))
-
-  NCCHECK(nc_put_att_int(ncid, varid_stationx, "HorizontalProjectionEPSG",
-                         NC_INT, 1, wgs84))
-  NCCHECK(nc_put_att_int(ncid, varid_stationy, "HorizontalProjectionEPSG",
-                         NC_INT, 1, wgs84))
+  int ierr = this->defineNetcdfStations(
+      ncid, dimid_nstations, dimid_stationNameLength, false, varid_stationName,
+      varid_stationId, varid_stationx, varid_stationy);
+  if (ierr != NC_NOERR) return ierr;
 
   for (size_t i = 0; i < this->nstations(); i++) {
     const int d[1] = {dimid_stationLength[i]};
@@ -392,6 +785,327 @@ int Hmdf::writeNetcdf(const std::string &filename) {
   }
 
   //...Metadata
+  ierr = Hmdf::putNetcdfGlobalMetadata(ncid);
+  if (ierr != NC_NOERR) return ierr;
+  NCCHECK(nc_enddef(ncid))
+
+  ierr = this->putNetcdfStations(ncid, c_netcdfNameLength, varid_stationName,
+                                 varid_stationId, varid_stationx,
+                                 varid_stationy);
+  if (ierr != NC_NOERR) return ierr;
+
+  //...The shared time axis is converted once in columnar mode
+  std::vector<long long> time;
+  if (this->m_columnar) {
+    time.resize(this->m_numSnaps);
+    for (size_t j = 0; j < this->m_numSnaps; ++j) {
+      time[j] = this->m_time[j] / 1000;
+    }
+  }
+
+  for (size_t i = 0; i < this->nstations(); i++) {
+    if (this->m_columnar) {
+      NCCHECK(nc_put_var_longlong(ncid, varid_stationDate[i], time.data()))
+      NCCHECK(nc_put_var_double(
+          ncid, varid_stationData[i],
+          this->m_values_u.data() + i * this->m_numSnaps))
+    } else {
+      std::vector<long long> stationTime(this->station(i)->numSnaps());
+      for (size_t j = 0; j < this->station(i)->numSnaps(); j++) {
+        stationTime[j] = this->station(i)->date(j).toSeconds();
+      }
+      NCCHECK(
+          nc_put_var_longlong(ncid, varid_stationDate[i], stationTime.data()))
+      NCCHECK(nc_put_var_double(ncid, varid_stationData[i],
+                                this->station(i)->allData().data()))
+    }
+  }
+
+  nc_close(ncid);
+
+  return 0;
+}
+
+int Hmdf::writeNetcdfTimeSeries(const std::string &filename,
+                                bool orthogonal) {
+  int ncid;
+  int dimid_nstations, dimid_stationNameLength, dimid_sample;
+  int varid_stationName, varid_stationx, varid_stationy, varid_stationId;
+  int varid_rowSize = -1, varid_time, varid_data;
+
+  const size_t nstations = this->nstations();
+  std::vector<long long> rowSize(nstations);
+  size_t nsample = 0;
+  for (size_t i = 0; i < nstations; ++i) {
+    rowSize[i] = static_cast<long long>(
+        this->m_columnar ? this->m_numSnaps : this->m_station[i].numSnaps());
+    nsample += rowSize[i];
+  }
+  const size_t ntime = orthogonal ? (nstations > 0 ? rowSize[0] : 0) : nsample;
+
+  //...Open file
+  NCCHECK(nc_create(filename.c_str(), NC_NETCDF4, &ncid))
+
+  //...Dimensions
+  NCCHECK(nc_def_dim(ncid, "numStations", nstations, &dimid_nstations))
+  NCCHECK(nc_def_dim(ncid, "stationNameLen", c_netcdfNameLength,
+                     &dimid_stationNameLength))
+  NCCHECK(nc_def_dim(ncid, orthogonal ? "time" : "numObservations", ntime,
+                     &dimid_sample))
+
+  //...Variables
+  int ierr = this->defineNetcdfStations(
+      ncid, dimid_nstations, dimid_stationNameLength, true, varid_stationName,
+      varid_stationId, varid_stationx, varid_stationy);
+  if (ierr != NC_NOERR) return ierr;
+
+  if (!orthogonal) {
+    const char sampleDimension[] = "numObservations";
+    const char longName[] = "number of observations for this station";
+    NCCHECK(nc_def_var(ncid, "row_size", NC_INT64, 1, &dimid_nstations,
+                       &varid_rowSize))
+    NCCHECK(nc_put_att_text(ncid, varid_rowSize, "long_name",
+                            strlen(longName), longName))
+    NCCHECK(nc_put_att_text(ncid, varid_rowSize, "sample_dimension",
+                            strlen(sampleDimension), sampleDimension))
+  }
+
+  //...Chunks hold one station of the orthogonal array or roughly one
+  //   station of the ragged array so each station can be read without
+  //   decompressing its neighbors
+  size_t sampleChunk = orthogonal || nstations == 0
+                           ? ntime
+                           : (nsample + nstations - 1) / nstations;
+  sampleChunk = std::min(std::max(sampleChunk, c_netcdfMinChunk),
+                         c_netcdfMaxChunk);
+  sampleChunk = std::max<size_t>(1, std::min(sampleChunk, ntime));
+
+  const char timeName[] = "time";
+  const char timeUnits[] = "seconds since 1970-01-01 00:00:00";
+  const char epoch[20] = "1970-01-01 00:00:00";
+  const char utc[4] = "utc";
+  const char calendar[] = "standard";
+  NCCHECK(nc_def_var(ncid, "time", NC_INT64, 1, &dimid_sample, &varid_time))
+  NCCHECK(nc_put_att_text(ncid, varid_time, "standard_name", strlen(timeName),
+                          timeName))
+  NCCHECK(nc_put_att_text(ncid, varid_time, "long_name", strlen(timeName),
+                          timeName))
+  NCCHECK(nc_put_att_text(ncid, varid_time, "units", strlen(timeUnits),
+                          timeUnits))
+  NCCHECK(nc_put_att_text(ncid, varid_time, "calendar", strlen(calendar),
+                          calendar))
+  NCCHECK(nc_put_att_text(ncid, varid_time, "referenceDate", 20, epoch))
+  NCCHECK(nc_put_att_text(ncid, varid_time, "timezone", 3, utc))
+  NCCHECK(nc_def_var_chunking(ncid, varid_time, NC_CHUNKED, &sampleChunk))
+  NCCHECK(nc_def_var_deflate(ncid, varid_time, 1, 1, 2))
+
+  const char dataName[] = "data";
+  const char coordinates[] = "time stationYCoordinate stationXCoordinate";
+  const double fill = HmdfStation::nullDataValue();
+  int dataDims[2] = {dimid_nstations, dimid_sample};
+  size_t dataChunk[2] = {1, sampleChunk};
+  if (orthogonal) {
+    NCCHECK(nc_def_var(ncid, "data", NC_DOUBLE, 2, dataDims, &varid_data))
+    NCCHECK(nc_def_var_chunking(ncid, varid_data, NC_CHUNKED, dataChunk))
+  } else {
+    NCCHECK(nc_def_var(ncid, "data", NC_DOUBLE, 1, &dimid_sample, &varid_data))
+    NCCHECK(nc_def_var_chunking(ncid, varid_data, NC_CHUNKED, &sampleChunk))
+  }
+  NCCHECK(nc_put_att_text(ncid, varid_data, "long_name", strlen(dataName),
+                          dataName))
+  NCCHECK(nc_put_att_text(ncid, varid_data, "coordinates",
+                          strlen(coordinates), coordinates))
+  NCCHECK(nc_put_att_text(ncid, varid_data, "units", this->units().length(),
+                          this->units().c_str()))
+  NCCHECK(nc_put_att_text(ncid, varid_data, "datum", this->datum().length(),
+                          this->datum().c_str()))
+  NCCHECK(nc_put_att_double(ncid, varid_data, "_FillValue", NC_DOUBLE, 1,
+                            &fill))
+  NCCHECK(nc_def_var_deflate(ncid, varid_data, 1, 1, 2))
+
+  //...Metadata
+  const char featureType[] = "timeSeries";
+  const char conventions[] = "CF-1.7";
+  NCCHECK(nc_put_att_text(ncid, NC_GLOBAL, "featureType", strlen(featureType),
+                          featureType))
+  NCCHECK(nc_put_att_text(ncid, NC_GLOBAL, "Conventions", strlen(conventions),
+                          conventions))
+  ierr = Hmdf::putNetcdfGlobalMetadata(ncid);
+  if (ierr != NC_NOERR) return ierr;
+  NCCHECK(nc_enddef(ncid))
+
+  ierr = this->putNetcdfStations(ncid, c_netcdfNameLength, varid_stationName,
+                                 varid_stationId, varid_stationx,
+                                 varid_stationy);
+  if (ierr != NC_NOERR) return ierr;
+
+  if (!orthogonal) {
+    NCCHECK(nc_put_var_longlong(ncid, varid_rowSize, rowSize.data()))
+  }
+
+  //...The shared time axis is converted once in columnar mode
+  std::vector<long long> time;
+  if (this->m_columnar) {
+    time.resize(this->m_numSnaps);
+    for (size_t j = 0; j < this->m_numSnaps; ++j) {
+      time[j] = this->m_time[j] / 1000;
+    }
+  }
+
+  if (orthogonal) {
+    if (!this->m_columnar && nstations > 0) {
+      time.resize(ntime);
+      for (size_t j = 0; j < ntime; ++j) {
+        time[j] = this->m_station[0].m_date[j].toSeconds();
+      }
+    }
+    if (ntime > 0) {
+      NCCHECK(nc_put_var_longlong(ncid, varid_time, time.data()))
+    }
+    if (this->m_columnar && ntime > 0) {
+      NCCHECK(nc_put_var_double(ncid, varid_data, this->m_values_u.data()))
+    } else if (ntime > 0) {
+      for (size_t i = 0; i < nstations; ++i) {
+        size_t start[2] = {i, 0};
+        size_t count[2] = {1, ntime};
+        NCCHECK(nc_put_vara_double(ncid, varid_data, start, count,
+                                   this->m_station[i].m_data_u.data()))
+      }
+    }
+  } else {
+    std::vector<long long> stationTime;
+    size_t offset = 0;
+    for (size_t i = 0; i < nstations; ++i) {
+      size_t start[1] = {offset};
+      size_t count[1] = {static_cast<size_t>(rowSize[i])};
+      offset += count[0];
+      if (count[0] == 0) continue;
+
+      const double *data;
+      if (this->m_columnar) {
+        NCCHECK(
+            nc_put_vara_longlong(ncid, varid_time, start, count, time.data()))
+        data = this->m_values_u.data() + i * this->m_numSnaps;
+      } else {
+        const HmdfStation &station = this->m_station[i];
+        stationTime.resize(count[0]);
+        for (size_t j = 0; j < count[0]; ++j) {
+          stationTime[j] = station.m_date[j].toSeconds();
+        }
+        NCCHECK(nc_put_vara_longlong(ncid, varid_time, start, count,
+                                     stationTime.data()))
+        data = station.m_data_u.data();
+      }
+      NCCHECK(nc_put_vara_double(ncid, varid_data, start, count, data))
+    }
+  }
+
+  nc_close(ncid);
+
+  return 0;
+}
+
+/**
+ * @brief Defines the station name, id and coordinate variables
+ * @param[in] ncid netCDF file id
+ * @param[in] dimid_nstations station dimension
+ * @param[in] dimid_stationNameLength station name length dimension
+ * @param[in] cf add the attributes used by the CF timeSeries feature type
+ * @param[out] varid_stationName station name variable
+ * @param[out] varid_stationId station id variable
+ * @param[out] varid_stationx station x coordinate variable
+ * @param[out] varid_stationy station y coordinate variable
+ * @return netCDF error code
+ */
+int Hmdf::defineNetcdfStations(int ncid, int dimid_nstations,
+                               int dimid_stationNameLength, bool cf,
+                               int &varid_stationName, int &varid_stationId,
+                               int &varid_stationx, int &varid_stationy) {
+  int stationNameDims[2] = {dimid_nstations, dimid_stationNameLength};
+  int nstationDims[1] = {dimid_nstations};
+  int wgs84[1] = {4326};
+
+  NCCHECK(nc_def_var(ncid, "stationName", NC_CHAR, 2, stationNameDims,
+                     &varid_stationName))
+  NCCHECK(nc_def_var(ncid, "stationId", NC_CHAR, 2, stationNameDims,
+                     &varid_stationId))
+  NCCHECK(nc_def_var(ncid, "stationXCoordinate", NC_DOUBLE, 1, nstationDims,
+                     &varid_stationx))
+  NCCHECK(nc_def_var(ncid, "stationYCoordinate", NC_DOUBLE, 1, nstationDims,
+                     &varid_stationy))
+  NCCHECK(nc_put_att_text(ncid, varid_stationx, "HorizontalProjectionName", 5,
+                          "WGS84"))
+  NCCHECK(nc_put_att_text(ncid, varid_stationy, "HorizontalProjectionName", 5,
+                          "WGS84"))
+
+  NCCHECK(nc_put_att_int(ncid, varid_stationx, "HorizontalProjectionEPSG",
+                         NC_INT, 1, wgs84))
+  NCCHECK(nc_put_att_int(ncid, varid_stationy, "HorizontalProjectionEPSG",
+                         NC_INT, 1, wgs84))
+
+  if (cf) {
+    const char role[] = "timeseries_id";
+    const char lon[] = "longitude";
+    const char lat[] = "latitude";
+    const char east[] = "degrees_east";
+    const char north[] = "degrees_north";
+    NCCHECK(
+        nc_put_att_text(ncid, varid_stationName, "cf_role", strlen(role), role))
+    NCCHECK(nc_put_att_text(ncid, varid_stationx, "standard_name", strlen(lon),
+                            lon))
+    NCCHECK(
+        nc_put_att_text(ncid, varid_stationx, "units", strlen(east), east))
+    NCCHECK(nc_put_att_text(ncid, varid_stationy, "standard_name", strlen(lat),
+                            lat))
+    NCCHECK(
+        nc_put_att_text(ncid, varid_stationy, "units", strlen(north), north))
+  }
+  return NC_NOERR;
+}
+
+/**
+ * @brief Writes the station names, ids and coordinates with one call per
+ * variable
+ * @param[in] ncid netCDF file id
+ * @param[in] nameLength length of the station name dimension
+ * @param[in] varid_stationName station name variable
+ * @param[in] varid_stationId station id variable
+ * @param[in] varid_stationx station x coordinate variable
+ * @param[in] varid_stationy station y coordinate variable
+ * @return netCDF error code
+ */
+int Hmdf::putNetcdfStations(int ncid, size_t nameLength, int varid_stationName,
+                            int varid_stationId, int varid_stationx,
+                            int varid_stationy) {
+  const size_t nstations = this->nstations();
+  if (nstations == 0) return NC_NOERR;
+
+  std::vector<double> x(nstations), y(nstations);
+  std::string names(nstations * nameLength, '\0');
+  std::string ids(nstations * nameLength, '\0');
+  for (size_t i = 0; i < nstations; ++i) {
+    const HmdfStation &s = this->m_station[i];
+    x[i] = s.longitude();
+    y[i] = s.latitude();
+    s.m_name.copy(&names[i * nameLength],
+                  std::min(s.m_name.size(), nameLength));
+    s.m_id.copy(&ids[i * nameLength], std::min(s.m_id.size(), nameLength));
+  }
+
+  NCCHECK(nc_put_var_double(ncid, varid_stationx, x.data()))
+  NCCHECK(nc_put_var_double(ncid, varid_stationy, y.data()))
+  NCCHECK(nc_put_var_text(ncid, varid_stationName, &names[0]))
+  NCCHECK(nc_put_var_text(ncid, varid_stationId, &ids[0]))
+  return NC_NOERR;
+}
+
+/**
+ * @brief Writes the global attributes that describe where and when the file
+ * was created
+ * @param[in] ncid netCDF file id
+ * @return netCDF error code
+ */
+int Hmdf::putNetcdfGlobalMetadata(int ncid) {
 #if defined(__unix__) || defined(__APPLE__)
   char hostname[256];
   gethostname(hostname, 256);
@@ -430,38 +1144,11 @@ int Hmdf::writeNetcdf(const std::string &filename) {
                      ncVersion.length(), ncVersion.c_str()))
   NCCHECK(nc_put_att(ncid, NC_GLOBAL, "fileformat", NC_CHAR, format.length(),
                      format.c_str()))
-  NCCHECK(nc_enddef(ncid))
-
-  for (size_t i = 0; i < this->nstations(); i++) {
-    size_t index[] = {i, 0};
-    size_t stindex[] = {i};
-    size_t count[] = {1, this->station(i)->name().size()};
-    double lat[] = {this->station(i)->latitude()};
-    double lon[] = {this->station(i)->longitude()};
-
-    std::vector<long long> time(this->station(i)->numSnaps());
-    for (size_t j = 0; j < this->station(i)->numSnaps(); j++) {
-      time[j] = this->station(i)->date(j).toSeconds();
-    }
-
-    NCCHECK(nc_put_var1_double(ncid, varid_stationx, stindex, lon))
-    NCCHECK(nc_put_var1_double(ncid, varid_stationy, stindex, lat))
-    NCCHECK(nc_put_var_longlong(ncid, varid_stationDate[i], time.data()))
-    NCCHECK(nc_put_var_double(ncid, varid_stationData[i],
-                              this->station(i)->allData().data()))
-    NCCHECK(nc_put_vara_text(ncid, varid_stationName, index, count,
-                             &this->station(i)->name()[0]))
-    NCCHECK(nc_put_vara_text(ncid, varid_stationId, index, count,
-                             &this->station(i)->id()[0]))
-  }
-
-  nc_close(ncid);
-
-  return 0;
+  return NC_NOERR;
 }
 
 int Hmdf::writeAdcirc(const std::string &filename) {
-  if (this->nstations() > 1) {
+  if (this->nstations() > 1 && !this->m_columnar) {
     for (size_t i = 1; i < this->nstations(); ++i) {
       if (this->m_station[0].numSnaps() != this->m_station[i].numSnaps()) {
         adcircmodules_throw_exception(
@@ -485,25 +1172,40 @@ int Hmdf::writeAdcirc(const std::string &filename) {
     out << this->header1() << std::endl;
   }
 
-  double dt = this->station(0)->date(1).toSeconds() -
-              this->station(0)->date(0).toSeconds();
+  const size_t nsnap =
+      this->m_columnar ? this->m_numSnaps : this->station(0)->numSnaps();
+  auto seconds = [&](size_t i) -> long {
+    return this->m_columnar
+               ? static_cast<long>(this->m_time[i] / 1000)
+               : this->station(0)->date(i).toSeconds();
+  };
+  auto value_u = [&](size_t station, size_t i) -> double {
+    return this->m_columnar ? this->m_values_u[station * nsnap + i]
+                            : this->isVector() ? this->station(station)->data_u(i)
+                                               : this->station(station)->data(i);
+  };
+  auto value_v = [&](size_t station, size_t i) -> double {
+    return this->m_columnar ? this->m_values_v[station * nsnap + i]
+                            : this->station(station)->data_v(i);
+  };
+
+  double dt = seconds(1) - seconds(0);
   int dit = static_cast<int>(std::floor(dt));
 
   int nv = this->isVector() ? 2 : 1;
-  out << Adcirc::Output::Formatting::adcircFileHeader(
-      this->station(0)->numSnaps(), this->nstations(), dt, dit, nv);
-  for (size_t i = 0; i < this->station(0)->numSnaps(); ++i) {
-    double t = this->station(0)->date(i).toSeconds() -
-               this->station(0)->date(0).toSeconds() + dt;
+  out << Adcirc::Output::Formatting::adcircFileHeader(nsnap, this->nstations(),
+                                                      dt, dit, nv);
+  for (size_t i = 0; i < nsnap; ++i) {
+    double t = seconds(i) - seconds(0) + dt;
     int it = static_cast<int>(std::floor(t));
     out << Adcirc::Output::Formatting::adcircFullFormatRecordHeader(t, it);
     for (size_t j = 0; j < this->nstations(); ++j) {
       if (this->isVector()) {
         out << Adcirc::Output::Formatting::adcircVectorLineFormat(
-            j + 1, this->station(j)->data_u(i), this->station(j)->data_v(i));
+            j + 1, value_u(j, i), value_v(j, i));
       } else {
         out << Adcirc::Output::Formatting::adcircScalarLineFormat(
-            j + 1, this->station(j)->data(i));
+            j + 1, value_u(j, i));
       }
     }
   }
@@ -571,7 +1273,215 @@ void Hmdf::dataBounds(CDate &dateMin, CDate &dateMax, double &minValue,
 
 void Hmdf::setVector(bool vector) {
   this->m_isVector = vector;
+  this->clearColumnar();
   for (auto &s : this->m_station) {
     s.setVector(vector);
   }
 }
+
+/**
+ * @brief Allocates columnar storage for all stations. A single time axis is
+ * shared by the stations and the values are stored in a contiguous stations x
+ * times matrix, avoiding per-station growth as snaps are added. The stations
+ * must be added before calling this function
+ * @param[in] numSnaps number of snaps stored for each station
+ * @param[in] fillValue initial value of every entry
+ */
+void Hmdf::allocate(size_t numSnaps, double fillValue) {
+  this->m_columnar = true;
+  this->m_numSnaps = numSnaps;
+  this->m_time.assign(numSnaps, 0);
+  this->m_values_u.assign(this->nstations() * numSnaps, fillValue);
+  if (this->m_isVector) {
+    this->m_values_v.assign(this->nstations() * numSnaps, fillValue);
+  } else {
+    this->m_values_v.clear();
+  }
+}
+
+/**
+ * @brief Checks if every station has the same set of time snaps. Columnar
+ * storage always has a shared time axis. Otherwise the dates of each station
+ * are compared with the first station
+ * @return true if the stations share a time axis, which is required by the
+ * orthogonal array netCDF layout
+ */
+bool Hmdf::hasSharedTimeAxis() const {
+  if (this->m_columnar || this->m_station.size() < 2) return true;
+  const std::vector<CDate> &reference = this->m_station[0].m_date;
+  for (size_t i = 1; i < this->m_station.size(); ++i) {
+    const std::vector<CDate> &date = this->m_station[i].m_date;
+    if (date.size() != reference.size()) return false;
+    for (size_t j = 0; j < date.size(); ++j) {
+      if (date[j] != reference[j]) return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns true if the data is held in columnar storage
+ * @return columnar storage status
+ */
+bool Hmdf::isColumnar() const { return this->m_columnar; }
+
+/**
+ * @brief Number of snaps held in columnar storage
+ * @return number of snaps
+ */
+size_t Hmdf::numSnaps() const { return this->m_numSnaps; }
+
+void Hmdf::clearColumnar() {
+  this->m_columnar = false;
+  this->m_numSnaps = 0;
+  this->m_time.clear();
+  this->m_values_u.clear();
+  this->m_values_v.clear();
+  this->m_time.shrink_to_fit();
+  this->m_values_u.shrink_to_fit();
+  this->m_values_v.shrink_to_fit();
+}
+
+/**
+ * @brief Copies the columnar storage into the individual stations so that the
+ * station level accessors can be used, then releases the columnar storage
+ */
+void Hmdf::toStations() {
+  if (!this->m_columnar) return;
+  std::vector<CDate> dates(this->m_numSnaps);
+  for (size_t i = 0; i < this->m_numSnaps; ++i) {
+    dates[i] = Hmdf::fromEpochMs(this->m_time[i]);
+  }
+  for (size_t s = 0; s < this->nstations(); ++s) {
+    auto first = this->m_values_u.begin() + s * this->m_numSnaps;
+    this->m_station[s].setDate(dates);
+    if (this->m_isVector) {
+      auto first_v = this->m_values_v.begin() + s * this->m_numSnaps;
+      this->m_station[s].setData(
+          std::vector<double>(first, first + this->m_numSnaps),
+          std::vector<double>(first_v, first_v + this->m_numSnaps));
+    } else {
+      this->m_station[s].setData(
+          std::vector<double>(first, first + this->m_numSnaps));
+    }
+  }
+  this->clearColumnar();
+}
+
+/**
+ * @brief Sets the date of a snap on the shared time axis
+ * @param[in] snap snap index
+ * @param[in] date date of the snap
+ */
+void Hmdf::setTime(size_t snap, const CDate &date) {
+  assert(snap < this->m_numSnaps);
+  if (snap < this->m_numSnaps) this->m_time[snap] = Hmdf::toEpochMs(date);
+}
+
+/**
+ * @brief Returns the time of a snap on the shared time axis
+ * @param[in] snap snap index
+ * @return milliseconds since 1970-01-01 00:00:00
+ */
+long long Hmdf::time(size_t snap) const {
+  assert(snap < this->m_numSnaps);
+  if (snap < this->m_numSnaps) return this->m_time[snap];
+  adcircmodules_throw_exception("Hmdf: Snap index out of range");
+  return 0;
+}
+
+/**
+ * @brief Returns the date of a snap on the shared time axis
+ * @param[in] snap snap index
+ * @return date
+ */
+Adcirc::CDate Hmdf::date(size_t snap) const {
+  return Hmdf::fromEpochMs(this->time(snap));
+}
+
+/**
+ * @brief Sets a scalar value in columnar storage. This function does not
+ * throw so that it may be called from multiple threads for different entries
+ * @param[in] station station index
+ * @param[in] snap snap index
+ * @param[in] value value
+ */
+void Hmdf::setValue(size_t station, size_t snap, double value) {
+  assert(station < this->nstations() && snap < this->m_numSnaps);
+  assert(!this->m_isVector);
+  const size_t index = station * this->m_numSnaps + snap;
+  if (index < this->m_values_u.size()) this->m_values_u[index] = value;
+}
+
+/**
+ * @brief Sets a vector value in columnar storage. This function does not
+ * throw so that it may be called from multiple threads for different entries
+ * @param[in] station station index
+ * @param[in] snap snap index
+ * @param[in] value_u u component
+ * @param[in] value_v v component
+ */
+void Hmdf::setValue(size_t station, size_t snap, double value_u,
+                    double value_v) {
+  assert(station < this->nstations() && snap < this->m_numSnaps);
+  assert(this->m_isVector);
+  const size_t index = station * this->m_numSnaps + snap;
+  if (index < this->m_values_v.size()) {
+    this->m_values_u[index] = value_u;
+    this->m_values_v[index] = value_v;
+  }
+}
+
+/**
+ * @brief Returns a scalar value from columnar storage
+ * @param[in] station station index
+ * @param[in] snap snap index
+ * @return value
+ */
+double Hmdf::value(size_t station, size_t snap) const {
+  if (this->m_isVector) {
+    adcircmodules_throw_exception(
+        "Attempt to retrieve scalar data from vector station.");
+  }
+  return this->value_u(station, snap);
+}
+
+/**
+ * @brief Returns the u component of a value from columnar storage
+ * @param[in] station station index
+ * @param[in] snap snap index
+ * @return u component
+ */
+double Hmdf::value_u(size_t station, size_t snap) const {
+  if (station >= this->nstations() || snap >= this->m_numSnaps) {
+    adcircmodules_throw_exception("Hmdf: Index out of range");
+  }
+  return this->m_values_u[station * this->m_numSnaps + snap];
+}
+
+/**
+ * @brief Returns the v component of a value from columnar storage
+ * @param[in] station station index
+ * @param[in] snap snap index
+ * @return v component
+ */
+double Hmdf::value_v(size_t station, size_t snap) const {
+  if (!this->m_isVector) {
+    adcircmodules_throw_exception(
+        "Attempt to retrieve vector data from scalar station.");
+  }
+  if (station >= this->nstations() || snap >= this->m_numSnaps) {
+    adcircmodules_throw_exception("Hmdf: Index out of range");
+  }
+  return this->m_values_v[station * this->m_numSnaps + snap];
+}
+
+long long Hmdf::toEpochMs(const CDate &date) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             date.time_point() - hmdfEpoch())
+      .count();
+}
+
+Adcirc::CDate Hmdf::fromEpochMs(long long ms) {
+  return CDate(hmdfEpoch() + std::chrono::milliseconds(ms));
+}
@@ -19,6 +19,7 @@
 #ifndef ADCMOD_HMDF_H
 #define ADCMOD_HMDF_H
 
+#include <iosfwd>
 #include <limits>
 #include <string>
 #include <vector>
@@ -38,12 +39,24 @@ class Hmdf {
 
   enum HmdfFileType { HmdfImeds, HmdfCsv, HmdfNetCdf, HmdfAdcirc };
 
+  /// Arrangement of the stations in netCDF files. HmdfNetcdfTimeSeries
+  /// selects the orthogonal layout when the stations share a time axis and
+  /// the ragged layout otherwise
+  enum HmdfNetcdfLayout {
+    HmdfNetcdfStationVariables,
+    HmdfNetcdfRaggedArray,
+    HmdfNetcdfOrthogonalArray,
+    HmdfNetcdfTimeSeries
+  };
+
   int ADCIRCMODULES_EXPORT write(const std::string &filename,
                                  HmdfFileType fileType);
   int ADCIRCMODULES_EXPORT write(const std::string &filename);
   int ADCIRCMODULES_EXPORT writeImeds(const std::string &filename);
   int ADCIRCMODULES_EXPORT writeCsv(const std::string &filename);
-  int ADCIRCMODULES_EXPORT writeNetcdf(const std::string &filename);
+  int ADCIRCMODULES_EXPORT
+  writeNetcdf(const std::string &filename,
+              HmdfNetcdfLayout layout = HmdfNetcdfStationVariables);
   int ADCIRCMODULES_EXPORT writeAdcirc(const std::string &filename);
 
   int ADCIRCMODULES_EXPORT readImeds(const std::string &filename);
@@ -76,6 +89,9 @@ class Hmdf {
                                       Adcirc::Output::HmdfStation &station);
   void ADCIRCMODULES_EXPORT addStation(
       const Adcirc::Output::HmdfStation &station);
+#ifndef SWIG
+  void ADCIRCMODULES_EXPORT addStation(Adcirc::Output::HmdfStation &&station);
+#endif
 
   bool ADCIRCMODULES_EXPORT success() const;
   void ADCIRCMODULES_EXPORT setSuccess(bool success);
@@ -90,6 +106,8 @@ class Hmdf {
   void ADCIRCMODULES_EXPORT setVector(bool vector);
   bool ADCIRCMODULES_EXPORT isVector() const;
 
+  bool ADCIRCMODULES_EXPORT hasSharedTimeAxis() const;
+
   static Adcirc::Output::Hmdf::HmdfFileType ADCIRCMODULES_EXPORT
   getFiletype(const std::string &filename);
 
@@ -98,8 +116,39 @@ class Hmdf {
 
   void ADCIRCMODULES_EXPORT reproject(int epsg);
 
+  void ADCIRCMODULES_EXPORT
+  allocate(size_t numSnaps,
+           double fillValue = Adcirc::Output::HmdfStation::nullDataValue());
+  bool ADCIRCMODULES_EXPORT isColumnar() const;
+  size_t ADCIRCMODULES_EXPORT numSnaps() const;
+  void ADCIRCMODULES_EXPORT toStations();
+
+  void ADCIRCMODULES_EXPORT setTime(size_t snap, const Adcirc::CDate &date);
+  long long ADCIRCMODULES_EXPORT time(size_t snap) const;
+  Adcirc::CDate ADCIRCMODULES_EXPORT date(size_t snap) const;
+
+  void ADCIRCMODULES_EXPORT setValue(size_t station, size_t snap, double value);
+  void ADCIRCMODULES_EXPORT setValue(size_t station, size_t snap,
+                                     double value_u, double value_v);
+  double ADCIRCMODULES_EXPORT value(size_t station, size_t snap) const;
+  double ADCIRCMODULES_EXPORT value_u(size_t station, size_t snap) const;
+  double ADCIRCMODULES_EXPORT value_v(size_t station, size_t snap) const;
+
  private:
   void init();
+  void clearColumnar();
+  int writeNetcdfStationVariables(const std::string &filename);
+  int writeNetcdfTimeSeries(const std::string &filename, bool orthogonal);
+  int defineNetcdfStations(int ncid, int dimid_nstations,
+                           int dimid_stationNameLength, bool cf,
+                           int &varid_stationName, int &varid_stationId,
+                           int &varid_stationx, int &varid_stationy);
+  int putNetcdfStations(int ncid, size_t nameLength, int varid_stationName,
+                        int varid_stationId, int varid_stationx,
+                        int varid_stationy);
+  static int putNetcdfGlobalMetadata(int ncid);
+  static long long toEpochMs(const Adcirc::CDate &date);
+  static Adcirc::CDate fromEpochMs(long long ms);
 
   //...Variables
   bool m_success, m_null, m_isVector;
@@ -112,6 +161,14 @@ class Hmdf {
   std::string m_units;
   std::string m_datum;
   std::vector<Adcirc::Output::HmdfStation> m_station;
+
+  //...Columnar storage, one shared time axis and a stations x times matrix
+  //   for each vector component
+  bool m_columnar;
+  size_t m_numSnaps;
+  std::vector<long long> m_time;
+  std::vector<double> m_values_u;
+  std::vector<double> m_values_v;
 };
 
 }  // namespace Output
@@ -140,6 +140,21 @@ void HmdfStation::setData(const double &data, size_t index) {
   if (index < this->numSnaps()) this->m_data_u[index] = data;
 }
 
+void HmdfStation::setData(const double &data_u, const double &data_v,
+                          size_t index) {
+  assert(index < this->numSnaps());
+  assert(this->m_isVector);
+  if (!this->m_isVector) {
+    adcircmodules_throw_exception(
+        "Attempt to assign vector data to scalar station.");
+    return;
+  }
+  if (index < this->numSnaps()) {
+    this->m_data_u[index] = data_u;
+    this->m_data_v[index] = data_v;
+  }
+}
+
 void HmdfStation::setDate(const Adcirc::CDate &date, size_t index) {
   assert(index < this->numSnaps());
   if (index < this->numSnaps()) this->m_date[index] = date;
@@ -31,6 +31,9 @@ namespace Adcirc {
 
 namespace Output {
 
+class Hmdf;
+class NetcdfTimeseries;
+
 class HmdfStation {
  public:
   struct Coordinate {
@@ -89,6 +92,8 @@ class HmdfStation {
   double ADCIRCMODULES_EXPORT data_v(size_t index) const;
 
   void ADCIRCMODULES_EXPORT setData(const double &data, size_t index);
+  void ADCIRCMODULES_EXPORT setData(const double &data_u, const double &data_v,
+                                    size_t index);
   void ADCIRCMODULES_EXPORT setData(const std::vector<double> &data);
   void ADCIRCMODULES_EXPORT setData(const std::vector<float> &data);
   void ADCIRCMODULES_EXPORT setData(const std::vector<double> &data_u,
@@ -120,6 +125,8 @@ class HmdfStation {
                                      const double maxValid);
 
  private:
+  friend class Hmdf;
+  friend class NetcdfTimeseries;
 
   std::tuple<double, double> getVectorBounds(const std::vector<double> &v);
 
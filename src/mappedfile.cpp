@@ -0,0 +1,123 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "mappedfile.h"
+
+#include <fstream>
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+#define ADCMOD_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace Adcirc::Private;
+
+MappedFile::MappedFile()
+    : m_data(nullptr), m_size(0), m_open(false), m_mapped(false) {}
+
+MappedFile::MappedFile(const std::string &filename)
+    : m_data(nullptr), m_size(0), m_open(false), m_mapped(false) {
+  this->open(filename);
+}
+
+MappedFile::~MappedFile() { this->close(); }
+
+/**
+ * @brief Opens a file and makes its contents available through data()
+ * @param[in] filename name of the file to open
+ * @return true if the file was opened
+ *
+ * Empty files are reported as open with a size of zero
+ */
+bool MappedFile::open(const std::string &filename) {
+  this->close();
+
+#ifdef ADCMOD_USE_MMAP
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    return false;
+  }
+
+  this->m_size = static_cast<size_t>(st.st_size);
+  if (this->m_size > 0) {
+    void *map = ::mmap(nullptr, this->m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+      ::madvise(map, this->m_size, MADV_SEQUENTIAL);
+#endif
+      this->m_data = static_cast<const char *>(map);
+      this->m_mapped = true;
+    }
+  }
+  ::close(fd);
+
+  if (this->m_size == 0 || this->m_mapped) {
+    this->m_open = true;
+    return true;
+  }
+#endif
+
+  //...Fall back to reading the file into memory
+  std::ifstream fid(filename, std::ios::binary | std::ios::ate);
+  if (!fid.is_open()) return false;
+  std::streamoff length = fid.tellg();
+  if (length < 0) return false;
+  fid.seekg(0, std::ios::beg);
+
+  this->m_buffer.resize(static_cast<size_t>(length));
+  if (length > 0 && !fid.read(this->m_buffer.data(), length)) {
+    this->m_buffer.clear();
+    return false;
+  }
+
+  this->m_data = this->m_buffer.data();
+  this->m_size = this->m_buffer.size();
+  this->m_open = true;
+  return true;
+}
+
+void MappedFile::close() {
+#ifdef ADCMOD_USE_MMAP
+  if (this->m_mapped) {
+    ::munmap(const_cast<char *>(this->m_data), this->m_size);
+  }
+#endif
+  this->m_buffer.clear();
+  this->m_buffer.shrink_to_fit();
+  this->m_data = nullptr;
+  this->m_size = 0;
+  this->m_open = false;
+  this->m_mapped = false;
+}
+
+bool MappedFile::isOpen() const { return this->m_open; }
+
+bool MappedFile::isMapped() const { return this->m_mapped; }
+
+const char *MappedFile::data() const { return this->m_data; }
+
+const char *MappedFile::end() const { return this->m_data + this->m_size; }
+
+size_t MappedFile::size() const { return this->m_size; }
@@ -0,0 +1,70 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_MAPPEDFILE_H
+#define ADCMOD_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class MappedFile
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Read-only view of the contents of a file on disk
+ *
+ * On POSIX systems the file is memory mapped so that large text files can be
+ * scanned without copying through stream buffers. On other platforms the
+ * file is read into memory with a single call.
+ */
+class MappedFile {
+ public:
+  MappedFile();
+  explicit MappedFile(const std::string &filename);
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  bool open(const std::string &filename);
+  void close();
+
+  bool isOpen() const;
+  bool isMapped() const;
+
+  const char *data() const;
+  const char *end() const;
+  size_t size() const;
+
+ private:
+  const char *m_data;
+  size_t m_size;
+  bool m_open;
+  bool m_mapped;
+  std::vector<char> m_buffer;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_MAPPEDFILE_H
@@ -328,6 +328,34 @@ void Mesh::toWeirPolygonShapefile(const std::string &outputFile) {
   this->m_impl->toWeirPolygonShapefile(outputFile);
 }
 
+/**
+ * @brief Writes the mesh nodes into FlatGeobuf format. Nodes are ordered along
+ * a Hilbert curve and a packed R-tree spatial index is included
+ * @param[in] outputFile output file with .fgb extension
+ */
+void Mesh::toNodeFlatGeobuf(const std::string &outputFile) {
+  this->m_impl->toNodeFlatGeobuf(outputFile);
+}
+
+/**
+ * @brief Writes the mesh elements as polygons into FlatGeobuf format. Elements
+ * are ordered along a Hilbert curve and a packed R-tree spatial index is
+ * included
+ * @param[in] outputFile output file with .fgb extension
+ */
+void Mesh::toElementFlatGeobuf(const std::string &outputFile) {
+  this->m_impl->toElementFlatGeobuf(outputFile);
+}
+
+/**
+ * @brief Writes the boundary conditions of the mesh into FlatGeobuf format as
+ * lines
+ * @param[in] outputFile output file with .fgb extension
+ */
+void Mesh::toBoundaryFlatGeobuf(const std::string &outputFile) {
+  this->m_impl->toBoundaryFlatGeobuf(outputFile);
+}
+
 /**
  * @brief Builds a kd-tree object with the mesh nodes as the search locations
  */
@@ -519,6 +547,16 @@ size_t Mesh::nodeIndexById(size_t id) {
   return this->m_impl->nodeIndexById(id);
 }
 
+/**
+ * @brief Returns the array positions of the nodes of each element as a flat
+ * array with four entries per element. Unused vertices of triangles are set
+ * to zero
+ * @return vertex array positions
+ */
+std::vector<size_t> Mesh::elementVertexIndices() {
+  return this->m_impl->elementVertexIndices();
+}
+
 /**
  * @brief Returns the position in the array by element id
  * @param[in] id element id
@@ -639,6 +677,21 @@ std::vector<double> Mesh::computeMeshSize() {
  */
 void Mesh::buildElementTable() { this->m_impl->buildElementTable(); }
 
+/**
+ * @brief Renumbers the nodes and elements of the mesh to improve memory
+ * locality. Node and element ids are reassigned sequentially in the new order
+ * and the elements, boundaries, lookup tables and any search trees or element
+ * table are updated. Pointers to nodes or elements held outside of the mesh
+ * refer to different entities after reordering
+ * @param strategy ordering used for the nodes. Elements are ordered by their
+ * lowest numbered vertex
+ * @return permutation applied to the nodes and elements. Use it to remap
+ * NodalAttributes or OutputRecord data associated with the original ordering
+ */
+MeshPermutation Mesh::reorder(MeshReorderStrategy strategy) {
+  return this->m_impl->reorder(strategy);
+}
+
 /**
  * @brief Returns the number of elements surrounding a specified node
  * @param[in] n address of node
@@ -703,6 +756,9 @@ std::vector<Adcirc::Geometry::Node *> Mesh::boundaryNodes() {
 
 /**
  * @brief Returns the hash of the mesh which serves as a unique identifier
+ * @param[in] force rehash the entire mesh. Edits made through the Mesh class
+ * are tracked and only the affected blocks are rehashed, while edits made
+ * through node, element or boundary pointers require a forced rehash
  * @return hash as string
  */
 std::string Mesh::hash(bool force) { return this->m_impl->hash(force); }
@@ -788,11 +844,15 @@ std::vector<double> Mesh::extent() const { return this->m_impl->extent(); }
  * @param[in] description description of the data
  * @param[in] units data units
  * @param[in] partialWetting compute values for partially wet elements
+ * @param[in] monitor optional progress monitor which receives progress as
+ * raster rows are computed. Cancelling the monitor stops the export and throws
+ * an exception
  */
 void Mesh::toRaster(const std::string &filename, const std::vector<double> &z,
                     const std::vector<double> &extent, const double resolution,
                     const double nullvalue, const std::string &description,
-                    const std::string &units, const bool partialWetting) const {
+                    const std::string &units, const bool partialWetting,
+                    Adcirc::ProgressMonitor *monitor) const {
   this->m_impl->toRaster(filename, z, extent, resolution, nullvalue,
-                         description, units, partialWetting);
+                         description, units, partialWetting, monitor);
 }
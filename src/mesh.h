@@ -30,6 +30,7 @@
 #include "filetypes.h"
 #include "kdtree.h"
 #include "node.h"
+#include "progressmonitor.h"
 
 using Point = std::pair<double, double>;
 
@@ -41,6 +42,23 @@ class MeshPrivate;
 
 namespace Geometry {
 
+enum MeshReorderStrategy {
+  /// Order nodes along a Hilbert space filling curve through the mesh extent
+  ReorderHilbert,
+  /// Order nodes with the reverse Cuthill-McKee algorithm to reduce bandwidth
+  ReorderReverseCuthillMcKee
+};
+
+/**
+ * @brief Permutation applied by Mesh::reorder. Each array holds the original
+ * index of the entity now found at each position, i.e. nodes[i] is the
+ * former index of node i
+ */
+struct MeshPermutation {
+  std::vector<size_t> nodes;
+  std::vector<size_t> elements;
+};
+
 /**
  * @class Mesh
  * @author Zachary Cobell
@@ -150,6 +168,10 @@ class Mesh {
   void ADCIRCMODULES_EXPORT
   toWeirPolygonShapefile(const std::string &outputFile);
 
+  void ADCIRCMODULES_EXPORT toNodeFlatGeobuf(const std::string &outputFile);
+  void ADCIRCMODULES_EXPORT toElementFlatGeobuf(const std::string &outputFile);
+  void ADCIRCMODULES_EXPORT toBoundaryFlatGeobuf(const std::string &outputFile);
+
   void ADCIRCMODULES_EXPORT buildNodalSearchTree();
   void ADCIRCMODULES_EXPORT buildElementalSearchTree();
 
@@ -182,6 +204,8 @@ class Mesh {
   size_t ADCIRCMODULES_EXPORT nodeIndexById(size_t id);
   size_t ADCIRCMODULES_EXPORT elementIndexById(size_t id);
 
+  std::vector<size_t> ADCIRCMODULES_EXPORT elementVertexIndices();
+
   void ADCIRCMODULES_EXPORT resizeMesh(size_t numNodes, size_t numElements,
                                        size_t numOpenBoundaries,
                                        size_t numLandBoundaries);
@@ -211,6 +235,10 @@ class Mesh {
 
   void ADCIRCMODULES_EXPORT buildElementTable();
 
+  Adcirc::Geometry::MeshPermutation ADCIRCMODULES_EXPORT
+  reorder(Adcirc::Geometry::MeshReorderStrategy strategy =
+              Adcirc::Geometry::ReorderHilbert);
+
   size_t ADCIRCMODULES_EXPORT numElementsAroundNode(Adcirc::Geometry::Node *n);
   size_t ADCIRCMODULES_EXPORT numElementsAroundNode(size_t nodeIndex);
   Adcirc::Geometry::Element ADCIRCMODULES_EXPORT *elementTable(
@@ -253,7 +281,9 @@ class Mesh {
                                      const double nullvalue = -99999.0,
                                      const std::string &description = "none",
                                      const std::string &units = "none",
-                                     const bool partialWetting = true) const;
+                                     const bool partialWetting = true,
+                                     Adcirc::ProgressMonitor *monitor =
+                                         nullptr) const;
 
  private:
   std::unique_ptr<Adcirc::Private::MeshPrivate> m_impl;
@@ -19,25 +19,35 @@
 #include "mesh_private.h"
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <limits>
 #include <set>
 #include <string>
 #include <tuple>
 #include <utility>
 
 #include "boost/format.hpp"
+#include "coordinatetransform.h"
 #include "default_values.h"
 #include "elementtable.h"
 #include "ezproj.h"
 #include "fileio.h"
 #include "filetypes.h"
+#include "flatgeobufwriter.h"
 #include "fpcompare.h"
 #include "hash.h"
 #include "kdtree.h"
 #include "logging.h"
+#include "mappedfile.h"
 #include "mesh.h"
 #include "netcdf.h"
 #include "shapefil.h"
 #include "stringconversion.h"
+#include "textio.h"
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -53,6 +63,65 @@
 using namespace Adcirc::Private;
 using namespace Adcirc::Geometry;
 
+namespace {
+//...Number of nodes or elements hashed together into one block digest
+constexpr size_t c_hashBlockSize = 16384;
+constexpr size_t c_hashToEnd = std::numeric_limits<size_t>::max();
+
+//...Vertex slots stored per element when reordering
+constexpr size_t c_maxVertices = 4;
+
+//...Levels of the Hilbert curve used to order nodes, giving a grid of
+//   2^c_hilbertOrder cells on each side of the mesh extent
+constexpr uint64_t c_hilbertOrder = 16;
+
+//...Maximum number of restarts when searching for a pseudo-peripheral node
+//   during reverse Cuthill-McKee ordering
+constexpr size_t c_maxPeripheralSearch = 8;
+
+//...Approximate number of bytes of a 2dm file scanned as one task
+constexpr size_t c_2dmRangeSize = 4194304;
+
+//...Types of 2dm cards used when reading a mesh
+enum Card2dm { Card2dmOther, Card2dmNode, Card2dmElement, Card2dmNodestring };
+
+/**
+ * @brief Classifies a 2dm line from its leading characters so that only the
+ * cards used by the mesh are parsed
+ */
+Card2dm classify2dmCard(const char *p, const char *end) {
+  while (p != end && (*p == ' ' || *p == '\t')) ++p;
+  const size_t n = static_cast<size_t>(end - p);
+  auto separator = [&](size_t k) {
+    return k == n || p[k] == ' ' || p[k] == '\t' || p[k] == '\r';
+  };
+  if (n >= 2 && p[0] == 'N') {
+    if (p[1] == 'D' && separator(2)) return Card2dmNode;
+    if (p[1] == 'S' && separator(2)) return Card2dmNodestring;
+  } else if (n >= 3 && p[0] == 'E') {
+    if (((p[1] == '3' && p[2] == 'T') || (p[1] == '4' && p[2] == 'Q')) &&
+        separator(3)) {
+      return Card2dmElement;
+    }
+  }
+  return Card2dmOther;
+}
+
+/**
+ * @brief Returns the position of a node within a node array, or size when the
+ * node is not stored in that array. The pointer is only subtracted after it
+ * is known to lie within the array
+ */
+inline size_t nodeArrayPosition(const Node *n, const Node *first,
+                                size_t size) {
+  const std::less<const Node *> less;
+  if (first == nullptr || less(n, first) || !less(n, first + size)) {
+    return size;
+  }
+  return static_cast<size_t>(n - first);
+}
+}  // namespace
+
 Adcirc::Geometry::Mesh::~Mesh() = default;
 
 /**
@@ -61,7 +130,8 @@ Adcirc::Geometry::Mesh::~Mesh() = default;
 MeshPrivate::MeshPrivate()
     : m_filename("none"),
       m_epsg(-1),
-      m_hashType(Adcirc::Cryptography::AdcircDefaultHash) {
+      m_hashType(Adcirc::Cryptography::AdcircDefaultHash),
+      m_hashBlockType(Adcirc::Cryptography::AdcircDefaultHash) {
   this->_init();
 }
 
@@ -72,7 +142,8 @@ MeshPrivate::MeshPrivate()
 MeshPrivate::MeshPrivate(const std::string &filename)
     : m_filename(filename),
       m_epsg(-1),
-      m_hashType(Adcirc::Cryptography::AdcircDefaultHash) {
+      m_hashType(Adcirc::Cryptography::AdcircDefaultHash),
+      m_hashBlockType(Adcirc::Cryptography::AdcircDefaultHash) {
   this->_init();
 }
 
@@ -87,7 +158,8 @@ std::unique_ptr<MeshPrivate> MeshPrivate::clone() const {
   return m;
 }
 
-MeshPrivate::MeshPrivate(const MeshPrivate &m) {
+MeshPrivate::MeshPrivate(const MeshPrivate &m)
+    : m_hashType(m.m_hashType), m_hashBlockType(m.m_hashType) {
   MeshPrivate::meshCopier(this, &m);
 }
 
@@ -121,7 +193,7 @@ void MeshPrivate::_init() {
   this->m_elementalSearchTree = nullptr;
   this->m_nodeOrderingLogical = true;
   this->m_elementOrderingLogical = true;
-  this->m_hash.reset(nullptr);
+  this->invalidateHash();
   this->m_elementalSearchTree = std::unique_ptr<Kdtree>(new Kdtree());
   this->m_nodalSearchTree = std::unique_ptr<Kdtree>(new Kdtree());
 }
@@ -172,6 +244,8 @@ size_t MeshPrivate::numNodes() const { return this->m_nodes.size(); }
  * @param numNodes number of nodes
  */
 void MeshPrivate::setNumNodes(size_t numNodes) {
+  this->m_nodeHashBlocks.markDirty(std::min(numNodes, this->numNodes()),
+                                   c_hashToEnd, c_hashBlockSize);
   this->m_nodes.resize(numNodes);
 }
 
@@ -186,6 +260,8 @@ size_t MeshPrivate::numElements() const { return this->m_elements.size(); }
  * @param numElements Number of elements
  */
 void MeshPrivate::setNumElements(size_t numElements) {
+  this->m_elementHashBlocks.markDirty(
+      std::min(numElements, this->numElements()), c_hashToEnd, c_hashBlockSize);
   this->m_elements.resize(numElements);
 }
 
@@ -202,6 +278,8 @@ size_t MeshPrivate::numOpenBoundaries() const {
  * @param numOpenBoundaries Number of open boundaries
  */
 void MeshPrivate::setNumOpenBoundaries(size_t numOpenBoundaries) {
+  this->markBoundaryHashDirty(
+      std::min(numOpenBoundaries, this->numOpenBoundaries()));
   this->m_openBoundaries.resize(numOpenBoundaries);
 }
 
@@ -218,6 +296,9 @@ size_t MeshPrivate::numLandBoundaries() const {
  * @param numLandBoundaries Number of land boundaries
  */
 void MeshPrivate::setNumLandBoundaries(size_t numLandBoundaries) {
+  this->markBoundaryHashDirty(
+      this->numOpenBoundaries() +
+      std::min(numLandBoundaries, this->numLandBoundaries()));
   this->m_landBoundaries.resize(numLandBoundaries);
 }
 
@@ -379,10 +460,58 @@ void MeshPrivate::readAdcircMeshAscii() {
  *
  */
 void MeshPrivate::read2dmMesh() {
-  std::vector<std::string> nodes, elements;
-  this->read2dmData(nodes, elements);
-  this->read2dmNodes(nodes);
-  this->read2dmElements(elements);
+  Adcirc::Private::MappedFile file;
+  if (!file.open(this->filename())) {
+    adcircmodules_throw_exception("Error opening 2dm file");
+  }
+
+  this->read2dmHeader(file.data(), file.end());
+
+  std::vector<Mesh2dmRange> ranges =
+      this->scan2dmRanges(file.data(), file.end());
+  size_t nn = 0, ne = 0;
+  for (auto &r : ranges) {
+    r.firstNode = nn;
+    r.firstElement = ne;
+    nn += r.numNodes;
+    ne += r.numElements;
+  }
+  this->m_nodes.resize(nn);
+  this->m_elements.resize(ne);
+
+  bool failed = false;
+  signed long long nRanges = static_cast<signed long long>(ranges.size());
+
+  this->m_nodeOrderingLogical = true;
+#pragma omp parallel for schedule(dynamic, 1) default(none) \
+    shared(ranges, failed, nRanges)
+  for (signed long long r = 0; r < nRanges; ++r) {
+    if (!this->read2dmNodes(ranges[r])) {
+#pragma omp atomic write
+      failed = true;
+    }
+  }
+  if (failed) {
+    adcircmodules_throw_exception("Error reading 2dm node");
+  }
+
+  if (!this->m_nodeOrderingLogical) {
+    this->buildNodeLookupTable();
+  }
+
+#pragma omp parallel for schedule(dynamic, 1) default(none) \
+    shared(ranges, failed, nRanges)
+  for (signed long long r = 0; r < nRanges; ++r) {
+    if (!this->read2dmElements(ranges[r])) {
+#pragma omp atomic write
+      failed = true;
+    }
+  }
+  if (failed) {
+    adcircmodules_throw_exception("Error reading 2dm element");
+  }
+
+  this->read2dmNodestrings(ranges);
   return;
 }
 
@@ -490,114 +619,201 @@ void MeshPrivate::readDflowMesh() {
 }
 
 /**
- * @brief Reads the data from the 2dm file into the appropriate vector
- * @param[out] nodes node cards vector
- * @param[out] elements element cards vector
+ * @brief Builds a lookup table in the case that the nodes are not numbered in
+ * order
  */
-void MeshPrivate::read2dmData(std::vector<std::string> &nodes,
-                              std::vector<std::string> &elements) {
-  std::fstream fid(this->filename());
+void MeshPrivate::buildNodeLookupTable() {
+  this->m_nodeLookup.reserve(this->numNodes());
+  for (size_t i = 0; i < this->numNodes(); ++i) {
+    this->m_nodeLookup[this->m_nodes[i].id()] = i;
+  }
+}
 
-  std::string junk;
-  std::getline(fid, junk);
-  std::getline(fid, junk);
-  junk = junk.substr(8, junk.size());
-  junk.erase(std::remove(junk.begin(), junk.end(), '\"'), junk.end());
-  this->m_meshHeaderString = StringConversion::sanitizeString(junk);
+/**
+ * @brief Reads the mesh name from the MESHNAME card on the second line of a
+ * 2dm file
+ * @param[in] begin start of the file data
+ * @param[in] end end of the file data
+ */
+void MeshPrivate::read2dmHeader(const char *begin, const char *end) {
+  const char *p = begin;
+  TextIO::nextLine(p, end);
+  auto line = TextIO::nextLine(p, end);
+
+  std::string header;
+  if (line.second - line.first > 8) {
+    header.assign(line.first + 8, line.second);
+    header.erase(std::remove(header.begin(), header.end(), '\"'),
+                 header.end());
+  }
+  this->m_meshHeaderString = StringConversion::sanitizeString(header);
   if (this->m_meshHeaderString == std::string()) {
     this->m_meshHeaderString = "Mesh";
   }
-
-  std::string templine;
-  while (std::getline(fid, templine)) {
-    std::vector<std::string> templist;
-    Adcirc::FileIO::Generic::splitString(templine, templist);
-    if (templist[0] == "ND") {
-      nodes.push_back(templine);
-    } else if (templist[0] == "E4Q" || templist[0] == "E3T") {
-      elements.push_back(templine);
-    }
-  }
-  fid.close();
-  return;
 }
 
 /**
- * @brief Builds a lookup table in the case that the nodes are not numbered in
- * order
- */
-void MeshPrivate::buildNodeLookupTable() {
-  this->m_nodeLookup.reserve(this->numNodes());
-  for (size_t i = 0; i < this->numNodes(); ++i) {
-    this->m_nodeLookup[this->m_nodes[i].id()] = i;
+ * @brief Splits the 2dm file into byte ranges that begin at the start of a
+ * line and counts the cards in each range concurrently. Nodestring cards are
+ * recorded so they can be assembled in file order afterwards
+ * @param[in] begin start of the file data
+ * @param[in] end end of the file data
+ * @return ranges of the file with the number of node and element cards in each
+ */
+std::vector<MeshPrivate::Mesh2dmRange> MeshPrivate::scan2dmRanges(
+    const char *begin, const char *end) {
+  const size_t size = static_cast<size_t>(end - begin);
+  const size_t n = std::max<size_t>(1, size / c_2dmRangeSize);
+
+  std::vector<Mesh2dmRange> ranges;
+  ranges.reserve(n);
+  const char *p = begin;
+  for (size_t i = 1; i <= n && p != end; ++i) {
+    const char *q = i == n ? end : std::max(p, begin + i * (size / n));
+    if (q != end) TextIO::nextLine(q, end);
+    ranges.push_back({p, q, 0, 0, 0, 0, {}});
+    p = q;
+  }
+
+  signed long long nRanges = static_cast<signed long long>(ranges.size());
+#pragma omp parallel for schedule(dynamic, 1) default(none) \
+    shared(ranges, nRanges)
+  for (signed long long r = 0; r < nRanges; ++r) {
+    Mesh2dmRange &range = ranges[r];
+    const char *q = range.begin;
+    while (q != range.end) {
+      auto line = TextIO::nextLine(q, range.end);
+      switch (classify2dmCard(line.first, line.second)) {
+        case Card2dmNode:
+          range.numNodes++;
+          break;
+        case Card2dmElement:
+          range.numElements++;
+          break;
+        case Card2dmNodestring:
+          range.nodestrings.push_back(line.first);
+          break;
+        default:
+          break;
+      }
+    }
   }
+  return ranges;
 }
 
 /**
- * @brief Parses the node data into data structures
- * @param nodes vector of node data from 2dm file
+ * @brief Parses the node cards of one range of a 2dm file into the node array
+ * @param[in] range range of the file to parse
+ * @return true if all node cards were read
  */
-void MeshPrivate::read2dmNodes(std::vector<std::string> &nodes) {
-  this->m_nodes.reserve(nodes.size());
-  this->m_nodeOrderingLogical = true;
-  for (auto &n : nodes) {
+bool MeshPrivate::read2dmNodes(const Mesh2dmRange &range) {
+  size_t index = range.firstNode;
+  const char *p = range.begin;
+  while (p != range.end) {
+    auto line = TextIO::nextLine(p, range.end);
+    if (classify2dmCard(line.first, line.second) != Card2dmNode) continue;
+
     size_t id;
     double x, y, z;
-    Adcirc::FileIO::SMSIO::splitString2dmNodeFormat(n, id, x, y, z);
-    this->m_nodes.push_back(Node(id, x, y, z));
-    if (this->m_nodes.size() != id) {
+    if (!Adcirc::FileIO::SMSIO::splitString2dmNodeFormat(
+            line.first, line.second, id, x, y, z)) {
+      return false;
+    }
+    this->m_nodes[index].setNode(id, x, y, z);
+    if (id != index + 1) {
+#pragma omp atomic write
       this->m_nodeOrderingLogical = false;
     }
+    index++;
   }
+  return true;
+}
 
-  if (!this->m_nodeOrderingLogical) {
-    this->buildNodeLookupTable();
+/**
+ * @brief Returns the node with the given id while reading a 2dm file
+ * @param[in] id node id from the file
+ * @return pointer to the node or nullptr if it does not exist
+ */
+Node *MeshPrivate::lookup2dmNode(size_t id) {
+  if (this->m_nodeOrderingLogical) {
+    return id > 0 && id <= this->m_nodes.size() ? &this->m_nodes[id - 1]
+                                                : nullptr;
   }
+  auto it = this->m_nodeLookup.find(id);
+  return it == this->m_nodeLookup.end() ? nullptr
+                                        : &this->m_nodes[it->second];
 }
 
 /**
- * @brief Parses the element data into data structures
- * @param elements vector of element data from the 2dm file
+ * @brief Parses the element cards of one range of a 2dm file into the element
+ * array
+ * @param[in] range range of the file to parse
+ * @return true if all element cards were read and reference valid nodes
  */
-void MeshPrivate::read2dmElements(std::vector<std::string> &elements) {
-  this->m_elements.reserve(elements.size());
-  for (auto &e : elements) {
-    size_t id;
-    std::vector<size_t> n;
-    if (Adcirc::FileIO::SMSIO::splitString2dmElementFormat(e, id, n)) {
-      if (n.size() == 3) {
-        if (this->m_nodeOrderingLogical) {
-          this->m_elements.push_back(Element(id, &this->m_nodes[n[0] - 1],
-                                             &this->m_nodes[n[1] - 1],
-                                             &this->m_nodes[n[2] - 1]));
-        } else {
-          this->m_elements.push_back(
-              Element(id, &this->m_nodes[this->m_nodeLookup[n[0]]],
-                      &this->m_nodes[this->m_nodeLookup[n[1]]],
-                      &this->m_nodes[this->m_nodeLookup[n[2]]]));
-        }
-      } else if (n.size() == 4) {
-        if (this->m_nodeOrderingLogical) {
-          this->m_elements.push_back(
-              Element(id, &this->m_nodes[n[0] - 1], &this->m_nodes[n[1] - 1],
-                      &this->m_nodes[n[2] - 1], &this->m_nodes[n[3] - 1]));
-        } else {
-          this->m_elements.push_back(
-              Element(id, &this->m_nodes[this->m_nodeLookup[n[0]]],
-                      &this->m_nodes[this->m_nodeLookup[n[1]]],
-                      &this->m_nodes[this->m_nodeLookup[n[2]]],
-                      &this->m_nodes[this->m_nodeLookup[n[3]]]));
+bool MeshPrivate::read2dmElements(const Mesh2dmRange &range) {
+  size_t index = range.firstElement;
+  const char *p = range.begin;
+  while (p != range.end) {
+    auto line = TextIO::nextLine(p, range.end);
+    if (classify2dmCard(line.first, line.second) != Card2dmElement) continue;
+
+    size_t id, numNodes;
+    std::array<size_t, 4> n;
+    if (!Adcirc::FileIO::SMSIO::splitString2dmElementFormat(
+            line.first, line.second, id, n.data(), numNodes)) {
+      return false;
+    }
+
+    std::array<Node *, 4> nodes = {nullptr, nullptr, nullptr, nullptr};
+    for (size_t j = 0; j < numNodes; ++j) {
+      nodes[j] = this->lookup2dmNode(n[j]);
+      if (nodes[j] == nullptr) return false;
+    }
+
+    if (numNodes == 3) {
+      this->m_elements[index].setElement(id, nodes[0], nodes[1], nodes[2]);
+    } else {
+      this->m_elements[index].setElement(id, nodes[0], nodes[1], nodes[2],
+                                         nodes[3]);
+    }
+    index++;
+  }
+  return true;
+}
+
+/**
+ * @brief Converts the nodestrings of a 2dm file into land boundaries. A
+ * nodestring may span several NS cards and ends at a negative node id
+ * @param[in] ranges ranges of the file containing the recorded NS cards
+ */
+void MeshPrivate::read2dmNodestrings(const std::vector<Mesh2dmRange> &ranges) {
+  std::vector<size_t> ids;
+  for (const auto &r : ranges) {
+    for (const char *p : r.nodestrings) {
+      auto line = TextIO::nextLine(p, r.end);
+      bool last;
+      if (!Adcirc::FileIO::SMSIO::splitString2dmNodestringFormat(
+              line.first, line.second, ids, last)) {
+        adcircmodules_throw_exception("Error reading 2dm nodestring");
+      }
+      if (!last) continue;
+
+      Boundary b(0, ids.size());
+      for (size_t j = 0; j < ids.size(); ++j) {
+        Node *n = this->lookup2dmNode(ids[j]);
+        if (n == nullptr) {
+          adcircmodules_throw_exception("Error reading 2dm nodestring");
         }
-      } else {
-        adcircmodules_throw_exception("Too many nodes (" +
-                                      std::to_string(n.size()) +
-                                      ") detected in element.");
+        b.setNode1(j, n);
       }
-    } else {
-      adcircmodules_throw_exception("Error reading 2dm element");
+      this->m_landBoundaries.push_back(std::move(b));
+      ids.clear();
     }
   }
-  return;
+
+  if (!ids.empty()) {
+    adcircmodules_throw_exception("Unterminated nodestring in 2dm file");
+  }
 }
 
 /**
@@ -960,7 +1176,10 @@ size_t MeshPrivate::totalLandBoundaryNodes() {
 void MeshPrivate::setZ(std::vector<double> &z) {
   assert(z.size() == this->numNodes());
   for (size_t i = 0; i < this->numNodes(); ++i) {
-    this->m_nodes[i].setZ(z[i]);
+    if (this->m_nodes[i].z() != z[i]) {
+      this->m_nodes[i].setZ(z[i]);
+      this->m_nodeHashBlocks.markDirty(i, i + 1, c_hashBlockSize);
+    }
   }
   return;
 }
@@ -1160,33 +1379,57 @@ bool MeshPrivate::isLatLon() { return this->m_isLatLon; }
  * @param epsg EPSG coordinate system to convert the mesh into
  */
 void MeshPrivate::reproject(int epsg) {
-  Ezproj proj;
-  bool isLatLon;
-  std::vector<Point> inPoint, outPoint;
-  inPoint.reserve(this->numNodes());
-  outPoint.resize(this->numNodes());
-
-  for (const auto &n : this->m_nodes) {
-    inPoint.push_back(Point(n.x(), n.y()));
-  }
-
-  int ierr =
-      proj.transform(this->projection(), epsg, inPoint, outPoint, isLatLon);
+  std::vector<double> x, y;
+  this->getNodeCoordinates(x, y);
 
+  bool isLatLon;
+  int ierr = CoordinateTransform::reproject(this->projection(), epsg, x, y,
+                                            isLatLon);
   if (ierr != Ezproj::NoError) {
     adcircmodules_throw_exception("Mesh: Proj4 library error");
   }
 
-  for (size_t i = 0; i < this->numNodes(); ++i) {
-    this->node(i)->setX(outPoint[i].first);
-    this->node(i)->setY(outPoint[i].second);
-  }
-
+  this->setNodeCoordinates(x, y);
   this->defineProjection(epsg, isLatLon);
 
   return;
 }
 
+/**
+ * @brief Copies the node coordinates into contiguous arrays
+ * @param[out] x x-coordinates of the nodes
+ * @param[out] y y-coordinates of the nodes
+ */
+void MeshPrivate::getNodeCoordinates(std::vector<double> &x,
+                                     std::vector<double> &y) const {
+  x.resize(this->m_nodes.size());
+  y.resize(this->m_nodes.size());
+  signed long long n = static_cast<signed long long>(this->m_nodes.size());
+
+#pragma omp parallel for schedule(static) default(none) shared(x, y, n)
+  for (signed long long i = 0; i < n; ++i) {
+    x[i] = this->m_nodes[i].x();
+    y[i] = this->m_nodes[i].y();
+  }
+}
+
+/**
+ * @brief Replaces the node coordinates with the values in contiguous arrays
+ * @param[in] x x-coordinates of the nodes
+ * @param[in] y y-coordinates of the nodes
+ */
+void MeshPrivate::setNodeCoordinates(const std::vector<double> &x,
+                                     const std::vector<double> &y) {
+  signed long long n = static_cast<signed long long>(this->m_nodes.size());
+
+#pragma omp parallel for schedule(static) default(none) shared(x, y, n)
+  for (signed long long i = 0; i < n; ++i) {
+    this->m_nodes[i].setX(x[i]);
+    this->m_nodes[i].setY(y[i]);
+  }
+  this->m_nodeHashBlocks.invalidate();
+}
+
 /**
  * @brief Writes the mesh nodes into ESRI shapefile format
  * @param outputFile output file with .shp extension
@@ -1669,6 +1912,91 @@ void MeshPrivate::toWeirPolygonShapefile(const std::string &outputFile) {
   DBFClose(dbfid);
 }
 
+/**
+ * @brief Writes the mesh nodes into FlatGeobuf format
+ * @param outputFile output file with .fgb extension
+ */
+void MeshPrivate::toNodeFlatGeobuf(const std::string &outputFile) {
+  FlatGeobufWriter writer(outputFile, FlatGeobufWriter::Point, this->m_epsg);
+  const uint16_t nodeid = writer.addColumn("nodeid", FlatGeobufWriter::Integer);
+  const uint16_t elevation =
+      writer.addColumn("elevation", FlatGeobufWriter::Double);
+
+  writer.write(this->numNodes(), [&](size_t i, FlatGeobufFeature &f) {
+    const Node &n = this->m_nodes[i];
+    f.addPoint(n.x(), n.y());
+    f.setInteger(nodeid, static_cast<int>(n.id()));
+    f.setDouble(elevation, n.z());
+  });
+}
+
+/**
+ * @brief Writes the mesh elements as polygons into FlatGeobuf format. The
+ * fourth node columns are null for triangular elements
+ * @param outputFile output file with .fgb extension
+ */
+void MeshPrivate::toElementFlatGeobuf(const std::string &outputFile) {
+  FlatGeobufWriter writer(outputFile, FlatGeobufWriter::Polygon,
+                          this->m_epsg);
+  const uint16_t elementid =
+      writer.addColumn("elementid", FlatGeobufWriter::Integer);
+  std::array<uint16_t, 4> nodeid, znode;
+  for (size_t i = 0; i < 4; ++i) {
+    nodeid[i] = writer.addColumn("node" + std::to_string(i + 1),
+                                 FlatGeobufWriter::Integer);
+  }
+  for (size_t i = 0; i < 4; ++i) {
+    znode[i] = writer.addColumn("znode" + std::to_string(i + 1),
+                                FlatGeobufWriter::Double);
+  }
+  const uint16_t zmean = writer.addColumn("zmean", FlatGeobufWriter::Double);
+
+  writer.write(this->numElements(), [&](size_t i, FlatGeobufFeature &f) {
+    const Element &e = this->m_elements[i];
+    double z = 0.0;
+    f.setInteger(elementid, static_cast<int>(e.id()));
+    for (size_t j = 0; j < e.n(); ++j) {
+      const Node *n = e.node(j);
+      f.addPoint(n->x(), n->y());
+      f.setInteger(nodeid[j], static_cast<int>(n->id()));
+      f.setDouble(znode[j], n->z());
+      z += n->z();
+    }
+    f.setDouble(zmean, z / e.n());
+  });
+}
+
+/**
+ * @brief Writes the boundary conditions of the mesh to FlatGeobuf format as
+ * lines. Internal weirs are written along the midpoint of the two sides
+ * @param outputFile output file with .fgb extension
+ */
+void MeshPrivate::toBoundaryFlatGeobuf(const std::string &outputFile) {
+  FlatGeobufWriter writer(outputFile, FlatGeobufWriter::LineString,
+                          this->m_epsg);
+  const uint16_t bndId = writer.addColumn("bndId", FlatGeobufWriter::Integer);
+  const uint16_t bndCode =
+      writer.addColumn("bndCode", FlatGeobufWriter::Integer);
+
+  const size_t numOpen = this->m_openBoundaries.size();
+  writer.write(numOpen + this->m_landBoundaries.size(),
+               [&](size_t i, FlatGeobufFeature &f) {
+                 const Boundary &b = i < numOpen
+                                         ? this->m_openBoundaries[i]
+                                         : this->m_landBoundaries[i - numOpen];
+                 for (size_t j = 0; j < b.length(); ++j) {
+                   if (b.isInternalWeir()) {
+                     f.addPoint((b.node1(j)->x() + b.node2(j)->x()) / 2.0,
+                                (b.node1(j)->y() + b.node2(j)->y()) / 2.0);
+                   } else {
+                     f.addPoint(b.node1(j)->x(), b.node1(j)->y());
+                   }
+                 }
+                 f.setInteger(bndId, static_cast<int>(i));
+                 f.setInteger(bndCode, b.boundaryCode());
+               });
+}
+
 /**
  * @brief Builds a kd-tree object with the mesh nodes as the search locations
  */
@@ -1805,6 +2133,7 @@ void MeshPrivate::resizeMesh(size_t numNodes, size_t numElements,
 void MeshPrivate::addNode(size_t index, const Node &node) {
   if (index < this->numNodes()) {
     this->m_nodes[index] = node;
+    this->m_nodeHashBlocks.markDirty(index, index + 1, c_hashBlockSize);
   } else if (index == this->numNodes()) {
     this->m_nodes.push_back(node);
   } else {
@@ -1816,6 +2145,7 @@ void MeshPrivate::addNode(size_t index, const Node *node) {
   if (index < this->numNodes()) {
     this->m_nodes[index] =
         Adcirc::Geometry::Node(node->id(), node->x(), node->y(), node->z());
+    this->m_nodeHashBlocks.markDirty(index, index + 1, c_hashBlockSize);
   } else {
     adcircmodules_throw_exception("Mesh: Node index > number of nodes");
   }
@@ -1830,7 +2160,7 @@ void MeshPrivate::addNode(size_t index, const Node *node) {
 void MeshPrivate::deleteNode(size_t index) {
   if (index < this->numNodes()) {
     this->m_nodes.erase(this->m_nodes.begin() + index);
-    this->setNumNodes(this->m_nodes.size());
+    this->m_nodeHashBlocks.markDirty(index, c_hashToEnd, c_hashBlockSize);
   } else {
     adcircmodules_throw_exception("Mesh: Node index > number of nodes");
   }
@@ -1845,6 +2175,7 @@ void MeshPrivate::deleteNode(size_t index) {
 void MeshPrivate::addElement(size_t index, const Element &element) {
   if (index < this->numElements()) {
     this->m_elements[index] = element;
+    this->m_elementHashBlocks.markDirty(index, index + 1, c_hashBlockSize);
   } else if (index == this->numElements()) {
     this->m_elements.push_back(element);
   } else {
@@ -1861,7 +2192,7 @@ void MeshPrivate::addElement(size_t index, const Element &element) {
 void MeshPrivate::deleteElement(size_t index) {
   if (index < this->numElements()) {
     this->m_elements.erase(this->m_elements.begin() + index);
-    this->setNumElements(this->m_elements.size());
+    this->m_elementHashBlocks.markDirty(index, c_hashToEnd, c_hashBlockSize);
   } else {
     adcircmodules_throw_exception("Mesh: Element index > number of elements");
   }
@@ -1871,6 +2202,7 @@ void MeshPrivate::deleteElement(size_t index) {
 void MeshPrivate::addLandBoundary(size_t index, const Boundary &bnd) {
   if (index < this->numLandBoundaries()) {
     this->m_landBoundaries[index] = bnd;
+    this->markBoundaryHashDirty(this->numOpenBoundaries() + index);
   } else if (index == this->numLandBoundaries()) {
     this->m_landBoundaries.push_back(bnd);
   } else {
@@ -1882,6 +2214,7 @@ void MeshPrivate::addLandBoundary(size_t index, const Boundary &bnd) {
 void MeshPrivate::deleteLandBoundary(size_t index) {
   if (index < this->numLandBoundaries()) {
     this->m_landBoundaries.erase(this->m_landBoundaries.begin() + index);
+    this->markBoundaryHashDirty(this->numOpenBoundaries() + index);
   } else {
     adcircmodules_throw_exception(
         "Mesh: Land boundary index > number of boundaries");
@@ -1891,8 +2224,10 @@ void MeshPrivate::deleteLandBoundary(size_t index) {
 void MeshPrivate::addOpenBoundary(size_t index, const Boundary &bnd) {
   if (index < this->numOpenBoundaries()) {
     this->m_openBoundaries[index] = bnd;
+    this->markBoundaryHashDirty(index);
   } else if (index == this->numOpenBoundaries()) {
     this->m_openBoundaries.push_back(bnd);
+    this->markBoundaryHashDirty(index);
   } else {
     adcircmodules_throw_exception(
         "Mesh: Open boundary index > number of boundaries");
@@ -1902,6 +2237,7 @@ void MeshPrivate::addOpenBoundary(size_t index, const Boundary &bnd) {
 void MeshPrivate::deleteOpenBoundary(size_t index) {
   if (index < this->numOpenBoundaries()) {
     this->m_openBoundaries.erase(this->m_openBoundaries.begin() + index);
+    this->markBoundaryHashDirty(index);
   } else {
     adcircmodules_throw_exception(
         "Mesh: Open boundary index > number of boundaries");
@@ -2349,13 +2685,10 @@ std::vector<std::vector<size_t>> MeshPrivate::connectivity() {
  * This is the projection used within adcirc internally
  */
 void MeshPrivate::cpp(double lambda, double phi) {
-  for (auto &n : this->m_nodes) {
-    Point i(n.x(), n.y());
-    Point o;
-    Ezproj::cpp(lambda, phi, i, o);
-    n.setX(o.first);
-    n.setY(o.second);
-  }
+  std::vector<double> x, y;
+  this->getNodeCoordinates(x, y);
+  CoordinateTransform::cpp(lambda, phi, x, y);
+  this->setNodeCoordinates(x, y);
   return;
 }
 
@@ -2363,13 +2696,10 @@ void MeshPrivate::cpp(double lambda, double phi) {
  * @brief Convertes mesh back from the carte parallelogrammatique projection
  */
 void MeshPrivate::inverseCpp(double lambda, double phi) {
-  for (auto &n : this->m_nodes) {
-    Point i(n.x(), n.y());
-    Point o;
-    Ezproj::inverseCpp(lambda, phi, i, o);
-    n.setX(o.first);
-    n.setY(o.second);
-  }
+  std::vector<double> x, y;
+  this->getNodeCoordinates(x, y);
+  CoordinateTransform::inverseCpp(lambda, phi, x, y);
+  this->setNodeCoordinates(x, y);
   return;
 }
 
@@ -2608,6 +2938,339 @@ void MeshPrivate::buildElementTable() {
   return;
 }
 
+/**
+ * @brief Renumbers the nodes and elements to improve memory locality
+ * @param strategy ordering used for the nodes. Elements are ordered by their
+ * lowest numbered vertex after the nodes have been renumbered
+ * @return permutation applied to the nodes and elements
+ */
+MeshPermutation MeshPrivate::reorder(MeshReorderStrategy strategy) {
+  const std::vector<size_t> vertex = this->elementVertexIndices();
+
+  MeshPermutation p;
+  switch (strategy) {
+    case ReorderHilbert:
+      p.nodes = this->hilbertNodeOrder();
+      break;
+    case ReorderReverseCuthillMcKee:
+      p.nodes = this->reverseCuthillMcKeeNodeOrder(vertex);
+      break;
+    default:
+      adcircmodules_throw_exception("Mesh: Unknown reordering strategy");
+  }
+
+  std::vector<size_t> newIndex(this->numNodes());
+  for (size_t i = 0; i < p.nodes.size(); ++i) newIndex[p.nodes[i]] = i;
+
+  std::vector<size_t> lowest(this->numElements());
+  for (size_t i = 0; i < this->numElements(); ++i) {
+    size_t l = std::numeric_limits<size_t>::max();
+    for (size_t j = 0; j < this->m_elements[i].n(); ++j) {
+      l = std::min(l, newIndex[vertex[c_maxVertices * i + j]]);
+    }
+    lowest[i] = l;
+  }
+  p.elements.resize(this->numElements());
+  for (size_t i = 0; i < p.elements.size(); ++i) p.elements[i] = i;
+  std::stable_sort(p.elements.begin(), p.elements.end(),
+                   [&](size_t a, size_t b) { return lowest[a] < lowest[b]; });
+
+  this->applyPermutation(p, vertex);
+  return p;
+}
+
+/**
+ * @brief Returns the array positions of the nodes of each element,
+ * c_maxVertices per element. Unused vertices of triangles are set to zero
+ *
+ * Elements that reference the mesh's own node array are resolved in parallel.
+ * Any other node is located by its id, which is not safe to do concurrently
+ */
+std::vector<size_t> MeshPrivate::elementVertexIndices() {
+  const size_t nn = this->m_nodes.size();
+  const size_t ne = this->m_elements.size();
+  const Node *first = nn > 0 ? this->m_nodes.data() : nullptr;
+  std::vector<size_t> vertex(c_maxVertices * ne, 0);
+  std::vector<char> lookup(ne, 0);
+
+#pragma omp parallel for schedule(static) default(none) \
+    shared(first, vertex, lookup, ne, nn)
+  for (signed long long i = 0; i < static_cast<signed long long>(ne); ++i) {
+    const Element &e = this->m_elements[i];
+    for (size_t j = 0; j < e.n(); ++j) {
+      const size_t index = nodeArrayPosition(e.node(j), first, nn);
+      if (index < nn) {
+        vertex[c_maxVertices * i + j] = index;
+      } else {
+        lookup[i] = 1;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < ne; ++i) {
+    if (!lookup[i]) continue;
+    const Element &e = this->m_elements[i];
+    for (size_t j = 0; j < e.n(); ++j) {
+      size_t index = nodeArrayPosition(e.node(j), first, nn);
+      if (index >= nn) index = this->nodeIndexById(e.node(j)->id());
+      if (index >= nn) {
+        adcircmodules_throw_exception(
+            "Mesh: Element references a node that is not in the mesh");
+      }
+      vertex[c_maxVertices * i + j] = index;
+    }
+  }
+  return vertex;
+}
+
+/**
+ * @brief Orders the nodes by their distance along a Hilbert curve covering
+ * the mesh extent
+ */
+std::vector<size_t> MeshPrivate::hilbertNodeOrder() const {
+  const size_t nn = this->m_nodes.size();
+  std::vector<size_t> order(nn);
+  if (nn == 0) return order;
+
+  const std::vector<double> ext = this->extent();
+  const double side = std::max(ext[2] - ext[0], ext[3] - ext[1]);
+  const double cells = static_cast<double>((uint64_t(1) << c_hilbertOrder) - 1);
+  const double scale = side > 0.0 ? cells / side : 0.0;
+
+  std::vector<std::pair<uint64_t, size_t>> key(nn);
+#pragma omp parallel for schedule(static) default(none) \
+    shared(key, ext, nn, scale)
+  for (signed long long i = 0; i < static_cast<signed long long>(nn); ++i) {
+    const Node &n = this->m_nodes[i];
+    uint64_t x = static_cast<uint64_t>((n.x() - ext[0]) * scale);
+    uint64_t y = static_cast<uint64_t>((n.y() - ext[1]) * scale);
+
+    //...Distance along the curve, accumulated from the coarsest level
+    uint64_t d = 0;
+    for (uint64_t s = uint64_t(1) << (c_hilbertOrder - 1); s > 0; s >>= 1) {
+      const uint64_t rx = (x & s) > 0 ? 1 : 0;
+      const uint64_t ry = (y & s) > 0 ? 1 : 0;
+      d += s * s * ((3 * rx) ^ ry);
+      if (ry == 0) {
+        if (rx == 1) {
+          x = s - 1 - (x & (s - 1));
+          y = s - 1 - (y & (s - 1));
+        }
+        std::swap(x, y);
+      }
+    }
+    key[i] = {d, static_cast<size_t>(i)};
+  }
+
+  std::sort(key.begin(), key.end());
+  for (size_t i = 0; i < nn; ++i) order[i] = key[i].second;
+  return order;
+}
+
+/**
+ * @brief Orders the nodes using the reverse Cuthill-McKee algorithm. Each
+ * connected component is started from a pseudo-peripheral node
+ * @param vertex element vertex indices from elementVertexIndices
+ */
+std::vector<size_t> MeshPrivate::reverseCuthillMcKeeNodeOrder(
+    const std::vector<size_t> &vertex) const {
+  const size_t nn = this->m_nodes.size();
+
+  //...Node adjacency from the element edges in compressed row form
+  std::vector<size_t> offset(nn + 1, 0);
+  for (size_t i = 0; i < this->m_elements.size(); ++i) {
+    const size_t n = this->m_elements[i].n();
+    for (size_t j = 0; j < n; ++j) {
+      offset[vertex[c_maxVertices * i + j] + 1] += 2;
+    }
+  }
+  for (size_t i = 0; i < nn; ++i) offset[i + 1] += offset[i];
+  std::vector<size_t> adjacent(offset[nn]);
+  {
+    std::vector<size_t> position(offset.begin(), offset.end() - 1);
+    for (size_t i = 0; i < this->m_elements.size(); ++i) {
+      const size_t n = this->m_elements[i].n();
+      const size_t *v = &vertex[c_maxVertices * i];
+      for (size_t j = 0; j < n; ++j) {
+        adjacent[position[v[j]]++] = v[(j + 1) % n];
+        adjacent[position[v[j]]++] = v[(j + n - 1) % n];
+      }
+    }
+  }
+
+  std::vector<size_t> degree(nn);
+  for (size_t i = 0; i < nn; ++i) {
+    auto b = adjacent.begin() + offset[i];
+    auto e = adjacent.begin() + offset[i + 1];
+    std::sort(b, e);
+    degree[i] = static_cast<size_t>(std::unique(b, e) - b);
+  }
+
+  //...Visits the component containing root in breadth first order, leaving
+  //   the visit order in queue, and returns the index of the last level
+  std::vector<size_t> mark(nn, 0);
+  std::vector<size_t> depthOf(nn, 0);
+  std::vector<size_t> queue;
+  queue.reserve(nn);
+  size_t stamp = 0;
+  auto levelStructure = [&](size_t root) {
+    ++stamp;
+    queue.clear();
+    queue.push_back(root);
+    mark[root] = stamp;
+    depthOf[root] = 0;
+    for (size_t q = 0; q < queue.size(); ++q) {
+      const size_t u = queue[q];
+      for (size_t k = offset[u]; k < offset[u] + degree[u]; ++k) {
+        const size_t v = adjacent[k];
+        if (mark[v] != stamp) {
+          mark[v] = stamp;
+          depthOf[v] = depthOf[u] + 1;
+          queue.push_back(v);
+        }
+      }
+    }
+    return depthOf[queue.back()];
+  };
+
+  std::vector<size_t> order;
+  order.reserve(nn);
+  std::vector<char> visited(nn, 0);
+  std::vector<size_t> neighbors;
+
+  for (size_t start = 0; start < nn; ++start) {
+    if (visited[start]) continue;
+
+    //...Walk toward the periphery of the component, moving to the lowest
+    //   degree node of the last level while the depth increases
+    size_t root = start;
+    size_t depth = levelStructure(root);
+    for (size_t iter = 0; iter < c_maxPeripheralSearch; ++iter) {
+      size_t candidate = queue.back();
+      for (size_t q = queue.size(); q-- > 0 && depthOf[queue[q]] == depth;) {
+        if (degree[queue[q]] < degree[candidate]) candidate = queue[q];
+      }
+      const size_t candidateDepth = levelStructure(candidate);
+      if (candidateDepth <= depth) break;
+      root = candidate;
+      depth = candidateDepth;
+    }
+
+    const size_t first = order.size();
+    order.push_back(root);
+    visited[root] = 1;
+    for (size_t q = first; q < order.size(); ++q) {
+      const size_t u = order[q];
+      neighbors.clear();
+      for (size_t k = offset[u]; k < offset[u] + degree[u]; ++k) {
+        if (!visited[adjacent[k]]) {
+          visited[adjacent[k]] = 1;
+          neighbors.push_back(adjacent[k]);
+        }
+      }
+      std::stable_sort(
+          neighbors.begin(), neighbors.end(),
+          [&](size_t a, size_t b) { return degree[a] < degree[b]; });
+      order.insert(order.end(), neighbors.begin(), neighbors.end());
+    }
+  }
+
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+/**
+ * @brief Moves the nodes and elements into the order given by a permutation,
+ * renumbers them sequentially and repoints the elements and boundaries at the
+ * reordered nodes
+ * @param p permutation giving the original index of each new position
+ * @param vertex element vertex indices before the permutation is applied
+ */
+void MeshPrivate::applyPermutation(const MeshPermutation &p,
+                                   const std::vector<size_t> &vertex) {
+  const size_t nn = this->numNodes();
+  const size_t ne = this->numElements();
+  const Node *first = this->m_nodes.data();
+
+  std::vector<size_t> newIndex(nn);
+  for (size_t i = 0; i < nn; ++i) newIndex[p.nodes[i]] = i;
+
+  auto boundaryNodeIndex = [&](const Node *n) {
+    size_t index = nodeArrayPosition(n, first, nn);
+    if (index >= nn) index = this->nodeIndexById(n->id());
+    return newIndex[index];
+  };
+
+  std::vector<std::vector<size_t>> boundaryNodes;
+  for (auto *boundaries : {&this->m_openBoundaries, &this->m_landBoundaries}) {
+    for (auto &b : *boundaries) {
+      std::vector<size_t> n(b.boundaryLength() * (b.isInternalWeir() ? 2 : 1));
+      for (size_t j = 0; j < b.boundaryLength(); ++j) {
+        n[j] = boundaryNodeIndex(b.node1(j));
+        if (b.isInternalWeir()) {
+          n[b.boundaryLength() + j] = boundaryNodeIndex(b.node2(j));
+        }
+      }
+      boundaryNodes.push_back(std::move(n));
+    }
+  }
+
+  //...Nodes are permuted within the existing storage
+  std::vector<Node> nodes(this->m_nodes);
+#pragma omp parallel for schedule(static) default(none) shared(nodes, p, nn)
+  for (signed long long i = 0; i < static_cast<signed long long>(nn); ++i) {
+    this->m_nodes[i] = nodes[p.nodes[i]];
+    this->m_nodes[i].setId(i + 1);
+  }
+  std::vector<Node>().swap(nodes);
+
+  std::vector<Element> elements(this->m_elements);
+#pragma omp parallel for schedule(static) default(none) \
+    shared(elements, vertex, newIndex, p, ne)
+  for (signed long long i = 0; i < static_cast<signed long long>(ne); ++i) {
+    const size_t old = p.elements[i];
+    Element &e = this->m_elements[i];
+    e = elements[old];
+    e.setId(i + 1);
+    for (size_t j = 0; j < e.n(); ++j) {
+      e.setNode(j, &this->m_nodes[newIndex[vertex[c_maxVertices * old + j]]]);
+    }
+  }
+
+  size_t k = 0;
+  for (auto *boundaries : {&this->m_openBoundaries, &this->m_landBoundaries}) {
+    for (auto &b : *boundaries) {
+      const std::vector<size_t> &n = boundaryNodes[k++];
+      for (size_t j = 0; j < b.boundaryLength(); ++j) {
+        b.setNode1(j, &this->m_nodes[n[j]]);
+        if (b.isInternalWeir()) {
+          b.setNode2(j, &this->m_nodes[n[b.boundaryLength() + j]]);
+        }
+      }
+    }
+  }
+
+  this->m_nodeLookup.clear();
+  this->m_elementLookup.clear();
+  this->m_nodeOrderingLogical = true;
+  this->m_elementOrderingLogical = true;
+
+  const bool elementTable = this->m_elementTable.initialized();
+  this->m_elementTable = ElementTable();
+  if (elementTable) this->buildElementTable();
+
+  if (this->nodalSearchTreeInitialized()) {
+    this->m_nodalSearchTree.reset(new Kdtree());
+    this->buildNodalSearchTree();
+  }
+  if (this->elementalSearchTreeInitialized()) {
+    this->m_elementalSearchTree.reset(new Kdtree());
+    this->buildElementalSearchTree();
+  }
+
+  this->invalidateHash();
+}
+
 /**
  * @brief Returns the number of elements surrounding a specified node
  * @param n address of node
@@ -2700,29 +3363,223 @@ std::vector<Adcirc::Geometry::Node *> MeshPrivate::boundaryNodes() {
   return bdyVec;
 }
 
+/**
+ * @brief Returns the hash of the mesh. The hash is built from digests of
+ * blocks of nodes, elements and boundaries. Blocks edited through the mesh
+ * since the last call are rehashed. Edits made directly to nodes, elements or
+ * boundaries obtained by pointer are not tracked and require force
+ * @param force rehash every block
+ * @return hash of the mesh
+ */
 std::string MeshPrivate::hash(bool force) {
-  if (this->m_hash.get() == nullptr || force) this->generateHash(force);
+  this->generateHash(force);
   return std::string(this->m_hash.get());
 }
 
+/**
+ * @brief Marks every block dirty so that the next hash is computed from
+ * scratch
+ */
+void MeshPrivate::invalidateHash() {
+  this->m_hash.reset(nullptr);
+  this->m_nodeHashBlocks.invalidate();
+  this->m_elementHashBlocks.invalidate();
+  this->m_boundaryHashBlocks.invalidate();
+}
+
+/**
+ * @brief Marks the boundary at the given position, and every boundary after
+ * it, dirty. Open boundaries are followed by land boundaries
+ * @param position position of the first changed boundary
+ */
+void MeshPrivate::markBoundaryHashDirty(size_t position) {
+  this->m_boundaryHashBlocks.markDirty(position, c_hashToEnd, 1);
+}
+
+void MeshPrivate::HashBlocks::resize(size_t n, size_t blockSize) {
+  if (n == this->count) return;
+  const size_t nb = (n + blockSize - 1) / blockSize;
+  const size_t first = std::min(n, this->count) / blockSize;
+  this->digest.resize(nb);
+  this->dirty.resize(nb, 1);
+  if (first < nb) this->dirty[first] = 1;
+  this->count = n;
+}
+
+void MeshPrivate::HashBlocks::markDirty(size_t first, size_t last,
+                                        size_t blockSize) {
+  if (first >= last) return;
+  const size_t b0 = first / blockSize;
+  const size_t b1 = std::min(this->dirty.size(),
+                             last == c_hashToEnd ? this->dirty.size()
+                                                 : (last - 1) / blockSize + 1);
+  for (size_t b = b0; b < b1; ++b) {
+    this->dirty[b] = 1;
+  }
+}
+
+void MeshPrivate::HashBlocks::invalidate() {
+  std::fill(this->dirty.begin(), this->dirty.end(), 1);
+}
+
+/**
+ * @brief Generates the mesh hash as a two level Merkle hash. Dirty blocks of
+ * nodes, elements and boundaries are hashed in parallel from their binary
+ * contents and the mesh hash is the hash of the block digests
+ * @param force rehash every block
+ */
 void MeshPrivate::generateHash(bool force) {
+  if (force || this->m_hashBlockType != this->m_hashType) {
+    this->invalidateHash();
+  }
+
+  this->m_nodeHashBlocks.resize(this->numNodes(), c_hashBlockSize);
+  this->m_elementHashBlocks.resize(this->numElements(), c_hashBlockSize);
+  this->m_boundaryHashBlocks.resize(
+      this->numOpenBoundaries() + this->numLandBoundaries(), 1);
+
+  std::array<HashBlocks *, 3> sections = {&this->m_nodeHashBlocks,
+                                          &this->m_elementHashBlocks,
+                                          &this->m_boundaryHashBlocks};
+  std::vector<std::pair<size_t, size_t>> tasks;
+  for (size_t s = 0; s < sections.size(); ++s) {
+    for (size_t b = 0; b < sections[s]->dirty.size(); ++b) {
+      if (sections[s]->dirty[b]) tasks.emplace_back(s, b);
+    }
+  }
+
+  if (tasks.empty() && this->m_hash.get() != nullptr) return;
+
+  std::exception_ptr error;
+#pragma omp parallel for schedule(dynamic) default(none) \
+    shared(tasks, sections, error)
+  for (signed long long i = 0; i < static_cast<signed long long>(tasks.size());
+       ++i) {
+    try {
+      const size_t s = tasks[i].first;
+      const size_t b = tasks[i].second;
+      if (s == 0) {
+        sections[s]->digest[b] = this->hashNodeBlock(b);
+      } else if (s == 1) {
+        sections[s]->digest[b] = this->hashElementBlock(b);
+      } else {
+        sections[s]->digest[b] = this->hashBoundary(b);
+      }
+    } catch (...) {
+#pragma omp critical(mesh_hash_error)
+      {
+        if (!error) error = std::current_exception();
+      }
+    }
+  }
+  if (error) std::rethrow_exception(error);
+
   Adcirc::Cryptography::Hash h(this->m_hashType);
-  for (auto &n : this->m_nodes) {
-    h.addData(n.hash(this->m_hashType, force));
+  h.addData(boost::str(boost::format("%i %i %i %i") % this->numNodes() %
+                       this->numElements() % this->numOpenBoundaries() %
+                       this->numLandBoundaries()));
+  for (auto &section : sections) {
+    std::fill(section->dirty.begin(), section->dirty.end(), 0);
+    for (const auto &d : section->digest) {
+      h.addData(d);
+    }
   }
+  this->m_hash.reset(h.getHash());
+  this->m_hashBlockType = this->m_hashType;
+}
 
-  for (auto &e : this->m_elements) {
-    h.addData(e.hash(this->m_hashType, force));
+namespace {
+template <typename T>
+void appendHashValue(std::string &buffer, T value) {
+  char b[sizeof(T)];
+  std::memcpy(b, &value, sizeof(T));
+  buffer.append(b, sizeof(T));
+}
+
+std::string digestOf(Adcirc::Cryptography::HashType type,
+                     const std::string &buffer) {
+  Adcirc::Cryptography::Hash h(type);
+  h.addData(buffer);
+  std::unique_ptr<char[]> digest(h.getHash());
+  return std::string(digest.get());
+}
+}  // namespace
+
+/**
+ * @brief Hashes the id and position of each node in a block
+ * @param block block index
+ * @return digest of the block
+ */
+std::string MeshPrivate::hashNodeBlock(size_t block) const {
+  const size_t first = block * c_hashBlockSize;
+  const size_t last = std::min(first + c_hashBlockSize, this->m_nodes.size());
+  std::string buffer;
+  buffer.reserve((last - first) * 4 * sizeof(double));
+  for (size_t i = first; i < last; ++i) {
+    const Node &n = this->m_nodes[i];
+    appendHashValue<uint64_t>(buffer, n.id());
+    appendHashValue<double>(buffer, n.x());
+    appendHashValue<double>(buffer, n.y());
+    appendHashValue<double>(buffer, n.z());
   }
+  return digestOf(this->m_hashType, buffer);
+}
 
-  for (auto &b : this->m_openBoundaries) {
-    h.addData(b.hash(this->m_hashType, force));
+/**
+ * @brief Hashes the id and connectivity of each element in a block
+ * @param block block index
+ * @return digest of the block
+ */
+std::string MeshPrivate::hashElementBlock(size_t block) const {
+  const size_t first = block * c_hashBlockSize;
+  const size_t last =
+      std::min(first + c_hashBlockSize, this->m_elements.size());
+  std::string buffer;
+  buffer.reserve((last - first) * 5 * sizeof(uint64_t));
+  for (size_t i = first; i < last; ++i) {
+    const Element &e = this->m_elements[i];
+    appendHashValue<uint64_t>(buffer, e.id());
+    appendHashValue<uint64_t>(buffer, e.n());
+    for (size_t j = 0; j < e.n(); ++j) {
+      appendHashValue<uint64_t>(buffer, e.node(j)->id());
+    }
   }
+  return digestOf(this->m_hashType, buffer);
+}
 
-  for (auto &b : this->m_landBoundaries) {
-    h.addData(b.hash(this->m_hashType, force));
+/**
+ * @brief Hashes the type, nodes and attributes of a boundary
+ * @param index position of the boundary. Open boundaries are followed by land
+ * boundaries
+ * @return digest of the boundary
+ */
+std::string MeshPrivate::hashBoundary(size_t index) const {
+  const Boundary &b =
+      index < this->m_openBoundaries.size()
+          ? this->m_openBoundaries[index]
+          : this->m_landBoundaries[index - this->m_openBoundaries.size()];
+  std::string buffer;
+  appendHashValue<int64_t>(buffer, b.boundaryCode());
+  appendHashValue<uint64_t>(buffer, b.boundaryLength());
+  for (size_t i = 0; i < b.boundaryLength(); ++i) {
+    appendHashValue<uint64_t>(buffer, b.node1(i)->id());
+    if (b.isInternalWeir()) {
+      appendHashValue<uint64_t>(buffer, b.node2(i)->id());
+    }
+    if (b.isWeir()) {
+      appendHashValue<double>(buffer, b.crestElevation(i));
+      appendHashValue<double>(buffer, b.supercriticalWeirCoefficient(i));
+      if (b.isInternalWeir()) {
+        appendHashValue<double>(buffer, b.subcriticalWeirCoefficient(i));
+      }
+      if (b.isInternalWeirWithPipes()) {
+        appendHashValue<double>(buffer, b.pipeDiameter(i));
+        appendHashValue<double>(buffer, b.pipeHeight(i));
+        appendHashValue<double>(buffer, b.pipeCoefficient(i));
+      }
+    }
   }
-  this->m_hash.reset(h.getHash());
+  return digestOf(this->m_hashType, buffer);
 }
 
 Adcirc::Cryptography::HashType MeshPrivate::hashType() const {
@@ -2822,7 +3679,8 @@ void MeshPrivate::toRaster(const std::string &filename,
                            const double resolution, const float nullvalue,
                            const std::string &description,
                            const std::string &units,
-                           const bool partialWetting) {
+                           const bool partialWetting,
+                           Adcirc::ProgressMonitor *monitor) {
 #ifndef USE_GDAL
   adcircmodules_throw_exception("GDAL is not enabled.");
 #else
@@ -2884,8 +3742,13 @@ void MeshPrivate::toRaster(const std::string &filename,
 
   std::vector<std::vector<double>> weight;
   std::vector<size_t> elements;
-  std::tie(weight, elements) =
-      this->computeRasterInterpolationWeights(extent, nx, ny, resolution);
+  std::tie(weight, elements) = this->computeRasterInterpolationWeights(
+      extent, nx, ny, resolution, monitor);
+  if (monitor && monitor->isCancelled()) {
+    GDALClose(static_cast<GDALDatasetH>(raster));
+    CSLDestroy(options);
+    adcircmodules_throw_exception("Mesh: Raster export cancelled");
+  }
   std::vector<float> zr =
       this->getRasterValues(z, nullvalue, elements, weight, partialWetting);
 
@@ -2938,7 +3801,7 @@ std::vector<float> MeshPrivate::getRasterValues(
 std::pair<std::vector<std::vector<double>>, std::vector<size_t>>
 MeshPrivate::computeRasterInterpolationWeights(
     const std::vector<double> &extent, const size_t nx, const size_t ny,
-    const double &resolution) {
+    const double &resolution, Adcirc::ProgressMonitor *monitor) {
   double xmin = extent[0];
   double ymax = extent[3];
 
@@ -2958,9 +3821,12 @@ MeshPrivate::computeRasterInterpolationWeights(
     this->buildElementalSearchTree();
   }
 
-#pragma omp parallel for shared(weight, elements, resolution, xmin, ymax)   \
-    schedule(dynamic)
+  if (monitor) monitor->begin(ny);
+
+#pragma omp parallel for shared(weight, elements, resolution, xmin, ymax, \
+                                monitor) schedule(dynamic)
   for (size_t j = 0; j < ny; ++j) {
+    if (monitor && monitor->isCancelled()) continue;
     for (size_t i = 0; i < nx; ++i) {
       size_t k = j * nx + i;
       double x, y;
@@ -2969,7 +3835,10 @@ MeshPrivate::computeRasterInterpolationWeights(
       std::vector<double> w;
       elements[k] = this->findElement(x, y, weight[k]);
     }
+    if (monitor) monitor->increment();
   }
+
+  if (monitor) monitor->finish();
   return {weight, elements};
 }
 
@@ -31,7 +31,9 @@
 #include "elementtable.h"
 #include "filetypes.h"
 #include "kdtree.h"
+#include "mesh.h"
 #include "node.h"
+#include "progressmonitor.h"
 
 using Point = std::pair<double, double>;
 
@@ -106,6 +108,10 @@ class MeshPrivate {
                                const bool bothSides = false);
   void toWeirPolygonShapefile(const std::string &outputFile);
 
+  void toNodeFlatGeobuf(const std::string &outputFile);
+  void toElementFlatGeobuf(const std::string &outputFile);
+  void toBoundaryFlatGeobuf(const std::string &outputFile);
+
   void buildNodalSearchTree();
   void buildElementalSearchTree();
 
@@ -167,6 +173,9 @@ class MeshPrivate {
 
   void buildElementTable();
 
+  Adcirc::Geometry::MeshPermutation reorder(
+      Adcirc::Geometry::MeshReorderStrategy strategy);
+
   size_t numElementsAroundNode(Adcirc::Geometry::Node *n);
   size_t numElementsAroundNode(size_t nodeIndex);
   Adcirc::Geometry::Element *elementTable(Adcirc::Geometry::Node *n,
@@ -176,6 +185,7 @@ class MeshPrivate {
       Adcirc::Geometry::Node *n);
 
   std::string hash(bool force = false);
+  void invalidateHash();
 
   Adcirc::Cryptography::HashType hashType() const;
   void setHashType(const Adcirc::Cryptography::HashType &hashType);
@@ -195,7 +205,8 @@ class MeshPrivate {
   void toRaster(const std::string &filename, const std::vector<double> &z,
                 const std::vector<double> &extent, const double resolution,
                 const float nullvalue, const std::string &description,
-                const std::string &units, const bool partialWetting = true);
+                const std::string &units, const bool partialWetting = true,
+                Adcirc::ProgressMonitor *monitor = nullptr);
 
  private:
   static void meshCopier(MeshPrivate *a, const MeshPrivate *b);
@@ -209,11 +220,28 @@ class MeshPrivate {
   void readAdcircOpenBoundaries(std::fstream &fid);
   void readAdcircLandBoundaries(std::fstream &fid);
 
+  void getNodeCoordinates(std::vector<double> &x,
+                          std::vector<double> &y) const;
+  void setNodeCoordinates(const std::vector<double> &x,
+                          const std::vector<double> &y);
+
+  struct Mesh2dmRange {
+    const char *begin;
+    const char *end;
+    size_t firstNode;
+    size_t numNodes;
+    size_t firstElement;
+    size_t numElements;
+    std::vector<const char *> nodestrings;
+  };
+
   void read2dmMesh();
-  void read2dmData(std::vector<std::string> &nodes,
-                   std::vector<std::string> &elements);
-  void read2dmNodes(std::vector<std::string> &nodes);
-  void read2dmElements(std::vector<std::string> &elements);
+  void read2dmHeader(const char *begin, const char *end);
+  std::vector<Mesh2dmRange> scan2dmRanges(const char *begin, const char *end);
+  bool read2dmNodes(const Mesh2dmRange &range);
+  bool read2dmElements(const Mesh2dmRange &range);
+  void read2dmNodestrings(const std::vector<Mesh2dmRange> &ranges);
+  Adcirc::Geometry::Node *lookup2dmNode(size_t id);
 
   void readDflowMesh();
 
@@ -229,7 +257,32 @@ class MeshPrivate {
   size_t getMaxNodesPerElement();
   void buildNodeLookupTable();
 
+  std::vector<size_t> elementVertexIndices();
+  std::vector<size_t> hilbertNodeOrder() const;
+  std::vector<size_t> reverseCuthillMcKeeNodeOrder(
+      const std::vector<size_t> &vertex) const;
+  void applyPermutation(const Adcirc::Geometry::MeshPermutation &p,
+                        const std::vector<size_t> &vertex);
+
+  /**
+   * @brief Digests of contiguous blocks of mesh entities. The mesh hash is
+   * the hash of the block digests, so only blocks marked dirty are rehashed
+   * after an edit
+   */
+  struct HashBlocks {
+    size_t count = 0;
+    std::vector<std::string> digest;
+    std::vector<char> dirty;
+    void resize(size_t n, size_t blockSize);
+    void markDirty(size_t first, size_t last, size_t blockSize);
+    void invalidate();
+  };
+
   void generateHash(bool force = false);
+  std::string hashNodeBlock(size_t block) const;
+  std::string hashElementBlock(size_t block) const;
+  std::string hashBoundary(size_t index) const;
+  void markBoundaryHashDirty(size_t position);
 
   void writePrjFile(const std::string &outputFile);
 
@@ -241,6 +294,10 @@ class MeshPrivate {
   std::string m_filename;
   std::string m_meshHeaderString;
   std::unique_ptr<char[]> m_hash;
+  HashBlocks m_nodeHashBlocks;
+  HashBlocks m_elementHashBlocks;
+  HashBlocks m_boundaryHashBlocks;
+  Adcirc::Cryptography::HashType m_hashBlockType;
   std::vector<Adcirc::Geometry::Node> m_nodes;
   std::vector<Adcirc::Geometry::Element> m_elements;
   std::vector<Adcirc::Geometry::Boundary> m_openBoundaries;
@@ -265,7 +322,8 @@ class MeshPrivate {
   std::pair<std::vector<std::vector<double>>, std::vector<size_t>>
   computeRasterInterpolationWeights(const std::vector<double> &extent,
                                     const size_t nx, const size_t ny,
-                                    const double &resolution);
+                                    const double &resolution,
+                                    Adcirc::ProgressMonitor *monitor = nullptr);
 
   static std::pair<double, double> pixelToCoordinate(const size_t i,
                                                      const size_t j,
@@ -19,371 +19,696 @@
 #include "meshchecker.h"
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <exception>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <vector>
 #include "boost/format.hpp"
+#include "logging.h"
+#include "meshintersection.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace Adcirc {
 namespace Utility {
 
 using namespace Adcirc::Geometry;
 
-MeshChecker::MeshChecker(Mesh *mesh) : m_mesh(mesh) {}
-
-bool MeshChecker::checkMesh(bool ignoreNonfatal) {
-  bool passed = true;
-  if (!this->checkNodeNumbering(this->m_mesh)) {
-    printf("MeshChecker::checkMesh --> Node numbering check failed.\n");
-    return false;
+namespace {
+
+/**
+ * @brief Number of checks performed by checkMesh, used for progress reporting
+ */
+constexpr size_t c_numChecks = 10;
+
+//...Thresholds used by checkMesh
+constexpr double c_minimumNodalElevation = -200.0;
+constexpr double c_minimumCrestElevationOverTopography = 0.2;
+constexpr double c_minimumElementSize = 20.0;
+
+//...Vertex slots stored per element
+constexpr size_t c_maxVertices = 4;
+
+//...Number of problems described in the messages of a check result. All
+//   offending nodes and elements are still listed in the result
+constexpr size_t c_maxMessages = 100;
+
+/**
+ * @brief Bitset with one bit per node
+ */
+class NodeBitset {
+ public:
+  explicit NodeBitset(size_t n) : m_words((n + 63) / 64, 0) {}
+  void set(size_t i) { m_words[i / 64] |= uint64_t(1) << (i % 64); }
+  bool test(size_t i) const { return (m_words[i / 64] >> (i % 64)) & 1; }
+
+ private:
+  std::vector<uint64_t> m_words;
+};
+
+struct EdgeEntry {
+  size_t node;
+  size_t element;
+  bool operator<(const EdgeEntry &e) const {
+    return node < e.node || (node == e.node && element < e.element);
   }
-
-  if (!this->checkElementNumbering(this->m_mesh)) {
-    printf("MeshChecker::checkMesh --> Element numbering check failed.\n");
-    return false;
+};
+
+/**
+ * @brief Connectivity shared by the mesh checks. Edges are stored once per
+ * element in compressed rows keyed by their lower node index, so the elements
+ * sharing an edge are adjacent within a row
+ */
+struct MeshTopology {
+  std::vector<size_t> vertex;
+  std::vector<size_t> edgeOffset;
+  std::vector<EdgeEntry> edges;
+};
+
+MeshTopology buildTopology(Mesh *mesh) {
+  const size_t nn = mesh->numNodes();
+  const size_t ne = mesh->numElements();
+
+  MeshTopology t;
+  t.vertex = mesh->elementVertexIndices();
+  t.edgeOffset.assign(nn + 1, 0);
+
+  for (size_t i = 0; i < ne; ++i) {
+    const size_t n = mesh->element(i)->n();
+    const size_t *v = &t.vertex[c_maxVertices * i];
+    for (size_t j = 0; j < n; ++j) {
+      t.edgeOffset[std::min(v[j], v[(j + 1) % n]) + 1]++;
+    }
+  }
+  for (size_t i = 0; i < nn; ++i) t.edgeOffset[i + 1] += t.edgeOffset[i];
+
+  t.edges.resize(t.edgeOffset[nn]);
+  std::vector<size_t> position(t.edgeOffset.begin(), t.edgeOffset.end() - 1);
+  for (size_t i = 0; i < ne; ++i) {
+    const size_t n = mesh->element(i)->n();
+    const size_t *v = &t.vertex[c_maxVertices * i];
+    for (size_t j = 0; j < n; ++j) {
+      const size_t a = v[j];
+      const size_t b = v[(j + 1) % n];
+      t.edges[position[std::min(a, b)]++] = EdgeEntry{std::max(a, b), i};
+    }
   }
 
-  if (!this->checkNodalElevations(this->m_mesh, -200.0)) {
-    printf("MeshChecker::checkMesh --> Nodal elevation check failed.\n");
-    passed = false;
+  std::vector<EdgeEntry> &edges = t.edges;
+  const std::vector<size_t> &offset = t.edgeOffset;
+#pragma omp parallel for schedule(static) default(none) \
+    shared(edges, offset, nn)
+  for (signed long long i = 0; i < static_cast<signed long long>(nn); ++i) {
+    std::sort(edges.begin() + offset[i], edges.begin() + offset[i + 1]);
   }
+  return t;
+}
 
-  if (!this->checkDisjointNodes(this->m_mesh,
-                                "meshchecker_disjointNodes.txt")) {
-    printf("MeshChecker::checkMesh --> Disjoint nodes found.");
-    passed = false;
+/**
+ * @brief Calls f(a, b, first, last) for each unique edge (a, b), where
+ * [first, last) is the range of edge entries of the elements sharing it
+ */
+template <typename Function>
+void forEachEdge(const MeshTopology &t, Function f) {
+  const size_t nn = t.edgeOffset.size() - 1;
+  for (size_t a = 0; a < nn; ++a) {
+    size_t k = t.edgeOffset[a];
+    while (k < t.edgeOffset[a + 1]) {
+      size_t last = k + 1;
+      while (last < t.edgeOffset[a + 1] &&
+             t.edges[last].node == t.edges[k].node) {
+        ++last;
+      }
+      f(a, t.edges[k].node, k, last);
+      k = last;
+    }
   }
+}
+
+void addMessage(MeshCheckResult &r, const std::string &message) {
+  if (r.messages.size() < c_maxMessages) r.messages.push_back(message);
+}
 
-  if (!this->checkOverlappingElements(this->m_mesh)) {
-    printf("MeshChecker::checkMesh --> Overlapping elements found.");
-    return false;
+MeshCheckResult nodeNumbering(Mesh *mesh) {
+  MeshCheckResult r;
+  r.name = "nodeNumbering";
+  r.fatal = true;
+  for (size_t i = 0; i < mesh->numNodes(); ++i) {
+    if (mesh->node(i)->id() != i + 1) {
+      r.nodes.push_back(mesh->node(i)->id());
+      addMessage(r, boost::str(boost::format("Node %i found at position %i") %
+                               mesh->node(i)->id() % (i + 1)));
+    }
   }
+  r.passed = r.nodes.empty();
+  return r;
+}
 
-  if (!this->checkLeveeHeights(this->m_mesh, 0.2)) {
-    printf("MeshChecker::checkMesh --> Levee height check failed.\n");
-    if (!ignoreNonfatal) return false;
-    passed = false;
+MeshCheckResult elementNumbering(Mesh *mesh) {
+  MeshCheckResult r;
+  r.name = "elementNumbering";
+  r.fatal = true;
+  for (size_t i = 0; i < mesh->numElements(); ++i) {
+    if (mesh->element(i)->id() != i + 1) {
+      r.elements.push_back(mesh->element(i)->id());
+      addMessage(r,
+                 boost::str(boost::format("Element %i found at position %i") %
+                            mesh->element(i)->id() % (i + 1)));
+    }
   }
+  r.passed = r.elements.empty();
+  return r;
+}
 
-  if (!this->checkPipeHeights((this->m_mesh))) {
-    printf("MeshChecker::checkMesh --> Pipe height check failed.\n");
-    if (!ignoreNonfatal) return false;
-    passed = false;
+MeshCheckResult nodalElevations(Mesh *mesh, double minimumNodalElevation) {
+  MeshCheckResult r;
+  r.name = "nodalElevations";
+  for (size_t i = 0; i < mesh->numNodes(); ++i) {
+    const Node *n = mesh->node(i);
+    if (n->z() < minimumNodalElevation) {
+      r.nodes.push_back(n->id());
+      addMessage(r, boost::str(boost::format("Node %i has elevation %9.2f "
+                                             "which is less than the "
+                                             "specified minimum elevation of "
+                                             "%9.2f") %
+                               n->id() % n->z() % minimumNodalElevation));
+    }
   }
+  r.passed = r.nodes.empty();
+  return r;
+}
 
-  if (!this->checkElementSizes(this->m_mesh, 20.0)) {
-    printf("MeshChecker::checkMesh --> Element size check failed.");
-    passed = false;
+MeshCheckResult disjointNodes(Mesh *mesh, const MeshTopology &t) {
+  MeshCheckResult r;
+  r.name = "disjointNodes";
+  NodeBitset connected(mesh->numNodes());
+  for (size_t i = 0; i < mesh->numElements(); ++i) {
+    for (size_t j = 0; j < mesh->element(i)->n(); ++j) {
+      connected.set(t.vertex[c_maxVertices * i + j]);
+    }
   }
-  if (!this->checkMissingBoundaryConditions(
-          this->m_mesh, "meshchecker_missingBoundaries.txt")) {
-    printf(
-        "MeshChecker::checkMesh --> Missing boundary condition nodes found.");
-    passed = false;
+  for (size_t i = 0; i < mesh->numNodes(); ++i) {
+    if (!connected.test(i)) {
+      r.nodes.push_back(mesh->node(i)->id());
+      addMessage(r, boost::str(boost::format(
+                                   "Node %i is not connected to any element") %
+                               mesh->node(i)->id()));
+    }
   }
-
-  return passed;
+  r.passed = r.nodes.empty();
+  return r;
 }
 
-bool MeshChecker::checkNodeNumbering(Mesh *mesh) {
-  for (size_t i = 0; i < mesh->numNodes(); ++i) {
-    if (mesh->node(i)->id() != i + 1) return false;
+MeshCheckResult overlappingElements(Mesh *mesh, const MeshTopology &t) {
+  MeshCheckResult r;
+  r.name = "overlappingElements";
+  r.fatal = true;
+  std::vector<char> overlapping(mesh->numElements(), 0);
+  forEachEdge(t, [&](size_t, size_t, size_t first, size_t last) {
+    if (last - first > 2) {
+      for (size_t k = first; k < last; ++k) overlapping[t.edges[k].element] = 1;
+    }
+  });
+  for (size_t i = 0; i < mesh->numElements(); ++i) {
+    if (overlapping[i]) {
+      r.elements.push_back(mesh->element(i)->id());
+      addMessage(r, boost::str(boost::format("Overlapping element detected "
+                                             "on element %i") %
+                               mesh->element(i)->id()));
+    }
   }
-  return true;
+  r.passed = r.elements.empty();
+  return r;
 }
 
-bool MeshChecker::checkElementNumbering(Mesh *mesh) {
+MeshCheckResult intersectingElements(Mesh *mesh) {
+  MeshCheckResult r;
+  r.name = "intersectingElements";
+  r.fatal = true;
+  MeshIntersection intersection(mesh);
+  intersection.compute();
+  std::vector<char> flagged(mesh->numElements(), 0);
+  for (const auto &p : intersection.overlappingElements()) {
+    flagged[p.first] = 1;
+    flagged[p.second] = 1;
+    addMessage(r, boost::str(boost::format("Element %i overlaps element %i") %
+                             mesh->element(p.first)->id() %
+                             mesh->element(p.second)->id()));
+  }
+  for (const auto &i : intersection.selfIntersectingElements()) {
+    flagged[i] = 1;
+    addMessage(r, boost::str(boost::format("Element %i is degenerate or self "
+                                           "intersecting") %
+                             mesh->element(i)->id()));
+  }
   for (size_t i = 0; i < mesh->numElements(); ++i) {
-    if (mesh->element(i)->id() != i + 1) return false;
+    if (flagged[i]) r.elements.push_back(mesh->element(i)->id());
   }
-  return true;
+  r.passed = r.elements.empty();
+  return r;
 }
 
-bool MeshChecker::checkNodalElevations(Mesh *mesh,
-                                       double minimumNodalElevation) {
-  bool passed = true;
-  for (size_t i = 0; i < mesh->numNodes(); ++i) {
-    if (mesh->node(i)->z() < minimumNodalElevation) {
-      printf(
-          "[Mesh Error] MeshChecker::checkNodalElevations --> Node %zd has "
-          "elevation %9.2f which is greater than specified minimum "
-          "elevation of %9.2f.\n",
-          mesh->node(i)->id(), mesh->node(i)->z(), minimumNodalElevation);
-      passed = false;
-    }
+void checkLeveeNode(MeshCheckResult &r, const Boundary *bc, const Node *n,
+                    size_t index, double minimumCrestElevationOverTopography,
+                    const char *type) {
+  if (-n->z() >
+      bc->crestElevation(index) - minimumCrestElevationOverTopography) {
+    r.nodes.push_back(n->id());
+    addMessage(r, boost::str(boost::format("Node %i elevation (%f) greater "
+                                           "than crest elevation (%f + %f) on "
+                                           "%s boundary") %
+                             n->id() % -n->z() % bc->crestElevation(index) %
+                             minimumCrestElevationOverTopography % type));
   }
-  return passed;
 }
 
-bool MeshChecker::checkLeveeHeights(
-    Mesh *mesh, double minimumCrestElevationOverTopography) {
-  bool passed = true;
+MeshCheckResult leveeHeights(Mesh *mesh,
+                             double minimumCrestElevationOverTopography) {
+  MeshCheckResult r;
+  r.name = "leveeHeights";
   for (size_t i = 0; i < mesh->numLandBoundaries(); ++i) {
-    if (mesh->landBoundary(i)->isInternalWeir()) {
-      for (size_t j = 0; j < mesh->landBoundary(i)->length(); ++j) {
-        if (-mesh->landBoundary(i)->node1(j)->z() >
-                mesh->landBoundary(i)->crestElevation(j) -
-                    minimumCrestElevationOverTopography ||
-            -mesh->landBoundary(i)->node2(j)->z() >
-                mesh->landBoundary(i)->crestElevation(j) -
-                    minimumCrestElevationOverTopography) {
-          MeshChecker::printFailedLeveeStatus(
-              mesh->landBoundary(i), j, minimumCrestElevationOverTopography);
-          passed = false;
-        }
+    const Boundary *bc = mesh->landBoundary(i);
+    if (bc->isInternalWeir()) {
+      for (size_t j = 0; j < bc->length(); ++j) {
+        checkLeveeNode(r, bc, bc->node1(j), j,
+                       minimumCrestElevationOverTopography, "weir");
+        checkLeveeNode(r, bc, bc->node2(j), j,
+                       minimumCrestElevationOverTopography, "weir");
       }
-    } else if (mesh->landBoundary(i)->isExternalWeir()) {
-      for (size_t j = 0; j < mesh->landBoundary(i)->length(); ++j) {
-        if (-mesh->landBoundary(i)->node1(j)->z() >
-            mesh->landBoundary(i)->crestElevation(j) -
-                minimumCrestElevationOverTopography) {
-          MeshChecker::printFailedLeveeStatus(
-              mesh->landBoundary(i), j, minimumCrestElevationOverTopography);
-          passed = false;
-        }
+    } else if (bc->isExternalWeir()) {
+      for (size_t j = 0; j < bc->length(); ++j) {
+        checkLeveeNode(r, bc, bc->node1(j), j,
+                       minimumCrestElevationOverTopography,
+                       "single sided weir");
       }
     }
   }
-  return passed;
-}
-
-void MeshChecker::printFailedLeveeStatus(
-    Boundary *bc, size_t index, double minimumCrestElevationOverTopography) {
-  if (bc->isExternalWeir()) {
-    printf(
-        "[Mesh Error] MeshChecker::checkLeveeHeights --> Node %zd elevation "
-        "(%f) greater than crest elevation (%f + %f) on single "
-        "sided weir boundary.\n",
-        bc->node1(index)->id(), -bc->node1(index)->z(),
-        bc->crestElevation(index), minimumCrestElevationOverTopography);
-  } else if (bc->isInternalWeir()) {
-    if (-bc->node1(index)->z() >
-        bc->crestElevation(index) - minimumCrestElevationOverTopography) {
-      printf(
-          "[Mesh Error] MeshChecker::checkLeveeHeights --> Node %zd elevation "
-          "(%f) greater than crest elevation (%f + %f) on weir "
-          "boundary.\n",
-          bc->node1(index)->id(), -bc->node1(index)->z(),
-          bc->crestElevation(index), minimumCrestElevationOverTopography);
-    }
-    if (-bc->node2(index)->z() >
-        bc->crestElevation(index) - minimumCrestElevationOverTopography) {
-      printf(
-          "[Mesh Error] MeshChecker::checkLeveeHeights --> Node %zd elevation "
-          "(%f) greater than crest elevation (%f + %f) on weir "
-          "boundary.\n",
-          bc->node2(index)->id(), -bc->node2(index)->z(),
-          bc->crestElevation(index), minimumCrestElevationOverTopography);
-    }
-  }
-  return;
+  r.passed = r.nodes.empty();
+  return r;
 }
 
-bool MeshChecker::checkOverlappingElements(Mesh *mesh) {
-  std::vector<Element *> overlappingList;
-  mesh->buildElementTable();
-
-  for (size_t i = 0; i < mesh->numElements(); ++i) {
-    for (size_t j = 0; j < mesh->element(i)->n(); ++j) {
-      int count = 0;
-
-      std::pair<Node *, Node *> p = mesh->element(i)->elementLeg(j);
-      Node *n1 = p.first;
-      Node *n2 = p.second;
-
-      for (size_t i1 = 0; i1 < mesh->elementsAroundNode(n1).size(); ++i1) {
-        Element *m1 = mesh->elementsAroundNode(n1).at(i1);
-        for (size_t i2 = 0; i2 < mesh->elementsAroundNode(n2).size(); ++i2) {
-          Element *m2 = mesh->elementsAroundNode(n2).at(i2);
-          if (m1->id() == m2->id()) {
-            count++;
-            break;
-          }
-        }
+MeshCheckResult pipeHeights(Mesh *mesh) {
+  MeshCheckResult r;
+  r.name = "pipeHeights";
+  for (size_t i = 0; i < mesh->numLandBoundaries(); i++) {
+    const Boundary *bc = mesh->landBoundary(i);
+    if (!bc->isInternalWeirWithPipes()) continue;
+    for (size_t j = 0; j < bc->length(); j++) {
+      const double topOfPipe = bc->pipeHeight(j) + 0.5 * bc->pipeDiameter(j);
+      const double bottomOfPipe =
+          bc->pipeHeight(j) - 0.5 * bc->pipeDiameter(j);
+      const bool top = topOfPipe > bc->crestElevation(j);
+      const bool bottom = bottomOfPipe < bc->node1(j)->z() ||
+                          bottomOfPipe < bc->node2(j)->z();
+      if (top) {
+        addMessage(r, boost::str(boost::format("Top of pipe > weir crest "
+                                               "elevation at nodes %i and %i") %
+                                 bc->node1(j)->id() % bc->node2(j)->id()));
+      }
+      if (bottom) {
+        addMessage(r, boost::str(boost::format("Bottom of pipe < nodal "
+                                               "elevation at nodes %i and %i") %
+                                 bc->node1(j)->id() % bc->node2(j)->id()));
+      }
+      if (top || bottom) {
+        r.nodes.push_back(bc->node1(j)->id());
+        r.nodes.push_back(bc->node2(j)->id());
       }
-      if (count > 2) overlappingList.push_back(mesh->element(i));
     }
   }
+  r.passed = r.nodes.empty();
+  return r;
+}
 
-  if (overlappingList.size() != 0) {
-    for (size_t i = 0; i < overlappingList.size(); ++i) {
-      printf(
-          "[Mesh Error] MeshChecker::checkOverlappingElements --> "
-          "Overlapping element detected on element %zd \n",
-          overlappingList[i]->id());
+MeshCheckResult elementSizes(Mesh *mesh, double minimumElementSize) {
+  MeshCheckResult r;
+  r.name = "elementSizes";
+  const size_t ne = mesh->numElements();
+  std::vector<double> size(ne);
+#pragma omp parallel for schedule(static) default(none) shared(mesh, size, ne)
+  for (signed long long i = 0; i < static_cast<signed long long>(ne); ++i) {
+    size[i] = mesh->element(i)->elementSize();
+  }
+  for (size_t i = 0; i < ne; ++i) {
+    if (size[i] < minimumElementSize) {
+      r.elements.push_back(mesh->element(i)->id());
+      addMessage(r, boost::str(boost::format("Element %i has size %f, which "
+                                             "is less than %f") %
+                               mesh->element(i)->id() % size[i] %
+                               minimumElementSize));
     }
-    return false;
-  } else {
-    return true;
   }
+  r.passed = r.elements.empty();
+  return r;
 }
 
-bool MeshChecker::checkDisjointNodes(Mesh *mesh, const std::string &logFile) {
-  bool passed = true;
-  std::vector<bool> found;
-  found.resize(mesh->numNodes());
-  std::fill(found.begin(), found.end(), false);
-
-  for (size_t i = 0; i < mesh->numElements(); i++) {
-    for (size_t j = 0; j < mesh->element(i)->n(); j++) {
-      size_t index = mesh->nodeIndexById(mesh->element(i)->node(j)->id());
-      found[index] = true;
+size_t boundaryNodeIndex(Mesh *mesh, const Node *n) {
+  const size_t nn = mesh->numNodes();
+  const Node *first = mesh->node(0);
+  const size_t index = static_cast<size_t>(n - first);
+  return n >= first && index < nn ? index : mesh->nodeIndexById(n->id());
+}
+
+MeshCheckResult missingBoundaryConditions(Mesh *mesh, const MeshTopology &t) {
+  MeshCheckResult r;
+  r.name = "missingBoundaryConditions";
+  if (mesh->numNodes() == 0) return r;
+
+  //...Nodes on an edge used by a single element lie on the mesh boundary
+  NodeBitset onBoundary(mesh->numNodes());
+  forEachEdge(t, [&](size_t a, size_t b, size_t first, size_t last) {
+    if (last - first == 1) {
+      onBoundary.set(a);
+      onBoundary.set(b);
     }
-  }
+  });
 
-  std::ofstream log;
-  size_t n = 0;
-  bool writeLog = false;
-  if (logFile != "none") {
-    writeLog = true;
-    log.open(logFile);
-  }
-
-  for (size_t i = 0; i < mesh->numNodes(); i++) {
-    if (found[i] == false) {
-      n++;
-      printf(
-          "[Mesh Error] MeshChecker::checkDisjointNodes --> Node %zd is not "
-          "connected to any element.",
-          mesh->node(i)->id());
-      if (writeLog)
-        log << boost::str(boost::format("%14.8e, %14.8e, %11i\n") %
-                          mesh->node(i)->x() % mesh->node(i)->y() %
-                          mesh->node(i)->id());
-      passed = false;
+  NodeBitset hasCondition(mesh->numNodes());
+  for (size_t i = 0; i < mesh->numOpenBoundaries(); ++i) {
+    const Boundary *bc = mesh->openBoundary(i);
+    for (size_t j = 0; j < bc->length(); ++j) {
+      hasCondition.set(boundaryNodeIndex(mesh, bc->node1(j)));
+    }
+  }
+  for (size_t i = 0; i < mesh->numLandBoundaries(); ++i) {
+    const Boundary *bc = mesh->landBoundary(i);
+    for (size_t j = 0; j < bc->length(); ++j) {
+      hasCondition.set(boundaryNodeIndex(mesh, bc->node1(j)));
+      if (bc->isInternalWeir()) {
+        hasCondition.set(boundaryNodeIndex(mesh, bc->node2(j)));
+      }
     }
   }
 
-  if (writeLog) {
-    log.close();
-    if (n == 0) {
-      std::remove(logFile.c_str());
+  for (size_t i = 0; i < mesh->numNodes(); ++i) {
+    if (onBoundary.test(i) && !hasCondition.test(i)) {
+      r.nodes.push_back(mesh->node(i)->id());
     }
   }
+  if (!r.nodes.empty()) {
+    addMessage(r, boost::str(boost::format("Found %i boundary nodes without "
+                                           "boundary condition") %
+                             r.nodes.size()));
+  }
+  r.passed = r.nodes.empty();
+  return r;
+}
 
-  return passed;
+MeshCheckResult runCheck(size_t check, Mesh *mesh, const MeshTopology &t) {
+  switch (check) {
+    case 0:
+      return nodeNumbering(mesh);
+    case 1:
+      return elementNumbering(mesh);
+    case 2:
+      return nodalElevations(mesh, c_minimumNodalElevation);
+    case 3:
+      return disjointNodes(mesh, t);
+    case 4:
+      return overlappingElements(mesh, t);
+    case 5:
+      return leveeHeights(mesh, c_minimumCrestElevationOverTopography);
+    case 6:
+      return pipeHeights(mesh);
+    case 7:
+      return elementSizes(mesh, c_minimumElementSize);
+    case 8:
+      return missingBoundaryConditions(mesh, t);
+    case 9:
+      return intersectingElements(mesh);
+    default:
+      adcircmodules_throw_exception("MeshChecker: Unknown check");
+  }
+  return MeshCheckResult();
 }
 
-bool MeshChecker::checkPipeHeights(Mesh *mesh) {
-  bool passed = true;
-  for (size_t i = 0; i < mesh->numLandBoundaries(); i++) {
-    if (mesh->landBoundary(i)->isInternalWeirWithPipes()) {
-      for (size_t j = 0; j < mesh->landBoundary(i)->length(); j++) {
-        double topOfPipe = mesh->landBoundary(i)->pipeHeight(j) +
-                           0.5 * mesh->landBoundary(i)->pipeDiameter(j);
-        double bottomOfPipe = mesh->landBoundary(i)->pipeHeight(j) -
-                              0.5 * mesh->landBoundary(i)->pipeDiameter(j);
-        double crest = mesh->landBoundary(i)->crestElevation(j);
-        if (topOfPipe > crest) {
-          passed = false;
-          printf(
-              "[Mesh Error] MeshChecker::checkPipeHeights --> Top of pipe > "
-              "weir crest elevation at nodes %zd and %zd.",
-              mesh->landBoundary(i)->node1(j)->id(),
-              mesh->landBoundary(i)->node2(j)->id());
-        }
-        if (bottomOfPipe < mesh->landBoundary(i)->node1(j)->z() ||
-            bottomOfPipe < mesh->landBoundary(i)->node2(j)->z()) {
-          passed = false;
-          printf(
-              "[Mesh Error] MeshChecker::checkPipeHeights --> Bottom of pipe < "
-              "nodal elevation at nodes %zd and %zd.",
-              mesh->landBoundary(i)->node1(j)->id(),
-              mesh->landBoundary(i)->node2(j)->id());
-        }
-      }
-    }
+/**
+ * @brief Prints the messages of a check result
+ * @return true if the check passed
+ */
+bool printResult(const MeshCheckResult &r, const std::string &function) {
+  for (const auto &m : r.messages) {
+    printf("[Mesh Error] MeshChecker::%s --> %s.\n", function.c_str(),
+           m.c_str());
+  }
+  const size_t count = std::max(r.nodes.size(), r.elements.size());
+  if (count > r.messages.size() && r.messages.size() == c_maxMessages) {
+    printf("[Mesh Error] MeshChecker::%s --> %zu further problems found.\n",
+           function.c_str(), count - r.messages.size());
   }
-  return passed;
+  return r.passed;
 }
 
-bool MeshChecker::checkElementSizes(Mesh *mesh, double minimumElementSize) {
-  bool passed = true;
-  std::vector<double> element_size;
-  element_size.resize(mesh->numElements());
-  for (size_t i = 0; i < mesh->numElements(); i++) {
-    double size = mesh->element(i)->elementSize();
-    if (size < minimumElementSize) {
-      passed = false;
-      printf(
-          "[Mesh Error] MeshChecker::checkElementSizes --> Element %zd has "
-          "size "
-          "%f, which is less than %f\n",
-          mesh->element(i)->id(), size, minimumElementSize);
-    }
+/**
+ * @brief Writes the coordinates of the nodes listed in a check result
+ */
+void writeNodeLog(Mesh *mesh, const MeshCheckResult &r,
+                  const std::string &logFile) {
+  if (logFile == "none") return;
+  if (r.nodes.empty()) {
+    std::remove(logFile.c_str());
+    return;
   }
-  return passed;
+  std::ofstream log(logFile);
+  for (auto id : r.nodes) {
+    const Node *n = mesh->nodeById(id);
+    log << boost::str(boost::format("%14.8e, %14.8e, %11i\n") % n->x() %
+                      n->y() % n->id());
+  }
+  log.close();
 }
 
-bool MeshChecker::checkMissingBoundaryConditions(Mesh *mesh,
-                                                 const std::string &logFile) {
-  bool passed = true;
-  bool writeLog = false;
-  std::ofstream log;
-  std::vector<Adcirc::Geometry::Node *> boundaryNodes = mesh->boundaryNodes();
-  std::vector<bool> found(boundaryNodes.size());
-  std::fill(found.begin(), found.end(), false);
+}  // namespace
 
-  for (size_t i = 0; i < mesh->numOpenBoundaries(); ++i) {
-    for (size_t j = 0; j < mesh->openBoundary(i)->length(); ++j) {
-      auto it = std::find(boundaryNodes.begin(), boundaryNodes.end(),
-                          mesh->openBoundary(i)->node1(j));
-      if (it != boundaryNodes.end()) {
-        size_t d = std::distance(boundaryNodes.begin(), it);
-        found[d] = true;
-      }
-    }
-  }
+MeshChecker::MeshChecker(Mesh *mesh)
+    : m_mesh(mesh), m_progressMonitor(nullptr) {}
 
-  for (size_t i = 0; i < mesh->numLandBoundaries(); ++i) {
-    for (size_t j = 0; j < mesh->landBoundary(i)->length(); ++j) {
-      auto it = std::find(boundaryNodes.begin(), boundaryNodes.end(),
-                          mesh->landBoundary(i)->node1(j));
-      if (it != boundaryNodes.end()) {
-        size_t d = std::distance(boundaryNodes.begin(), it);
-        found[d] = true;
-      }
-      if (mesh->landBoundary(i)->isInternalWeir()) {
-        auto it2 = std::find(boundaryNodes.begin(), boundaryNodes.end(),
-                             mesh->landBoundary(i)->node2(j));
-        if (it2 != boundaryNodes.end()) {
-          size_t d = std::distance(boundaryNodes.begin(), it2);
-          found[d] = true;
-        }
-      }
-    }
+/**
+ * @brief Returns the progress monitor used by checkMesh
+ * @return progress monitor, or nullptr if none has been set
+ */
+Adcirc::ProgressMonitor *MeshChecker::progressMonitor() const {
+  return this->m_progressMonitor;
+}
+
+/**
+ * @brief Sets a progress monitor which receives progress as each check in
+ * checkMesh is completed. Cancelling the monitor stops checkMesh once the
+ * running checks complete and throws an exception
+ * @param[in] monitor progress monitor. The monitor is not owned by this object
+ */
+void MeshChecker::setProgressMonitor(Adcirc::ProgressMonitor *monitor) {
+  this->m_progressMonitor = monitor;
+}
+
+/**
+ * @brief Runs all mesh checks and prints the problems found. The disjoint
+ * node and missing boundary condition nodes are written to
+ * meshchecker_disjointNodes.txt and meshchecker_missingBoundaries.txt
+ * @param[in] ignoreNonfatal retained for compatibility. All checks are always
+ * run, so this no longer changes the result
+ * @return true if every check passed
+ */
+bool MeshChecker::checkMesh(bool ignoreNonfatal) {
+  (void)ignoreNonfatal;
+  this->runChecks();
+
+  const std::pair<const char *, const char *> checks[c_numChecks] = {
+      {"nodeNumbering", "Node numbering check failed"},
+      {"elementNumbering", "Element numbering check failed"},
+      {"nodalElevations", "Nodal elevation check failed"},
+      {"disjointNodes", "Disjoint nodes found"},
+      {"overlappingElements", "Overlapping elements found"},
+      {"leveeHeights", "Levee height check failed"},
+      {"pipeHeights", "Pipe height check failed"},
+      {"elementSizes", "Element size check failed"},
+      {"missingBoundaryConditions",
+       "Missing boundary condition nodes found"},
+      {"intersectingElements", "Intersecting elements found"}};
+
+  for (const auto &c : checks) {
+    const MeshCheckResult *r = this->m_report.result(c.first);
+    if (r == nullptr || r->passed) continue;
+    printResult(*r, c.first);
+    printf("MeshChecker::checkMesh --> %s.\n", c.second);
   }
 
-  if (logFile != "none") {
-    writeLog = true;
-    log.open(logFile);
+  writeNodeLog(this->m_mesh, *this->m_report.result("disjointNodes"),
+               "meshchecker_disjointNodes.txt");
+  writeNodeLog(this->m_mesh,
+               *this->m_report.result("missingBoundaryConditions"),
+               "meshchecker_missingBoundaries.txt");
+
+  return this->m_report.passed();
+}
+
+/**
+ * @brief Runs all mesh checks concurrently without printing
+ *
+ * The node and edge connectivity is built once and shared by the checks,
+ * which then run as independent tasks. Edges are grouped by their lower node
+ * so that shared and boundary edges are found in linear time.
+ *
+ * @return report containing the result of each check
+ */
+const MeshCheckReport &MeshChecker::runChecks() {
+  if (this->m_mesh == nullptr) {
+    adcircmodules_throw_exception("MeshChecker: Mesh has not been specified");
+  }
+  Adcirc::ProgressMonitor *monitor = this->m_progressMonitor;
+  if (monitor) monitor->begin(c_numChecks);
+
+  //...Errors are held until the monitor has been finished so that it is
+  //   never left running when this function throws
+  std::vector<MeshCheckResult> results(c_numChecks);
+  std::exception_ptr error = nullptr;
+  MeshTopology topology;
+  try {
+    topology = buildTopology(this->m_mesh);
+  } catch (...) {
+    error = std::current_exception();
   }
 
-  size_t n = 0;
-  for (size_t i = 0; i < found.size(); ++i) {
-    if (!found[i]) {
-      passed = false;
-      n++;
-      if (writeLog) {
-        log << boost::str(boost::format("%14.8e, %14.8e, %11i\n") %
-                          boundaryNodes[i]->x() % boundaryNodes[i]->y() %
-                          boundaryNodes[i]->id());
+  if (!error) {
+#pragma omp parallel for schedule(dynamic, 1) default(none) \
+    shared(results, topology, error, monitor)
+    for (signed long long i = 0;
+         i < static_cast<signed long long>(c_numChecks); ++i) {
+      if (monitor && monitor->isCancelled()) continue;
+      try {
+        results[i] = runCheck(i, this->m_mesh, topology);
+      } catch (...) {
+#pragma omp critical(meshchecker_error)
+        if (!error) error = std::current_exception();
       }
+      if (monitor) monitor->increment();
     }
   }
 
-  if (n > 0) {
-    printf(
-        "[Mesh Error] MeshChecker::checkMissingBoundaryConditions --> Found "
-        "%zu boundary nodes without boundary condition.\n",
-        n);
-  } else {
-    if (writeLog) std::remove(logFile.c_str());
+  if (monitor) monitor->finish();
+  if (error) std::rethrow_exception(error);
+  if (monitor && monitor->isCancelled()) {
+    adcircmodules_throw_exception("MeshChecker: Operation cancelled");
   }
 
-  if (writeLog) log.close();
+  this->m_report = MeshCheckReport();
+  this->m_report.setMeshFilename(this->m_mesh->filename());
+  this->m_report.setMeshSize(this->m_mesh->numNodes(),
+                             this->m_mesh->numElements());
+  for (auto &r : results) this->m_report.addResult(r);
+  return this->m_report;
+}
+
+/**
+ * @brief Returns the report generated by the last call to checkMesh or
+ * runChecks
+ * @return mesh check report
+ */
+const MeshCheckReport &MeshChecker::report() const { return this->m_report; }
+
+bool MeshChecker::checkNodeNumbering(Mesh *mesh) {
+  return printResult(nodeNumbering(mesh), "checkNodeNumbering");
+}
+
+bool MeshChecker::checkElementNumbering(Mesh *mesh) {
+  return printResult(elementNumbering(mesh), "checkElementNumbering");
+}
+
+bool MeshChecker::checkNodalElevations(Mesh *mesh,
+                                       double minimumNodalElevation) {
+  return printResult(nodalElevations(mesh, minimumNodalElevation),
+                     "checkNodalElevations");
+}
+
+bool MeshChecker::checkLeveeHeights(
+    Mesh *mesh, double minimumCrestElevationOverTopography) {
+  return printResult(leveeHeights(mesh, minimumCrestElevationOverTopography),
+                     "checkLeveeHeights");
+}
+
+bool MeshChecker::checkOverlappingElements(Mesh *mesh) {
+  return printResult(overlappingElements(mesh, buildTopology(mesh)),
+                     "checkOverlappingElements");
+}
+
+bool MeshChecker::checkIntersectingElements(Mesh *mesh) {
+  return printResult(intersectingElements(mesh), "checkIntersectingElements");
+}
+
+bool MeshChecker::checkDisjointNodes(Mesh *mesh, const std::string &logFile) {
+  MeshCheckResult r = disjointNodes(mesh, buildTopology(mesh));
+  writeNodeLog(mesh, r, logFile);
+  return printResult(r, "checkDisjointNodes");
+}
+
+bool MeshChecker::checkPipeHeights(Mesh *mesh) {
+  return printResult(pipeHeights(mesh), "checkPipeHeights");
+}
+
+bool MeshChecker::checkElementSizes(Mesh *mesh, double minimumElementSize) {
+  return printResult(elementSizes(mesh, minimumElementSize),
+                     "checkElementSizes");
+}
+
+bool MeshChecker::checkMissingBoundaryConditions(Mesh *mesh,
+                                                 const std::string &logFile) {
+  MeshCheckResult r = missingBoundaryConditions(mesh, buildTopology(mesh));
+  writeNodeLog(mesh, r, logFile);
+  return printResult(r, "checkMissingBoundaryConditions");
+}
+
+
+/**
+ * @brief Computes the bandwidth and profile of the node connectivity, which
+ * measure how far apart in memory the nodes of each element are stored
+ * @param[in] mesh mesh to evaluate
+ * @param[out] bandwidth largest difference between the indices of two nodes
+ * of the same element
+ * @param[out] profile sum over all nodes of the distance to the lowest indexed
+ * node sharing an element with it
+ */
+void MeshChecker::computeBandwidth(Mesh *mesh, size_t &bandwidth,
+                                   size_t &profile) {
+  const size_t nn = mesh->numNodes();
+  const std::vector<size_t> vertex = mesh->elementVertexIndices();
+  std::vector<size_t> lowest(nn);
+  for (size_t i = 0; i < nn; ++i) lowest[i] = i;
+
+  bandwidth = 0;
+  for (size_t i = 0; i < mesh->numElements(); ++i) {
+    const size_t n = mesh->element(i)->n();
+    if (n == 0) continue;
+    const size_t *v = &vertex[c_maxVertices * i];
+    const size_t lo = *std::min_element(v, v + n);
+    const size_t hi = *std::max_element(v, v + n);
+    bandwidth = std::max(bandwidth, hi - lo);
+    for (size_t j = 0; j < n; ++j) lowest[v[j]] = std::min(lowest[v[j]], lo);
+  }
+
+  profile = 0;
+  for (size_t i = 0; i < nn; ++i) profile += i - lowest[i];
+}
 
-  return passed;
+/**
+ * @brief Prints the bandwidth and profile of the node connectivity. Large
+ * values indicate that Mesh::reorder may improve performance
+ * @param[in] mesh mesh to evaluate
+ */
+void MeshChecker::printBandwidthReport(Mesh *mesh) {
+  size_t bandwidth, profile;
+  MeshChecker::computeBandwidth(mesh, bandwidth, profile);
+  const double average =
+      mesh->numNodes() > 0
+          ? static_cast<double>(profile) / static_cast<double>(mesh->numNodes())
+          : 0.0;
+  printf(
+      "[Mesh Info] MeshChecker::printBandwidthReport --> Bandwidth: %zu, "
+      "Profile: %zu, Average row width: %0.2f\n",
+      bandwidth, profile, average);
 }
 
 }  // namespace Utility
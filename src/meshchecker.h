@@ -21,6 +21,8 @@
 
 #include "adcircmodules_global.h"
 #include "mesh.h"
+#include "meshcheckreport.h"
+#include "progressmonitor.h"
 
 namespace Adcirc {
 
@@ -32,6 +34,12 @@ class MeshChecker {
 
   bool ADCIRCMODULES_EXPORT checkMesh(bool ignoreNonfatal = true);
 
+  const Adcirc::Utility::MeshCheckReport ADCIRCMODULES_EXPORT &runChecks();
+  const Adcirc::Utility::MeshCheckReport ADCIRCMODULES_EXPORT &report() const;
+
+  Adcirc::ProgressMonitor ADCIRCMODULES_EXPORT *progressMonitor() const;
+  void ADCIRCMODULES_EXPORT setProgressMonitor(Adcirc::ProgressMonitor *monitor);
+
   static bool ADCIRCMODULES_EXPORT checkLeveeHeights(
       Adcirc::Geometry::Mesh *mesh, double minimumCrestElevationOverTopography);
   static bool ADCIRCMODULES_EXPORT
@@ -42,6 +50,8 @@ class MeshChecker {
       Adcirc::Geometry::Mesh *mesh, double minimumNodalelevation);
   static bool ADCIRCMODULES_EXPORT
   checkOverlappingElements(Adcirc::Geometry::Mesh *mesh);
+  static bool ADCIRCMODULES_EXPORT
+  checkIntersectingElements(Adcirc::Geometry::Mesh *mesh);
   static bool ADCIRCMODULES_EXPORT checkDisjointNodes(
       Adcirc::Geometry::Mesh *mesh, const std::string &logFile = "none");
   static bool ADCIRCMODULES_EXPORT
@@ -50,13 +60,15 @@ class MeshChecker {
   checkElementSizes(Adcirc::Geometry::Mesh *mesh, double minimumElementSize);
   static bool ADCIRCMODULES_EXPORT checkMissingBoundaryConditions(
       Adcirc::Geometry::Mesh *mesh, const std::string &logFile = "none");
+  static void ADCIRCMODULES_EXPORT computeBandwidth(
+      Adcirc::Geometry::Mesh *mesh, size_t &bandwidth, size_t &profile);
+  static void ADCIRCMODULES_EXPORT
+  printBandwidthReport(Adcirc::Geometry::Mesh *mesh);
 
  private:
   Adcirc::Geometry::Mesh *m_mesh;
-
-  static void printFailedLeveeStatus(
-      Adcirc::Geometry::Boundary *bc, size_t index,
-      double minimumCrestElevationOverTopography);
+  Adcirc::ProgressMonitor *m_progressMonitor;
+  Adcirc::Utility::MeshCheckReport m_report;
 };
 }  // namespace Utility
 }  // namespace Adcirc
@@ -0,0 +1,215 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "meshcheckreport.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "logging.h"
+
+using namespace Adcirc::Utility;
+
+namespace {
+
+void appendJsonString(std::string &s, const std::string &value) {
+  s += '"';
+  for (const char c : value) {
+    switch (c) {
+      case '"':
+        s += "\\\"";
+        break;
+      case '\\':
+        s += "\\\\";
+        break;
+      case '\n':
+        s += "\\n";
+        break;
+      case '\t':
+        s += "\\t";
+        break;
+      case '\r':
+        s += "\\r";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buffer[8];
+          snprintf(buffer, sizeof(buffer), "\\u%04x",
+                   static_cast<unsigned int>(static_cast<unsigned char>(c)));
+          s += buffer;
+        } else {
+          s += c;
+        }
+    }
+  }
+  s += '"';
+}
+
+void appendJsonArray(std::string &s, const std::vector<size_t> &values) {
+  s += '[';
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (i > 0) s += ',';
+    s += std::to_string(values[i]);
+  }
+  s += ']';
+}
+
+const char *jsonBool(bool value) { return value ? "true" : "false"; }
+
+}  // namespace
+
+MeshCheckReport::MeshCheckReport()
+    : m_meshFilename("none"), m_numNodes(0), m_numElements(0) {}
+
+/**
+ * @brief Returns the filename of the mesh that was checked
+ * @return filename
+ */
+std::string MeshCheckReport::meshFilename() const {
+  return this->m_meshFilename;
+}
+
+/**
+ * @brief Sets the filename of the mesh that was checked
+ * @param[in] filename mesh filename
+ */
+void MeshCheckReport::setMeshFilename(const std::string &filename) {
+  this->m_meshFilename = filename;
+}
+
+/**
+ * @brief Returns the number of nodes in the mesh that was checked
+ * @return number of nodes
+ */
+size_t MeshCheckReport::numNodes() const { return this->m_numNodes; }
+
+/**
+ * @brief Returns the number of elements in the mesh that was checked
+ * @return number of elements
+ */
+size_t MeshCheckReport::numElements() const { return this->m_numElements; }
+
+/**
+ * @brief Sets the size of the mesh that was checked
+ * @param[in] numNodes number of nodes
+ * @param[in] numElements number of elements
+ */
+void MeshCheckReport::setMeshSize(size_t numNodes, size_t numElements) {
+  this->m_numNodes = numNodes;
+  this->m_numElements = numElements;
+}
+
+/**
+ * @brief Returns true if every check passed
+ * @return pass/fail
+ */
+bool MeshCheckReport::passed() const {
+  for (const auto &r : this->m_results) {
+    if (!r.passed) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the number of check results in the report
+ * @return number of results
+ */
+size_t MeshCheckReport::numResults() const { return this->m_results.size(); }
+
+/**
+ * @brief Adds the result of a check to the report
+ * @param[in] result check result
+ */
+void MeshCheckReport::addResult(const MeshCheckResult &result) {
+  this->m_results.push_back(result);
+}
+
+/**
+ * @brief Returns a check result by position
+ * @param[in] index position of the result
+ * @return check result
+ */
+const MeshCheckResult &MeshCheckReport::result(size_t index) const {
+  if (index >= this->m_results.size()) {
+    adcircmodules_throw_exception("MeshCheckReport: Index out of range");
+  }
+  return this->m_results[index];
+}
+
+/**
+ * @brief Returns a check result by name
+ * @param[in] name name of the check
+ * @return pointer to the check result, or nullptr if the check is not in the
+ * report
+ */
+const MeshCheckResult *MeshCheckReport::result(const std::string &name) const {
+  for (const auto &r : this->m_results) {
+    if (r.name == name) return &r;
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Serializes the report to a JSON document
+ * @return JSON string
+ */
+std::string MeshCheckReport::toJson() const {
+  std::string s = "{\n  \"mesh\": ";
+  appendJsonString(s, this->m_meshFilename);
+  s += ",\n  \"numNodes\": " + std::to_string(this->m_numNodes);
+  s += ",\n  \"numElements\": " + std::to_string(this->m_numElements);
+  s += ",\n  \"passed\": ";
+  s += jsonBool(this->passed());
+  s += ",\n  \"checks\": [";
+  for (size_t i = 0; i < this->m_results.size(); ++i) {
+    const MeshCheckResult &r = this->m_results[i];
+    s += i > 0 ? ",\n    {" : "\n    {";
+    s += "\"name\": ";
+    appendJsonString(s, r.name);
+    s += ", \"passed\": ";
+    s += jsonBool(r.passed);
+    s += ", \"fatal\": ";
+    s += jsonBool(r.fatal);
+    s += ", \"nodes\": ";
+    appendJsonArray(s, r.nodes);
+    s += ", \"elements\": ";
+    appendJsonArray(s, r.elements);
+    s += ", \"messages\": [";
+    for (size_t j = 0; j < r.messages.size(); ++j) {
+      if (j > 0) s += ", ";
+      appendJsonString(s, r.messages[j]);
+    }
+    s += "]}";
+  }
+  s += this->m_results.empty() ? "]\n}\n" : "\n  ]\n}\n";
+  return s;
+}
+
+/**
+ * @brief Writes the report to a JSON file
+ * @param[in] filename output file
+ */
+void MeshCheckReport::writeJson(const std::string &filename) const {
+  std::ofstream fid(filename, std::ios::trunc);
+  if (!fid.is_open()) {
+    adcircmodules_throw_exception("MeshCheckReport: Could not open " +
+                                  filename);
+  }
+  fid << this->toJson();
+  fid.close();
+}
@@ -0,0 +1,90 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_MESHCHECKREPORT_H
+#define ADCMOD_MESHCHECKREPORT_H
+
+#include <string>
+#include <vector>
+
+#include "adcircmodules_global.h"
+
+namespace Adcirc {
+
+namespace Utility {
+
+/**
+ * @brief Outcome of a single mesh check
+ */
+struct MeshCheckResult {
+  /// Name of the check
+  std::string name;
+  /// True if no problems were found
+  bool passed = true;
+  /// True if a failure of this check makes the mesh unusable
+  bool fatal = false;
+  /// Ids of the nodes that failed the check
+  std::vector<size_t> nodes;
+  /// Ids of the elements that failed the check
+  std::vector<size_t> elements;
+  /// Descriptions of the first problems found
+  std::vector<std::string> messages;
+};
+
+/**
+ * @class MeshCheckReport
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Collection of the results produced by MeshChecker
+ *
+ * The report can be serialized to JSON so that the results of a mesh check
+ * can be consumed by other tools.
+ */
+class MeshCheckReport {
+ public:
+  ADCIRCMODULES_EXPORT MeshCheckReport();
+
+  std::string ADCIRCMODULES_EXPORT meshFilename() const;
+  void ADCIRCMODULES_EXPORT setMeshFilename(const std::string &filename);
+
+  size_t ADCIRCMODULES_EXPORT numNodes() const;
+  size_t ADCIRCMODULES_EXPORT numElements() const;
+  void ADCIRCMODULES_EXPORT setMeshSize(size_t numNodes, size_t numElements);
+
+  bool ADCIRCMODULES_EXPORT passed() const;
+
+  size_t ADCIRCMODULES_EXPORT numResults() const;
+  void ADCIRCMODULES_EXPORT addResult(const MeshCheckResult &result);
+  const MeshCheckResult ADCIRCMODULES_EXPORT &result(size_t index) const;
+  const MeshCheckResult ADCIRCMODULES_EXPORT *result(
+      const std::string &name) const;
+
+  std::string ADCIRCMODULES_EXPORT toJson() const;
+  void ADCIRCMODULES_EXPORT writeJson(const std::string &filename) const;
+
+ private:
+  std::string m_meshFilename;
+  size_t m_numNodes;
+  size_t m_numElements;
+  std::vector<MeshCheckResult> m_results;
+};
+}  // namespace Utility
+}  // namespace Adcirc
+
+#endif  // ADCMOD_MESHCHECKREPORT_H
@@ -0,0 +1,635 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "meshdiff.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+#include "boost/format.hpp"
+#include "fpcompare.h"
+#include "logging.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Adcirc::Geometry;
+using namespace Adcirc::Utility;
+
+constexpr size_t MeshDiff::NOT_FOUND;
+
+namespace {
+
+//...Number of partitions used for the parallel hash join. Each partition
+//   is an independent hash table built by a single thread
+constexpr size_t c_numPartitions = 64;
+
+struct CellKey {
+  int64_t x;
+  int64_t y;
+  bool operator==(const CellKey &k) const { return x == k.x && y == k.y; }
+};
+
+struct ElementKey {
+  std::array<size_t, 4> v;
+  bool operator==(const ElementKey &k) const { return v == k.v; }
+};
+
+inline uint64_t mixHash(uint64_t h, uint64_t v) {
+  h ^= v + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+  h ^= h >> 31;
+  h *= 0xBF58476D1CE4E5B9ULL;
+  return h ^ (h >> 29);
+}
+
+struct CellKeyHash {
+  size_t operator()(const CellKey &k) const {
+    return static_cast<size_t>(
+        mixHash(mixHash(0, static_cast<uint64_t>(k.x)),
+                static_cast<uint64_t>(k.y)));
+  }
+};
+
+/**
+ * @brief Hash table split into independent partitions so that it can be
+ * built in parallel and probed concurrently. Each partition is an open
+ * addressed table with linear probing. The first occurrence of a key is kept
+ */
+template <typename Key, typename KeyHash>
+class PartitionedTable {
+ public:
+  void build(const std::vector<Key> &keys, const std::vector<char> &valid) {
+    const size_t n = keys.size();
+    std::vector<size_t> hash(n);
+
+#pragma omp parallel for schedule(static) default(none) shared(keys, hash, n)
+    for (signed long long i = 0; i < static_cast<signed long long>(n); ++i) {
+      hash[i] = KeyHash()(keys[i]);
+    }
+
+    std::array<size_t, c_numPartitions + 1> offset{};
+    for (size_t i = 0; i < n; ++i) {
+      if (valid[i]) offset[PartitionedTable::partitionOf(hash[i]) + 1]++;
+    }
+    for (size_t p = 0; p < c_numPartitions; ++p) offset[p + 1] += offset[p];
+
+    std::vector<size_t> order(offset[c_numPartitions]);
+    std::array<size_t, c_numPartitions> position;
+    std::copy(offset.begin(), offset.end() - 1, position.begin());
+    for (size_t i = 0; i < n; ++i) {
+      if (!valid[i]) continue;
+      order[position[PartitionedTable::partitionOf(hash[i])]++] = i;
+    }
+
+#pragma omp parallel for schedule(dynamic) default(none) \
+    shared(keys, hash, offset, order)
+    for (signed long long p = 0;
+         p < static_cast<signed long long>(c_numPartitions); ++p) {
+      auto &table = this->m_partitions[p];
+      size_t capacity = 16;
+      while (capacity < 2 * (offset[p + 1] - offset[p])) capacity *= 2;
+      table.mask = capacity - 1;
+      table.slots.assign(capacity, Slot{Key(), MeshDiff::NOT_FOUND});
+      for (size_t k = offset[p]; k < offset[p + 1]; ++k) {
+        const size_t index = order[k];
+        size_t s = hash[index] & table.mask;
+        while (table.slots[s].index != MeshDiff::NOT_FOUND &&
+               !(table.slots[s].key == keys[index])) {
+          s = (s + 1) & table.mask;
+        }
+        if (table.slots[s].index == MeshDiff::NOT_FOUND) {
+          table.slots[s] = Slot{keys[index], index};
+        }
+      }
+    }
+  }
+
+  size_t find(const Key &key) const {
+    const size_t h = KeyHash()(key);
+    const auto &table = this->m_partitions[PartitionedTable::partitionOf(h)];
+    size_t s = h & table.mask;
+    while (table.slots[s].index != MeshDiff::NOT_FOUND) {
+      if (table.slots[s].key == key) return table.slots[s].index;
+      s = (s + 1) & table.mask;
+    }
+    return MeshDiff::NOT_FOUND;
+  }
+
+ private:
+  struct Slot {
+    Key key;
+    size_t index;
+  };
+
+  struct Partition {
+    std::vector<Slot> slots;
+    size_t mask = 0;
+  };
+
+  //...The partition is taken from the high bits so that it is independent
+  //   of the slot, which is taken from the low bits
+  static size_t partitionOf(size_t hash) {
+    return static_cast<size_t>(static_cast<uint64_t>(hash) >> 58);
+  }
+
+  std::array<Partition, c_numPartitions> m_partitions;
+};
+
+inline bool withinTolerance(const Node *a, const Node *b, double tolerance) {
+  return std::abs(a->x() - b->x()) <= tolerance &&
+         std::abs(a->y() - b->y()) <= tolerance;
+}
+
+inline CellKey quantize(double x, double y, double tolerance) {
+  return CellKey{static_cast<int64_t>(std::llround(x / tolerance)),
+                 static_cast<int64_t>(std::llround(y / tolerance))};
+}
+
+ElementKey sortedKey(const size_t *v, size_t n) {
+  ElementKey k;
+  k.v.fill(MeshDiff::NOT_FOUND);
+  std::copy(v, v + n, k.v.begin());
+  std::sort(k.v.begin(), k.v.end());
+  return k;
+}
+
+/**
+ * @brief Checks if two vertex lists describe the same element with the same
+ * vertex ordering, allowing for a rotation of the starting vertex
+ */
+bool sameOrdering(const size_t *a, const size_t *b, size_t n) {
+  for (size_t k = 0; k < n; ++k) {
+    if (b[k] != a[0]) continue;
+    for (size_t j = 0; j < n; ++j) {
+      if (a[j] != b[(k + j) % n]) return false;
+    }
+    return true;
+  }
+  return false;
+}
+
+std::string boundaryKey(const Boundary *b, const std::vector<size_t> *map,
+                        const std::vector<size_t> &node1,
+                        const std::vector<size_t> &node2, bool &valid) {
+  std::string key;
+  key.reserve(sizeof(int) + (node1.size() + node2.size()) * sizeof(size_t));
+  const int code = b->boundaryCode();
+  key.append(reinterpret_cast<const char *>(&code), sizeof(int));
+  valid = true;
+  for (const auto *list : {&node1, &node2}) {
+    for (auto n : *list) {
+      size_t v = map ? (*map)[n] : n;
+      if (v == MeshDiff::NOT_FOUND) valid = false;
+      key.append(reinterpret_cast<const char *>(&v), sizeof(size_t));
+    }
+  }
+  return key;
+}
+
+bool sameAttributes(const Boundary *a, const Boundary *b) {
+  if (!a->isWeir()) return true;
+  for (size_t i = 0; i < a->boundaryLength(); ++i) {
+    if (!Adcirc::FpCompare::equalTo(a->crestElevation(i),
+                                    b->crestElevation(i)) ||
+        !Adcirc::FpCompare::equalTo(a->supercriticalWeirCoefficient(i),
+                                    b->supercriticalWeirCoefficient(i))) {
+      return false;
+    }
+    if (a->isInternalWeir() &&
+        !Adcirc::FpCompare::equalTo(a->subcriticalWeirCoefficient(i),
+                                    b->subcriticalWeirCoefficient(i))) {
+      return false;
+    }
+    if (a->isInternalWeirWithPipes() &&
+        (!Adcirc::FpCompare::equalTo(a->pipeHeight(i), b->pipeHeight(i)) ||
+         !Adcirc::FpCompare::equalTo(a->pipeDiameter(i), b->pipeDiameter(i)) ||
+         !Adcirc::FpCompare::equalTo(a->pipeCoefficient(i),
+                                     b->pipeCoefficient(i)))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Boundary *boundaryAt(Mesh *mesh, size_t position) {
+  return position < mesh->numOpenBoundaries()
+             ? mesh->openBoundary(position)
+             : mesh->landBoundary(position - mesh->numOpenBoundaries());
+}
+
+void boundaryNodeIndices(Mesh *mesh, const Boundary *b,
+                         std::vector<size_t> &node1,
+                         std::vector<size_t> &node2) {
+  node1.resize(b->boundaryLength());
+  node2.clear();
+  for (size_t i = 0; i < b->boundaryLength(); ++i) {
+    node1[i] = mesh->nodeIndexById(b->node1(i)->id());
+  }
+  if (b->isInternalWeir()) {
+    node2.resize(b->boundaryLength());
+    for (size_t i = 0; i < b->boundaryLength(); ++i) {
+      node2[i] = mesh->nodeIndexById(b->node2(i)->id());
+    }
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Constructor
+ * @param[in] base original mesh
+ * @param[in] compare modified mesh compared against the original
+ * @param[in] tolerance horizontal distance, in mesh units, within which two
+ * nodes are considered to be at the same position
+ */
+MeshDiff::MeshDiff(Mesh *base, Mesh *compare, double tolerance)
+    : m_base(base), m_compare(compare), m_tolerance(tolerance) {}
+
+/**
+ * @brief Returns the horizontal matching tolerance
+ * @return tolerance
+ */
+double MeshDiff::tolerance() const { return this->m_tolerance; }
+
+/**
+ * @brief Sets the horizontal matching tolerance
+ * @param[in] tolerance horizontal distance, in mesh units, within which two
+ * nodes are considered to be at the same position
+ */
+void MeshDiff::setTolerance(double tolerance) {
+  this->m_tolerance = tolerance;
+}
+
+/**
+ * @brief Computes the differences between the two meshes
+ */
+void MeshDiff::compute() {
+  if (this->m_base == nullptr || this->m_compare == nullptr) {
+    adcircmodules_throw_exception("MeshDiff: Mesh has not been specified");
+  }
+  if (!(this->m_tolerance > 0.0)) {
+    adcircmodules_throw_exception("MeshDiff: Tolerance must be positive");
+  }
+  this->diffNodes();
+  this->diffElements();
+  this->diffBoundaries();
+
+  Adcirc::Logging::log(
+      boost::str(boost::format("MeshDiff: Nodes %i added, %i removed, %i "
+                               "modified. Elements %i added, %i removed, %i "
+                               "modified. Boundaries %i added, %i removed, "
+                               "%i modified") %
+                 this->m_addedNodes.size() % this->m_removedNodes.size() %
+                 this->m_modifiedNodes.size() % this->m_addedElements.size() %
+                 this->m_removedElements.size() %
+                 this->m_modifiedElements.size() %
+                 this->m_addedBoundaries.size() %
+                 this->m_removedBoundaries.size() %
+                 this->m_modifiedBoundaries.size()));
+}
+
+/**
+ * @brief Returns true if no differences were found
+ * @return true if the meshes are identical
+ */
+bool MeshDiff::identical() const {
+  return this->m_addedNodes.empty() && this->m_removedNodes.empty() &&
+         this->m_modifiedNodes.empty() && this->m_addedElements.empty() &&
+         this->m_removedElements.empty() && this->m_modifiedElements.empty() &&
+         this->m_addedBoundaries.empty() && this->m_removedBoundaries.empty() &&
+         this->m_modifiedBoundaries.empty();
+}
+
+/**
+ * @brief Matches nodes by position. A base node is matched to the compare
+ * node in the same quantization cell or, failing that, to the nearest node in
+ * a neighboring cell that lies within the tolerance. Matched nodes with a
+ * different elevation are modified
+ */
+void MeshDiff::diffNodes() {
+  const size_t nb = this->m_base->numNodes();
+  const size_t nc = this->m_compare->numNodes();
+  const double tol = this->m_tolerance;
+
+  std::vector<CellKey> keys(nc);
+#pragma omp parallel for schedule(static) default(none) shared(keys, nc, tol)
+  for (signed long long i = 0; i < static_cast<signed long long>(nc); ++i) {
+    const Node *n = this->m_compare->node(i);
+    keys[i] = quantize(n->x(), n->y(), tol);
+  }
+
+  PartitionedTable<CellKey, CellKeyHash> table;
+  table.build(keys, std::vector<char>(nc, 1));
+
+  this->m_nodeMap.assign(nb, NOT_FOUND);
+#pragma omp parallel for schedule(static) default(none) shared(table, nb, tol)
+  for (signed long long i = 0; i < static_cast<signed long long>(nb); ++i) {
+    const Node *n = this->m_base->node(i);
+    const CellKey k = quantize(n->x(), n->y(), tol);
+    size_t best = table.find(k);
+    if (best != NOT_FOUND && !withinTolerance(n, this->m_compare->node(best),
+                                              tol)) {
+      best = NOT_FOUND;
+    }
+
+    //...Nodes that moved by less than the tolerance may have been rounded
+    //   into a neighboring cell
+    double bestDistance = std::numeric_limits<double>::max();
+    const bool search = best == NOT_FOUND;
+    for (int64_t dx = -1; search && dx <= 1; ++dx) {
+      for (int64_t dy = -1; dy <= 1; ++dy) {
+        const size_t c = table.find(CellKey{k.x + dx, k.y + dy});
+        if (c == NOT_FOUND) continue;
+        const Node *m = this->m_compare->node(c);
+        if (!withinTolerance(n, m, tol)) continue;
+        const double d = (m->x() - n->x()) * (m->x() - n->x()) +
+                         (m->y() - n->y()) * (m->y() - n->y());
+        if (d < bestDistance) {
+          best = c;
+          bestDistance = d;
+        }
+      }
+    }
+    this->m_nodeMap[i] = best;
+  }
+
+  std::vector<char> matched(nc, 0);
+  this->m_removedNodes.clear();
+  this->m_modifiedNodes.clear();
+  for (size_t i = 0; i < nb; ++i) {
+    const size_t c = this->m_nodeMap[i];
+    if (c == NOT_FOUND) {
+      this->m_removedNodes.push_back(i);
+    } else {
+      matched[c] = 1;
+      if (!Adcirc::FpCompare::equalTo(this->m_base->node(i)->z(),
+                                      this->m_compare->node(c)->z())) {
+        this->m_modifiedNodes.push_back(i);
+      }
+    }
+  }
+
+  this->m_addedNodes.clear();
+  for (size_t i = 0; i < nc; ++i) {
+    if (!matched[i]) this->m_addedNodes.push_back(i);
+  }
+}
+
+/**
+ * @brief Matches elements by the sorted tuple of their vertices after the
+ * base vertices have been mapped to the compare mesh. Matched elements whose
+ * vertex ordering differs are modified
+ */
+void MeshDiff::diffElements() {
+  const size_t nb = this->m_base->numElements();
+  const size_t nc = this->m_compare->numElements();
+
+  const std::vector<size_t> baseVertex =
+      this->m_base->elementVertexIndices();
+  const std::vector<size_t> compareVertex =
+      this->m_compare->elementVertexIndices();
+
+  std::vector<ElementKey> keys(nc);
+#pragma omp parallel for schedule(static) default(none) \
+    shared(keys, compareVertex, nc)
+  for (signed long long i = 0; i < static_cast<signed long long>(nc); ++i) {
+    keys[i] =
+        sortedKey(&compareVertex[4 * i], this->m_compare->element(i)->n());
+  }
+
+  //...Compare elements are bucketed by their lowest vertex. Each bucket
+  //   only holds the few elements around a single node
+  const size_t nn = this->m_compare->numNodes();
+  std::vector<size_t> offset(nn + 1, 0);
+  for (size_t i = 0; i < nc; ++i) {
+    if (keys[i].v[0] < nn) offset[keys[i].v[0] + 1]++;
+  }
+  for (size_t i = 0; i < nn; ++i) offset[i + 1] += offset[i];
+  std::vector<size_t> bucket(offset[nn]);
+  {
+    std::vector<size_t> position(offset.begin(), offset.end() - 1);
+    for (size_t i = 0; i < nc; ++i) {
+      if (keys[i].v[0] < nn) bucket[position[keys[i].v[0]]++] = i;
+    }
+  }
+
+  this->m_elementMap.assign(nb, NOT_FOUND);
+  std::vector<char> modified(nb, 0);
+#pragma omp parallel for schedule(static) default(none) \
+    shared(keys, offset, bucket, baseVertex, compareVertex, modified, nb)
+  for (signed long long i = 0; i < static_cast<signed long long>(nb); ++i) {
+    const size_t n = this->m_base->element(i)->n();
+    std::array<size_t, 4> mapped;
+    bool complete = true;
+    for (size_t j = 0; j < n; ++j) {
+      const size_t v = baseVertex[4 * i + j];
+      mapped[j] = v == NOT_FOUND ? NOT_FOUND : this->m_nodeMap[v];
+      if (mapped[j] == NOT_FOUND) complete = false;
+    }
+    if (!complete) continue;
+
+    const ElementKey key = sortedKey(mapped.data(), n);
+    for (size_t k = offset[key.v[0]]; k < offset[key.v[0] + 1]; ++k) {
+      const size_t c = bucket[k];
+      if (keys[c] == key) {
+        this->m_elementMap[i] = c;
+        modified[i] = !sameOrdering(mapped.data(), &compareVertex[4 * c], n);
+        break;
+      }
+    }
+  }
+
+  std::vector<char> matched(nc, 0);
+  this->m_removedElements.clear();
+  this->m_modifiedElements.clear();
+  for (size_t i = 0; i < nb; ++i) {
+    const size_t c = this->m_elementMap[i];
+    if (c == NOT_FOUND) {
+      this->m_removedElements.push_back(i);
+    } else {
+      matched[c] = 1;
+      if (modified[i]) this->m_modifiedElements.push_back(i);
+    }
+  }
+
+  this->m_addedElements.clear();
+  for (size_t i = 0; i < nc; ++i) {
+    if (!matched[i]) this->m_addedElements.push_back(i);
+  }
+}
+
+/**
+ * @brief Matches boundaries by type and node sequence. Matched weirs with
+ * different attributes are modified. Boundary positions refer to the open
+ * boundaries followed by the land boundaries
+ */
+void MeshDiff::diffBoundaries() {
+  const size_t nb =
+      this->m_base->numOpenBoundaries() + this->m_base->numLandBoundaries();
+  const size_t nc = this->m_compare->numOpenBoundaries() +
+                    this->m_compare->numLandBoundaries();
+
+  std::unordered_map<std::string, size_t> table;
+  table.reserve(nc);
+  std::vector<size_t> node1, node2;
+  for (size_t i = 0; i < nc; ++i) {
+    const Boundary *b = boundaryAt(this->m_compare, i);
+    boundaryNodeIndices(this->m_compare, b, node1, node2);
+    bool valid;
+    table.emplace(boundaryKey(b, nullptr, node1, node2, valid), i);
+  }
+
+  this->m_boundaryMap.assign(nb, NOT_FOUND);
+  this->m_removedBoundaries.clear();
+  this->m_modifiedBoundaries.clear();
+  std::vector<char> matched(nc, 0);
+  for (size_t i = 0; i < nb; ++i) {
+    const Boundary *b = boundaryAt(this->m_base, i);
+    boundaryNodeIndices(this->m_base, b, node1, node2);
+    bool valid;
+    const std::string key =
+        boundaryKey(b, &this->m_nodeMap, node1, node2, valid);
+    auto it = valid ? table.find(key) : table.end();
+    if (it == table.end()) {
+      this->m_removedBoundaries.push_back(i);
+      continue;
+    }
+    this->m_boundaryMap[i] = it->second;
+    matched[it->second] = 1;
+    if (!sameAttributes(b, boundaryAt(this->m_compare, it->second))) {
+      this->m_modifiedBoundaries.push_back(i);
+    }
+  }
+
+  this->m_addedBoundaries.clear();
+  for (size_t i = 0; i < nc; ++i) {
+    if (!matched[i]) this->m_addedBoundaries.push_back(i);
+  }
+}
+
+/**
+ * @brief Returns the index of the matching compare node for each base node
+ * @return node map. Removed nodes are set to MeshDiff::NOT_FOUND
+ */
+const std::vector<size_t> &MeshDiff::nodeMap() const {
+  return this->m_nodeMap;
+}
+
+/**
+ * @brief Returns the index of the matching compare element for each base
+ * element
+ * @return element map. Removed elements are set to MeshDiff::NOT_FOUND
+ */
+const std::vector<size_t> &MeshDiff::elementMap() const {
+  return this->m_elementMap;
+}
+
+/**
+ * @brief Returns the position of the matching compare boundary for each base
+ * boundary
+ * @return boundary map. Removed boundaries are set to MeshDiff::NOT_FOUND
+ */
+const std::vector<size_t> &MeshDiff::boundaryMap() const {
+  return this->m_boundaryMap;
+}
+
+/**
+ * @brief Returns the indices of compare nodes with no match in the base mesh
+ * @return added node indices
+ */
+const std::vector<size_t> &MeshDiff::addedNodes() const {
+  return this->m_addedNodes;
+}
+
+/**
+ * @brief Returns the indices of base nodes with no match in the compare mesh
+ * @return removed node indices
+ */
+const std::vector<size_t> &MeshDiff::removedNodes() const {
+  return this->m_removedNodes;
+}
+
+/**
+ * @brief Returns the indices of matched base nodes whose elevation changed.
+ * Nodes that moved are reported as removed and added instead
+ * @return modified node indices
+ */
+const std::vector<size_t> &MeshDiff::modifiedNodes() const {
+  return this->m_modifiedNodes;
+}
+
+/**
+ * @brief Returns the indices of compare elements with no match in the base
+ * mesh
+ * @return added element indices
+ */
+const std::vector<size_t> &MeshDiff::addedElements() const {
+  return this->m_addedElements;
+}
+
+/**
+ * @brief Returns the indices of base elements with no match in the compare
+ * mesh
+ * @return removed element indices
+ */
+const std::vector<size_t> &MeshDiff::removedElements() const {
+  return this->m_removedElements;
+}
+
+/**
+ * @brief Returns the indices of matched base elements whose vertex ordering
+ * changed
+ * @return modified element indices
+ */
+const std::vector<size_t> &MeshDiff::modifiedElements() const {
+  return this->m_modifiedElements;
+}
+
+/**
+ * @brief Returns the positions of compare boundaries with no match in the
+ * base mesh
+ * @return added boundary positions
+ */
+const std::vector<size_t> &MeshDiff::addedBoundaries() const {
+  return this->m_addedBoundaries;
+}
+
+/**
+ * @brief Returns the positions of base boundaries with no match in the
+ * compare mesh
+ * @return removed boundary positions
+ */
+const std::vector<size_t> &MeshDiff::removedBoundaries() const {
+  return this->m_removedBoundaries;
+}
+
+/**
+ * @brief Returns the positions of matched base boundaries whose weir
+ * attributes changed
+ * @return modified boundary positions
+ */
+const std::vector<size_t> &MeshDiff::modifiedBoundaries() const {
+  return this->m_modifiedBoundaries;
+}
@@ -0,0 +1,109 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_MESHDIFF_H
+#define ADCMOD_MESHDIFF_H
+
+#include <vector>
+
+#include "adcircmodules_global.h"
+#include "default_values.h"
+#include "mesh.h"
+
+namespace Adcirc {
+
+namespace Utility {
+
+/**
+ * @class MeshDiff
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Determines the differences between two versions of a mesh
+ *
+ * Nodes are matched by their horizontal position quantized to the specified
+ * tolerance using a parallel hash join. Elements are matched by the sorted
+ * tuple of their matched vertices and boundaries by their type and matched
+ * node sequence. Node and element numbering do not need to agree between the
+ * two meshes.
+ *
+ * Because nodes are matched by position, a node that moved by more than the
+ * tolerance is always reported as a removed node plus an added node, never as
+ * a modified node. Modified nodes are matched nodes whose elevation changed.
+ */
+class MeshDiff {
+ public:
+  ADCIRCMODULES_EXPORT MeshDiff(Adcirc::Geometry::Mesh *base,
+                                Adcirc::Geometry::Mesh *compare,
+                                double tolerance = 1e-6);
+
+  void ADCIRCMODULES_EXPORT compute();
+
+  bool ADCIRCMODULES_EXPORT identical() const;
+
+  double ADCIRCMODULES_EXPORT tolerance() const;
+  void ADCIRCMODULES_EXPORT setTolerance(double tolerance);
+
+  static constexpr size_t ADCIRCMODULES_EXPORT NOT_FOUND =
+      adcircmodules_default_value<size_t>();
+
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &nodeMap() const;
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &elementMap() const;
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &boundaryMap() const;
+
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &addedNodes() const;
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &removedNodes() const;
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &modifiedNodes() const;
+
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &addedElements() const;
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &removedElements() const;
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &modifiedElements() const;
+
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &addedBoundaries() const;
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &removedBoundaries() const;
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &modifiedBoundaries() const;
+
+ private:
+  void diffNodes();
+  void diffElements();
+  void diffBoundaries();
+
+  Adcirc::Geometry::Mesh *m_base;
+  Adcirc::Geometry::Mesh *m_compare;
+  double m_tolerance;
+
+  std::vector<size_t> m_nodeMap;
+  std::vector<size_t> m_elementMap;
+  std::vector<size_t> m_boundaryMap;
+
+  std::vector<size_t> m_addedNodes;
+  std::vector<size_t> m_removedNodes;
+  std::vector<size_t> m_modifiedNodes;
+
+  std::vector<size_t> m_addedElements;
+  std::vector<size_t> m_removedElements;
+  std::vector<size_t> m_modifiedElements;
+
+  std::vector<size_t> m_addedBoundaries;
+  std::vector<size_t> m_removedBoundaries;
+  std::vector<size_t> m_modifiedBoundaries;
+};
+}  // namespace Utility
+}  // namespace Adcirc
+
+#endif  // ADCMOD_MESHDIFF_H
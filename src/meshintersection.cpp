@@ -0,0 +1,534 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "meshintersection.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "boost/format.hpp"
+#include "logging.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Adcirc::Geometry;
+using namespace Adcirc::Utility;
+
+namespace {
+
+//...Upper limit on the number of cells along each side of a grid level so
+//   that cell numbers fit in 64 bits
+constexpr double c_maxCellsPerSide = 2147483648.0;
+
+//...Levels with more cells than this per element entry only store their
+//   occupied cells
+constexpr double c_maxCellsPerEntry = 4.0;
+
+//...Percentile of the element sizes used as the cell size of the finest grid
+//   level
+constexpr double c_cellSizePercentile = 0.01;
+
+//...Maximum number of grid levels. Each level doubles the cell size
+constexpr size_t c_maxGridLevels = 64;
+
+//...Tolerance, relative to the size of the elements being compared, below
+//   which elements are considered to be touching rather than overlapping
+constexpr double c_touchTolerance = 1e-9;
+
+struct Box {
+  double xmin;
+  double ymin;
+  double xmax;
+  double ymax;
+};
+
+using Triangle = std::array<Point, 3>;
+
+/**
+ * @brief Vertex positions of an element copied out of the mesh so that the
+ * pair tests do not need to dereference the nodes
+ */
+struct Shape {
+  std::array<Point, 4> p;
+  size_t n;
+};
+
+Shape elementShape(const Element *e) {
+  Shape s;
+  s.n = std::min<size_t>(e->n(), 4);
+  for (size_t i = 0; i < s.n; ++i) {
+    s.p[i] = {e->node(i)->x(), e->node(i)->y()};
+  }
+  return s;
+}
+
+Box shapeBox(const Shape &s) {
+  Box b{s.p[0].first, s.p[0].second, s.p[0].first, s.p[0].second};
+  for (size_t i = 1; i < s.n; ++i) {
+    b.xmin = std::min(b.xmin, s.p[i].first);
+    b.ymin = std::min(b.ymin, s.p[i].second);
+    b.xmax = std::max(b.xmax, s.p[i].first);
+    b.ymax = std::max(b.ymax, s.p[i].second);
+  }
+  return b;
+}
+
+double boxExtent(const Box &b) {
+  return std::max(b.xmax - b.xmin, b.ymax - b.ymin);
+}
+
+//...Boxes that only touch cannot contain overlapping elements
+bool boxesOverlap(const Box &a, const Box &b) {
+  return a.xmin < b.xmax && b.xmin < a.xmax && a.ymin < b.ymax &&
+         b.ymin < a.ymax;
+}
+
+double orient(const Point &a, const Point &b, const Point &c) {
+  return (b.first - a.first) * (c.second - a.second) -
+         (b.second - a.second) * (c.first - a.first);
+}
+
+/**
+ * @brief Splits an element into triangles. Quadrilaterals are split along
+ * the diagonal that lies inside the element so that non-convex elements are
+ * represented correctly
+ */
+size_t triangulate(const Shape &s, std::array<Triangle, 2> &t) {
+  const Point &p0 = s.p[0];
+  const Point &p1 = s.p[1];
+  const Point &p2 = s.p[2];
+  if (s.n == 3) {
+    t[0] = {p0, p1, p2};
+    return 1;
+  }
+  const Point &p3 = s.p[3];
+  if ((orient(p0, p1, p2) > 0.0) == (orient(p0, p2, p3) > 0.0)) {
+    t[0] = {p0, p1, p2};
+    t[1] = {p0, p2, p3};
+  } else {
+    t[0] = {p1, p2, p3};
+    t[1] = {p1, p3, p0};
+  }
+  return 2;
+}
+
+/**
+ * @brief Tests the edges of triangle a as separating axes against triangle b
+ * @return true if an axis separates the triangles or they only touch
+ */
+bool hasSeparatingAxis(const Triangle &a, const Triangle &b,
+                       double tolerance) {
+  for (size_t i = 0; i < 3; ++i) {
+    const Point &p = a[i];
+    const Point &q = a[(i + 1) % 3];
+    const double nx = p.second - q.second;
+    const double ny = q.first - p.first;
+    const double length = std::sqrt(nx * nx + ny * ny);
+    if (length == 0.0) continue;
+
+    double amin = std::numeric_limits<double>::max();
+    double amax = std::numeric_limits<double>::lowest();
+    double bmin = amin;
+    double bmax = amax;
+    for (size_t j = 0; j < 3; ++j) {
+      const double pa = nx * a[j].first + ny * a[j].second;
+      const double pb = nx * b[j].first + ny * b[j].second;
+      amin = std::min(amin, pa);
+      amax = std::max(amax, pa);
+      bmin = std::min(bmin, pb);
+      bmax = std::max(bmax, pb);
+    }
+    const double tol = tolerance * length;
+    if (amax <= bmin + tol || bmax <= amin + tol) return true;
+  }
+  return false;
+}
+
+bool trianglesOverlap(const Triangle &a, const Triangle &b, double tolerance) {
+  return !hasSeparatingAxis(a, b, tolerance) &&
+         !hasSeparatingAxis(b, a, tolerance);
+}
+
+bool segmentsCross(const Point &a, const Point &b, const Point &c,
+                   const Point &d, double tolerance) {
+  const double d1 = orient(c, d, a);
+  const double d2 = orient(c, d, b);
+  const double d3 = orient(a, b, c);
+  const double d4 = orient(a, b, d);
+  return ((d1 > tolerance && d2 < -tolerance) ||
+          (d1 < -tolerance && d2 > tolerance)) &&
+         ((d3 > tolerance && d4 < -tolerance) ||
+          (d3 < -tolerance && d4 > tolerance));
+}
+
+bool shapesOverlap(const Shape &a, const Box &ba, const Shape &b,
+                   const Box &bb) {
+  if (!boxesOverlap(ba, bb)) return false;
+  const double tolerance =
+      c_touchTolerance * std::max(boxExtent(ba), boxExtent(bb));
+  std::array<Triangle, 2> ta, tb;
+  const size_t na = triangulate(a, ta);
+  const size_t nb = triangulate(b, tb);
+  for (size_t i = 0; i < na; ++i) {
+    for (size_t j = 0; j < nb; ++j) {
+      if (trianglesOverlap(ta[i], tb[j], tolerance)) return true;
+    }
+  }
+  return false;
+}
+
+bool shapeSelfIntersects(const Shape &s, const Box &b) {
+  const double extent = boxExtent(b);
+  if (extent == 0.0) return true;
+  const double tolerance = c_touchTolerance * extent * extent;
+  const Point &p0 = s.p[0];
+  const Point &p1 = s.p[1];
+  const Point &p2 = s.p[2];
+  if (s.n == 3) return std::abs(orient(p0, p1, p2)) <= tolerance;
+
+  const Point &p3 = s.p[3];
+  if (segmentsCross(p0, p1, p2, p3, tolerance) ||
+      segmentsCross(p1, p2, p3, p0, tolerance)) {
+    return true;
+  }
+  return std::abs(orient(p0, p1, p2) + orient(p0, p2, p3)) <= tolerance;
+}
+
+/**
+ * @brief Maps a coordinate to a grid cell, clamping to the grid extents
+ */
+size_t cellIndex(double value, double origin, double cellSize, size_t n) {
+  const double c = std::floor((value - origin) / cellSize);
+  if (c < 0.0) return 0;
+  return std::min(static_cast<size_t>(c), n - 1);
+}
+
+/**
+ * @brief One level of the hierarchical grid, holding a compressed list of the
+ * elements in each cell. Levels with many more cells than entries only store
+ * the occupied cells, as a sorted list of cell numbers
+ */
+struct Grid {
+  double cellSize;
+  size_t nx;
+  size_t ny;
+  bool sparse;
+  std::vector<uint64_t> cells;
+  std::vector<size_t> offset;
+  std::vector<size_t> elements;
+};
+
+struct CellRange {
+  size_t x0;
+  size_t x1;
+  size_t y0;
+  size_t y1;
+};
+
+uint64_t cellNumber(const Grid &g, size_t x, size_t y) {
+  return static_cast<uint64_t>(y) * g.nx + x;
+}
+
+/**
+ * @brief Finds the position of a cell in the compressed element list of a
+ * grid level
+ * @return false if the cell holds no elements
+ */
+bool cellSlot(const Grid &g, uint64_t c, size_t &slot) {
+  if (!g.sparse) {
+    slot = static_cast<size_t>(c);
+    return g.offset[slot] != g.offset[slot + 1];
+  }
+  const auto it = std::lower_bound(g.cells.begin(), g.cells.end(), c);
+  if (it == g.cells.end() || *it != c) return false;
+  slot = static_cast<size_t>(it - g.cells.begin());
+  return true;
+}
+
+/**
+ * @brief Returns the range of cells of a grid level covered by a box
+ */
+CellRange cellRange(const Box &b, const Box &extent, const Grid &g) {
+  return {cellIndex(b.xmin, extent.xmin, g.cellSize, g.nx),
+          cellIndex(b.xmax, extent.xmin, g.cellSize, g.nx),
+          cellIndex(b.ymin, extent.ymin, g.cellSize, g.ny),
+          cellIndex(b.ymax, extent.ymin, g.cellSize, g.ny)};
+}
+
+}  // namespace
+
+/**
+ * @brief Constructor
+ * @param[in] mesh mesh to search for overlapping elements
+ */
+MeshIntersection::MeshIntersection(Mesh *mesh) : m_mesh(mesh) {}
+
+/**
+ * @brief Returns the pairs of element indices that overlap one another. The
+ * first index of each pair is the smaller and the pairs are sorted
+ * @return vector of overlapping element index pairs
+ */
+const std::vector<std::pair<size_t, size_t>>
+    &MeshIntersection::overlappingElements() const {
+  return this->m_overlappingElements;
+}
+
+/**
+ * @brief Returns the indices of elements that are degenerate or whose edges
+ * cross one another
+ * @return vector of self intersecting element indices
+ */
+const std::vector<size_t> &MeshIntersection::selfIntersectingElements() const {
+  return this->m_selfIntersectingElements;
+}
+
+/**
+ * @brief Determines if the interiors of two elements overlap. Elements that
+ * only share an edge or vertex do not overlap
+ * @param[in] a first element
+ * @param[in] b second element
+ * @return true if the elements overlap
+ */
+bool MeshIntersection::elementsOverlap(const Element *a, const Element *b) {
+  const Shape sa = elementShape(a);
+  const Shape sb = elementShape(b);
+  return shapesOverlap(sa, shapeBox(sa), sb, shapeBox(sb));
+}
+
+/**
+ * @brief Determines if an element has no area or if its edges cross
+ * @param[in] e element to check
+ * @return true if the element is self intersecting
+ */
+bool MeshIntersection::isSelfIntersecting(const Element *e) {
+  const Shape s = elementShape(e);
+  return shapeSelfIntersects(s, shapeBox(s));
+}
+
+/**
+ * @brief Searches the mesh for overlapping and self intersecting elements
+ */
+void MeshIntersection::compute() {
+  if (this->m_mesh == nullptr) {
+    adcircmodules_throw_exception("MeshIntersection: Mesh has not been set");
+  }
+  this->m_overlappingElements.clear();
+  this->m_selfIntersectingElements.clear();
+
+  Mesh *mesh = this->m_mesh;
+  const size_t ne = mesh->numElements();
+  if (ne == 0) return;
+
+  std::vector<Shape> shape(ne);
+  std::vector<Box> box(ne);
+  std::vector<char> selfIntersecting(ne, 0);
+
+#pragma omp parallel for schedule(static) default(none) \
+    shared(mesh, shape, box, selfIntersecting, ne)
+  for (signed long long i = 0; i < static_cast<signed long long>(ne); ++i) {
+    shape[i] = elementShape(mesh->element(i));
+    box[i] = shapeBox(shape[i]);
+    selfIntersecting[i] = shapeSelfIntersects(shape[i], box[i]) ? 1 : 0;
+  }
+
+  Box extent = box[0];
+  std::vector<double> size(ne);
+  for (size_t i = 0; i < ne; ++i) {
+    const Box &b = box[i];
+    extent.xmin = std::min(extent.xmin, b.xmin);
+    extent.ymin = std::min(extent.ymin, b.ymin);
+    extent.xmax = std::max(extent.xmax, b.xmax);
+    extent.ymax = std::max(extent.ymax, b.ymax);
+    size[i] = boxExtent(b);
+  }
+  const double width = extent.xmax - extent.xmin;
+  const double height = extent.ymax - extent.ymin;
+
+  //...The finest level is sized from a lower percentile of the element size
+  //   so that the small elements, which are the majority in a graded mesh,
+  //   share cells with only a handful of neighbors
+  std::vector<double> sorted(size);
+  const size_t percentile = static_cast<size_t>(
+      c_cellSizePercentile * static_cast<double>(ne - 1));
+  std::nth_element(sorted.begin(), sorted.begin() + percentile, sorted.end());
+  double cellSize = sorted[percentile];
+  std::vector<double>().swap(sorted);
+  if (!(cellSize > 0.0)) cellSize = std::max(std::max(width, height), 1.0);
+  cellSize = std::max(cellSize, std::max(width, height) / c_maxCellsPerSide);
+
+  //...Each element is placed on the finest level whose cells are at least as
+  //   large as the element, so that it spans at most 2x2 cells on its own
+  //   level and on every coarser level
+  std::vector<unsigned char> level(ne, 0);
+  size_t numLevels = 1;
+  for (size_t i = 0; i < ne; ++i) {
+    unsigned char l = 0;
+    double levelSize = cellSize;
+    while (size[i] > levelSize && l < c_maxGridLevels - 1) {
+      levelSize *= 2.0;
+      ++l;
+    }
+    level[i] = l;
+    numLevels = std::max<size_t>(numLevels, l + 1);
+  }
+  std::vector<double>().swap(size);
+
+  std::vector<Grid> grids(numLevels);
+  for (size_t l = 0; l < numLevels; ++l) {
+    Grid &g = grids[l];
+    g.cellSize = std::ldexp(cellSize, static_cast<int>(l));
+    g.nx = static_cast<size_t>(std::floor(width / g.cellSize)) + 1;
+    g.ny = static_cast<size_t>(std::floor(height / g.cellSize)) + 1;
+  }
+
+  //...Bin the element bounding boxes into the grid of their level. Dense
+  //   levels are filled with a counting pass and sparse levels by sorting
+  //   the entries by cell
+  std::vector<size_t> numEntries(numLevels, 0);
+  for (size_t i = 0; i < ne; ++i) {
+    const CellRange r = cellRange(box[i], extent, grids[level[i]]);
+    numEntries[level[i]] += (r.x1 - r.x0 + 1) * (r.y1 - r.y0 + 1);
+  }
+  std::vector<std::vector<std::pair<uint64_t, size_t>>> entries(numLevels);
+  for (size_t l = 0; l < numLevels; ++l) {
+    Grid &g = grids[l];
+    const double cells =
+        static_cast<double>(g.nx) * static_cast<double>(g.ny);
+    g.sparse =
+        cells > c_maxCellsPerEntry * static_cast<double>(numEntries[l]);
+    if (g.sparse) {
+      entries[l].reserve(numEntries[l]);
+    } else {
+      g.offset.assign(g.nx * g.ny + 1, 0);
+    }
+    g.elements.resize(numEntries[l]);
+  }
+  for (size_t i = 0; i < ne; ++i) {
+    Grid &g = grids[level[i]];
+    const CellRange r = cellRange(box[i], extent, g);
+    for (size_t y = r.y0; y <= r.y1; ++y) {
+      for (size_t x = r.x0; x <= r.x1; ++x) {
+        if (g.sparse) {
+          entries[level[i]].emplace_back(cellNumber(g, x, y), i);
+        } else {
+          g.offset[cellNumber(g, x, y) + 1]++;
+        }
+      }
+    }
+  }
+  for (size_t l = 0; l < numLevels; ++l) {
+    Grid &g = grids[l];
+    if (g.sparse) {
+      auto &e = entries[l];
+      std::sort(e.begin(), e.end());
+      for (size_t k = 0; k < e.size(); ++k) {
+        if (k == 0 || e[k].first != e[k - 1].first) {
+          g.cells.push_back(e[k].first);
+          g.offset.push_back(k);
+        }
+        g.elements[k] = e[k].second;
+      }
+      g.offset.push_back(e.size());
+      std::vector<std::pair<uint64_t, size_t>>().swap(e);
+    } else {
+      for (size_t c = 0; c < g.nx * g.ny; ++c) g.offset[c + 1] += g.offset[c];
+    }
+  }
+  {
+    std::vector<std::vector<size_t>> position(numLevels);
+    for (size_t l = 0; l < numLevels; ++l) {
+      if (!grids[l].sparse) {
+        position[l].assign(grids[l].offset.begin(),
+                           grids[l].offset.end() - 1);
+      }
+    }
+    for (size_t i = 0; i < ne; ++i) {
+      Grid &g = grids[level[i]];
+      if (g.sparse) continue;
+      const CellRange r = cellRange(box[i], extent, g);
+      for (size_t y = r.y0; y <= r.y1; ++y) {
+        for (size_t x = r.x0; x <= r.x1; ++x) {
+          g.elements[position[level[i]][cellNumber(g, x, y)]++] = i;
+        }
+      }
+    }
+  }
+
+  //...Each element is tested against the elements of its own level and of
+  //   all coarser levels. Pairs on the same level are only tested from the
+  //   lower index. Within a level, a pair is only tested in the cell
+  //   containing the lower left corner of the overlap of their bounding boxes
+  //   so that each pair is considered once
+  std::vector<std::pair<size_t, size_t>> overlapping;
+#pragma omp parallel default(none) \
+    shared(shape, box, level, grids, overlapping, extent, numLevels, ne)
+  {
+    std::vector<std::pair<size_t, size_t>> local;
+#pragma omp for schedule(dynamic, 256)
+    for (signed long long i = 0; i < static_cast<signed long long>(ne); ++i) {
+      const size_t a = static_cast<size_t>(i);
+      for (size_t l = level[a]; l < numLevels; ++l) {
+        const Grid &g = grids[l];
+        if (g.elements.empty()) continue;
+        const CellRange r = cellRange(box[a], extent, g);
+        for (size_t y = r.y0; y <= r.y1; ++y) {
+          for (size_t x = r.x0; x <= r.x1; ++x) {
+            const uint64_t c = cellNumber(g, x, y);
+            size_t k;
+            if (!cellSlot(g, c, k)) continue;
+            for (size_t p = g.offset[k]; p < g.offset[k + 1]; ++p) {
+              const size_t b = g.elements[p];
+              if (l == level[a] && b <= a) continue;
+              if (!boxesOverlap(box[a], box[b])) continue;
+              const size_t cx =
+                  cellIndex(std::max(box[a].xmin, box[b].xmin), extent.xmin,
+                            g.cellSize, g.nx);
+              const size_t cy =
+                  cellIndex(std::max(box[a].ymin, box[b].ymin), extent.ymin,
+                            g.cellSize, g.ny);
+              if (cellNumber(g, cx, cy) != c) continue;
+              if (shapesOverlap(shape[a], box[a], shape[b], box[b])) {
+                local.emplace_back(std::min(a, b), std::max(a, b));
+              }
+            }
+          }
+        }
+      }
+    }
+#pragma omp critical(meshintersection_merge)
+    overlapping.insert(overlapping.end(), local.begin(), local.end());
+  }
+
+  std::sort(overlapping.begin(), overlapping.end());
+  this->m_overlappingElements = std::move(overlapping);
+  for (size_t i = 0; i < ne; ++i) {
+    if (selfIntersecting[i]) this->m_selfIntersectingElements.push_back(i);
+  }
+
+  Adcirc::Logging::log(boost::str(
+      boost::format("MeshIntersection: %i overlapping element pairs and %i "
+                    "self intersecting elements found using %i grid levels "
+                    "with a finest cell size of %f") %
+      this->m_overlappingElements.size() %
+      this->m_selfIntersectingElements.size() % numLevels % cellSize));
+}
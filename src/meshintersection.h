@@ -0,0 +1,77 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_MESHINTERSECTION_H
+#define ADCMOD_MESHINTERSECTION_H
+
+#include <utility>
+#include <vector>
+
+#include "adcircmodules_global.h"
+#include "mesh.h"
+
+namespace Adcirc {
+
+namespace Utility {
+
+/**
+ * @class MeshIntersection
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Finds elements that geometrically overlap other elements or
+ * themselves
+ *
+ * Element bounding boxes are binned into a hierarchy of uniform grids. The
+ * finest level is sized from a lower percentile of the element size and each
+ * coarser level doubles the cell size. Every element is stored on the finest
+ * level whose cells are at least as large as the element, so meshes whose
+ * element sizes vary by orders of magnitude do not crowd small elements into
+ * a few cells or spread large elements over many cells. Candidate pairs are
+ * found in parallel from the elements sharing a grid cell and then tested
+ * exactly by splitting each element into triangles and searching for a
+ * separating axis. Elements that only touch along a shared edge or vertex do
+ * not overlap.
+ */
+class MeshIntersection {
+ public:
+  ADCIRCMODULES_EXPORT MeshIntersection(Adcirc::Geometry::Mesh *mesh);
+
+  void ADCIRCMODULES_EXPORT compute();
+
+  const std::vector<std::pair<size_t, size_t>> ADCIRCMODULES_EXPORT &
+  overlappingElements() const;
+
+  const std::vector<size_t> ADCIRCMODULES_EXPORT &selfIntersectingElements()
+      const;
+
+  static bool ADCIRCMODULES_EXPORT elementsOverlap(
+      const Adcirc::Geometry::Element *a, const Adcirc::Geometry::Element *b);
+
+  static bool ADCIRCMODULES_EXPORT
+  isSelfIntersecting(const Adcirc::Geometry::Element *e);
+
+ private:
+  Adcirc::Geometry::Mesh *m_mesh;
+  std::vector<std::pair<size_t, size_t>> m_overlappingElements;
+  std::vector<size_t> m_selfIntersectingElements;
+};
+}  // namespace Utility
+}  // namespace Adcirc
+
+#endif  // ADCMOD_MESHINTERSECTION_H
@@ -18,12 +18,16 @@
 //------------------------------------------------------------------------*/
 #include "netcdftimeseries.h"
 
+#include <cctype>
+#include <chrono>
+#include <cmath>
 #include <cstring>
 #include <memory>
 
 #include "boost/format.hpp"
 #include "cdate.h"
 #include "fileio.h"
+#include "logging.h"
 #include "netcdf.h"
 
 using namespace Adcirc::Output;
@@ -57,14 +61,11 @@ void NetcdfTimeseries::setEpsg(int epsg) { this->m_epsg = epsg; }
 int NetcdfTimeseries::read(bool stationsOnly = false) {
   if (this->m_filename == std::string()) return 1;
 
-  std::string station_dim_string, station_time_var_string,
-      station_data_var_string;
-  size_t stationNameLength, length;
+  size_t stationNameLength;
   int ncid;
-  int dimid_nstations, dimidStationLength, dimid_stationNameLen;
-  int varid_time, varid_data, varid_xcoor, varid_ycoor, varid_stationName;
+  int dimid_nstations, dimid_stationNameLen;
+  int varid_xcoor, varid_ycoor, varid_stationName, varid_rowSize, varid_data;
   int epsg;
-  char timeChar[80];
 
   NCCHECK(nc_open(this->m_filename.c_str(), NC_NOWRITE, &ncid))
   NCCHECK(nc_inq_dimid(ncid, "numStations", &dimid_nstations))
@@ -92,9 +93,11 @@ int NetcdfTimeseries::read(bool stationsOnly = false) {
   std::string stationName(stationNameLength * this->m_numStations, ' ');
   NCCHECK(nc_get_var_text(ncid, varid_stationName, &stationName[0]))
 
+  const std::string trim("\t\n\v\f\r \0", 7);
   for (size_t i = 0; i < this->m_numStations; i++) {
-    std::string s = stationName.substr(200 * i, 200);
-    s.erase(s.find_last_not_of("\t\n\v\f\r ") + 1);
+    std::string s =
+        stationName.substr(stationNameLength * i, stationNameLength);
+    s.erase(s.find_last_not_of(trim) + 1);
     this->m_stationName.push_back(s);
   }
 
@@ -103,6 +106,28 @@ int NetcdfTimeseries::read(bool stationsOnly = false) {
     this->m_data.resize(this->m_numStations);
   }
 
+  //...Files written with a single data variable follow the CF timeSeries
+  //   layouts and carry a row_size variable when stored as a ragged array
+  int ierr;
+  if (nc_inq_varid(ncid, "row_size", &varid_rowSize) == NC_NOERR) {
+    ierr = this->readRaggedArray(ncid, varid_rowSize, stationsOnly);
+  } else if (nc_inq_varid(ncid, "data", &varid_data) == NC_NOERR) {
+    ierr = this->readOrthogonalArray(ncid, varid_data, stationsOnly);
+  } else {
+    ierr = this->readStationVariables(ncid, stationsOnly);
+  }
+  if (ierr != NC_NOERR) return ierr;
+
+  NCCHECK(nc_close(ncid))
+
+  this->m_hasData = !stationsOnly;
+  return 0;
+}
+
+int NetcdfTimeseries::readStationVariables(int ncid, bool stationsOnly) {
+  int dimidStationLength, varid_time, varid_data;
+  size_t length;
+
   for (size_t i = 0; i < this->m_numStations; i++) {
     std::string station_dim_string =
         boost::str(boost::format("stationLength_%04.4i") % (i + 1));
@@ -117,11 +142,12 @@ int NetcdfTimeseries::read(bool stationsOnly = false) {
 
     NCCHECK(nc_inq_varid(ncid, station_time_var_string.c_str(), &varid_time))
     NCCHECK(nc_inq_varid(ncid, station_data_var_string.c_str(), &varid_data))
-    NCCHECK(nc_get_att_text(ncid, varid_time, "referenceDate", timeChar))
-    std::string timeString = std::string(timeChar).substr(0, 19);
 
     CDate reftime;
-    reftime.fromString(timeString);
+    double secondsPerUnit;
+    int ierr = NetcdfTimeseries::readReferenceDate(ncid, varid_time, reftime,
+                                                   secondsPerUnit);
+    if (ierr != NC_NOERR) return ierr;
 
     double fillValue;
     NCCHECK(nc_inq_var_fill(ncid, varid_data, NULL, &fillValue))
@@ -129,28 +155,190 @@ int NetcdfTimeseries::read(bool stationsOnly = false) {
     this->m_fillValue.push_back(fillValue);
 
     if (!stationsOnly) {
-      std::vector<long long> timeData(length);
-      std::vector<double> varData(length);
+      std::vector<double> timeData(length);
+      this->m_data[i].resize(length);
 
-      NCCHECK(nc_get_var_double(ncid, varid_data, varData.data()))
-      NCCHECK(nc_get_var_longlong(ncid, varid_time, timeData.data()))
+      NCCHECK(nc_get_var_double(ncid, varid_data, this->m_data[i].data()))
+      NCCHECK(nc_get_var_double(ncid, varid_time, timeData.data()))
 
-      this->m_data[i].resize(length);
-      this->m_time[i].resize(length);
-
-      for (size_t j = 0; j < length; j++) {
-        this->m_data[i][j] = varData[j];
-        CDate t = reftime;
-        t += static_cast<long>(timeData[j]);
-        this->m_time[i][j] = t;
-      }
+      NetcdfTimeseries::toDates(reftime, timeData.data(), length,
+                                secondsPerUnit, this->m_time[i]);
     }
   }
+  return NC_NOERR;
+}
 
-  NCCHECK(nc_close(ncid))
+int NetcdfTimeseries::readRaggedArray(int ncid, int varid_rowSize,
+                                      bool stationsOnly) {
+  int varid_time, varid_data;
+  NCCHECK(nc_inq_varid(ncid, "time", &varid_time))
+  NCCHECK(nc_inq_varid(ncid, "data", &varid_data))
 
-  this->m_hasData = !stationsOnly;
-  return 0;
+  std::vector<long long> rowSize(this->m_numStations);
+  if (this->m_numStations > 0) {
+    NCCHECK(nc_get_var_longlong(ncid, varid_rowSize, rowSize.data()))
+  }
+
+  double fillValue;
+  NCCHECK(nc_inq_var_fill(ncid, varid_data, NULL, &fillValue))
+  if (fillValue == NC_FILL_DOUBLE) fillValue = -99999.0;
+
+  size_t nsample = 0;
+  for (size_t i = 0; i < this->m_numStations; ++i) {
+    this->m_stationLength.push_back(static_cast<size_t>(rowSize[i]));
+    this->m_fillValue.push_back(fillValue);
+    nsample += static_cast<size_t>(rowSize[i]);
+  }
+
+  if (stationsOnly || nsample == 0) return NC_NOERR;
+
+  CDate reftime;
+  double secondsPerUnit;
+  int ierr = NetcdfTimeseries::readReferenceDate(ncid, varid_time, reftime,
+                                                 secondsPerUnit);
+  if (ierr != NC_NOERR) return ierr;
+
+  std::vector<double> timeData(nsample);
+  std::vector<double> varData(nsample);
+  NCCHECK(nc_get_var_double(ncid, varid_time, timeData.data()))
+  NCCHECK(nc_get_var_double(ncid, varid_data, varData.data()))
+
+  size_t offset = 0;
+  for (size_t i = 0; i < this->m_numStations; ++i) {
+    const size_t length = this->m_stationLength[i];
+    this->m_data[i].assign(varData.begin() + offset,
+                           varData.begin() + offset + length);
+    NetcdfTimeseries::toDates(reftime, timeData.data() + offset, length,
+                              secondsPerUnit, this->m_time[i]);
+    offset += length;
+  }
+  return NC_NOERR;
+}
+
+int NetcdfTimeseries::readOrthogonalArray(int ncid, int varid_data,
+                                          bool stationsOnly) {
+  int varid_time, dimid_time;
+  size_t ntime;
+  NCCHECK(nc_inq_varid(ncid, "time", &varid_time))
+  NCCHECK(nc_inq_vardimid(ncid, varid_time, &dimid_time))
+  NCCHECK(nc_inq_dimlen(ncid, dimid_time, &ntime))
+
+  double fillValue;
+  NCCHECK(nc_inq_var_fill(ncid, varid_data, NULL, &fillValue))
+  if (fillValue == NC_FILL_DOUBLE) fillValue = -99999.0;
+
+  for (size_t i = 0; i < this->m_numStations; ++i) {
+    this->m_stationLength.push_back(ntime);
+    this->m_fillValue.push_back(fillValue);
+  }
+
+  if (stationsOnly || ntime == 0 || this->m_numStations == 0) {
+    return NC_NOERR;
+  }
+
+  CDate reftime;
+  double secondsPerUnit;
+  int ierr = NetcdfTimeseries::readReferenceDate(ncid, varid_time, reftime,
+                                                 secondsPerUnit);
+  if (ierr != NC_NOERR) return ierr;
+
+  std::vector<double> timeData(ntime);
+  NCCHECK(nc_get_var_double(ncid, varid_time, timeData.data()))
+
+  //...Each station is one chunk of the data variable
+  for (size_t i = 0; i < this->m_numStations; ++i) {
+    size_t start[2] = {i, 0};
+    size_t count[2] = {1, ntime};
+    this->m_data[i].resize(ntime);
+    NCCHECK(nc_get_vara_double(ncid, varid_data, start, count,
+                               this->m_data[i].data()))
+    NetcdfTimeseries::toDates(reftime, timeData.data(), ntime,
+                              secondsPerUnit, this->m_time[i]);
+  }
+  return NC_NOERR;
+}
+
+/**
+ * @brief Reads the reference date and units of a time variable. The
+ * referenceDate attribute is used for the date when it exists, otherwise the
+ * date is taken from a CF units attribute of the form
+ * "<units> since yyyy-mm-dd hh:mm:ss"
+ * @param[in] ncid netCDF file id
+ * @param[in] varid time variable
+ * @param[out] reftime reference date
+ * @param[out] secondsPerUnit length of one unit of the time variable in
+ * seconds
+ * @return netCDF error code
+ */
+int NetcdfTimeseries::readReferenceDate(int ncid, int varid, CDate &reftime,
+                                        double &secondsPerUnit) {
+  size_t length;
+  std::string units;
+  if (nc_inq_attlen(ncid, varid, "units", &length) == NC_NOERR) {
+    units.resize(length);
+    NCCHECK(nc_get_att_text(ncid, varid, "units", &units[0]))
+  }
+
+  secondsPerUnit = 1.0;
+  const size_t pos = units.find("since ");
+  if (pos != std::string::npos) {
+    secondsPerUnit = NetcdfTimeseries::unitSeconds(units.substr(0, pos));
+    if (secondsPerUnit <= 0.0) {
+      nc_close(ncid);
+      adcircmodules_throw_exception(
+          "NetcdfTimeseries: Unsupported time units: " + units);
+    }
+  }
+
+  std::string timeString;
+  if (nc_inq_attlen(ncid, varid, "referenceDate", &length) == NC_NOERR) {
+    timeString.resize(length);
+    NCCHECK(nc_get_att_text(ncid, varid, "referenceDate", &timeString[0]))
+  } else {
+    NCCHECK(nc_inq_attlen(ncid, varid, "units", &length))
+    timeString =
+        pos == std::string::npos ? std::string() : units.substr(pos + 6);
+  }
+  reftime.fromString(timeString.substr(0, 19));
+  return NC_NOERR;
+}
+
+/**
+ * @brief Converts the units of a CF time variable to seconds
+ * @param[in] units unit name preceding "since" in the units attribute
+ * @return number of seconds in one unit, or zero if the unit is not supported
+ */
+double NetcdfTimeseries::unitSeconds(const std::string &units) {
+  std::string u;
+  for (auto c : units) {
+    if (!std::isspace(static_cast<unsigned char>(c))) {
+      u += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+  }
+  if (u == "seconds" || u == "second" || u == "secs" || u == "sec" ||
+      u == "s") {
+    return 1.0;
+  } else if (u == "minutes" || u == "minute" || u == "mins" || u == "min") {
+    return 60.0;
+  } else if (u == "hours" || u == "hour" || u == "hrs" || u == "hr" ||
+             u == "h") {
+    return 3600.0;
+  } else if (u == "days" || u == "day" || u == "d") {
+    return 86400.0;
+  }
+  return 0.0;
+}
+
+void NetcdfTimeseries::toDates(const CDate &reftime, const double *time,
+                               size_t n, double secondsPerUnit,
+                               std::vector<CDate> &dates) {
+  const auto t0 = reftime.time_point();
+  dates.clear();
+  dates.reserve(n);
+  for (size_t j = 0; j < n; ++j) {
+    dates.emplace_back(
+        t0 + std::chrono::seconds(std::llround(time[j] * secondsPerUnit)));
+  }
 }
 
 int NetcdfTimeseries::toHmdf(Hmdf *hmdf) {
@@ -160,11 +348,12 @@ int NetcdfTimeseries::toHmdf(Hmdf *hmdf) {
   hmdf->setHeader3("none");
   hmdf->setSuccess(false);
 
+  //...The series are moved into the stations rather than copied
   for (size_t i = 0; i < this->m_numStations; i++) {
     HmdfStation station;
     if (this->m_hasData) {
-      station.setDate(this->m_time[i]);
-      station.setData(this->m_data[i]);
+      station.m_date = std::move(this->m_time[i]);
+      station.m_data_u = std::move(this->m_data[i]);
     }
     station.setLatitude(this->m_ycoor[i]);
     station.setLongitude(this->m_xcoor[i]);
@@ -172,8 +361,9 @@ int NetcdfTimeseries::toHmdf(Hmdf *hmdf) {
     station.setId(this->m_stationName[i]);
     station.setStationIndex(i);
     station.setNullValue(this->m_fillValue[i]);
-    hmdf->addStation(station);
+    hmdf->addStation(std::move(station));
   }
+  this->m_hasData = false;
 
   hmdf->setSuccess(true);
 
@@ -47,6 +47,15 @@ class NetcdfTimeseries {
   static int getEpsg(const std::string &file);
 
  private:
+  int readStationVariables(int ncid, bool stationsOnly);
+  int readRaggedArray(int ncid, int varid_rowSize, bool stationsOnly);
+  int readOrthogonalArray(int ncid, int varid_data, bool stationsOnly);
+  static int readReferenceDate(int ncid, int varid, CDate &reftime,
+                               double &secondsPerUnit);
+  static double unitSeconds(const std::string &units);
+  static void toDates(const CDate &reftime, const double *time, size_t n,
+                      double secondsPerUnit, std::vector<CDate> &dates);
+
   std::string m_filename;
   std::string m_units;
   std::string m_verticalDatum;
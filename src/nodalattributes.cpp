@@ -79,6 +79,16 @@ void NodalAttributes::write(const std::string &outputFilename) {
   this->m_impl->write(outputFilename);
 }
 
+/**
+ * @brief Writes the mesh nodes and the value of every nodal attribute to a
+ * FlatGeobuf file. Attributes with more than one value per node are written
+ * as one column per value. The mesh must be set
+ * @param[in] outputFilename name of output file with .fgb extension
+ */
+void NodalAttributes::toFlatGeobuf(const std::string &outputFilename) {
+  this->m_impl->toFlatGeobuf(outputFilename);
+}
+
 /**
  * @brief Returns the name of the nodal attribute at the specified index
  * @param[in] index position for the requested attribute
@@ -146,23 +156,25 @@ void NodalAttributes::setNumNodes(size_t numNodes) {
 }
 
 /**
- * @brief Returns a pointer to the nodal attribute object for a specified node
+ * @brief Returns a view of the nodal attribute values for a specified node
  * @param[in] parameter index where the parameter is located
  * @param[in] node node to return the data for
- * @return NodalAttributes object
+ * @return Attribute view. Values set through the view are stored in this
+ * object
  */
-Adcirc::ModelParameters::Attribute *NodalAttributes::attribute(size_t parameter,
-                                                               size_t node) {
+Adcirc::ModelParameters::Attribute NodalAttributes::attribute(size_t parameter,
+                                                              size_t node) {
   return this->m_impl->attribute(parameter, node);
 }
 
 /**
- * @brief Returns a pointer to the nodal attribute object for a specified node
+ * @brief Returns a view of the nodal attribute values for a specified node
  * @param[in] name name of the nodal parameter to return data for
  * @param[in] node node to return the data for
- * @return Attribute object
+ * @return Attribute view. Values set through the view are stored in this
+ * object
  */
-Adcirc::ModelParameters::Attribute *NodalAttributes::attribute(
+Adcirc::ModelParameters::Attribute NodalAttributes::attribute(
     const std::string &name, size_t node) {
   return this->m_impl->attribute(name, node);
 }
@@ -197,5 +209,25 @@ void NodalAttributes::addAttribute(AttributeMetadata &metadata,
   this->m_impl->addAttribute(metadata, data);
 }
 
+/**
+ * @brief Adds a new nodal attribute from an array of values
+ * @param[in] metadata object metadata
+ * @param[in] values values ordered by node, with metadata.numberOfValues()
+ * values for each of the numNodes() nodes
+ */
+void NodalAttributes::addAttribute(AttributeMetadata &metadata,
+                                   const std::vector<double> &values) {
+  this->m_impl->addAttribute(metadata, values);
+}
+
+/**
+ * @brief Reorders the nodal attributes to follow a renumbered mesh
+ * @param[in] permutation original node index for each new node position, as
+ * returned by Mesh::reorder
+ */
+void NodalAttributes::permute(const std::vector<size_t> &permutation) {
+  this->m_impl->permute(permutation);
+}
+
 }  // namespace ModelParameters
 }  // namespace Adcirc
@@ -44,6 +44,7 @@ class NodalAttributes {
   Adcirc::Geometry::Mesh ADCIRCMODULES_EXPORT *mesh();
 
   void ADCIRCMODULES_EXPORT write(const std::string &outputFilename);
+  void ADCIRCMODULES_EXPORT toFlatGeobuf(const std::string &outputFilename);
 
   std::string ADCIRCMODULES_EXPORT attributeNames(size_t index);
 
@@ -58,10 +59,10 @@ class NodalAttributes {
   size_t ADCIRCMODULES_EXPORT numNodes() const;
   void ADCIRCMODULES_EXPORT setNumNodes(size_t numNodes);
 
-  Adcirc::ModelParameters::Attribute ADCIRCMODULES_EXPORT *attribute(
-      size_t parameter, size_t node);
-  Adcirc::ModelParameters::Attribute ADCIRCMODULES_EXPORT *attribute(
-      const std::string &name, size_t node);
+  Adcirc::ModelParameters::Attribute ADCIRCMODULES_EXPORT
+  attribute(size_t parameter, size_t node);
+  Adcirc::ModelParameters::Attribute ADCIRCMODULES_EXPORT
+  attribute(const std::string &name, size_t node);
 
   Adcirc::ModelParameters::AttributeMetadata ADCIRCMODULES_EXPORT *metadata(
       size_t parameter);
@@ -71,6 +72,11 @@ class NodalAttributes {
   void ADCIRCMODULES_EXPORT
   addAttribute(Adcirc::ModelParameters::AttributeMetadata &metadata,
                std::vector<Adcirc::ModelParameters::Attribute> &data);
+  void ADCIRCMODULES_EXPORT
+  addAttribute(Adcirc::ModelParameters::AttributeMetadata &metadata,
+               const std::vector<double> &values);
+
+  void ADCIRCMODULES_EXPORT permute(const std::vector<size_t> &permutation);
 
  private:
   std::unique_ptr<Adcirc::Private::NodalAttributesPrivate> m_impl;
@@ -19,6 +19,8 @@
 #include "nodalattributes_private.h"
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 #include <utility>
@@ -26,13 +28,81 @@
 #include "boost/format.hpp"
 #include "default_values.h"
 #include "fileio.h"
+#include "flatgeobufwriter.h"
+#include "fpcompare.h"
 #include "logging.h"
+#include "mappedfile.h"
 #include "nodalattributes.h"
 #include "stringconversion.h"
+#include "textio.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace Adcirc::ModelParameters;
 using namespace Adcirc::Private;
 
+namespace {
+/// Number of nodes represented by each word of the non-default bitmap
+constexpr size_t c_bitmapWordSize = 64;
+
+/// Number of lines in the body of a fort.13 file parsed as one task
+constexpr size_t c_readChunkSize = 65536;
+
+/// Number of nodes formatted as one task when writing a fort.13 file
+constexpr size_t c_writeChunkSize = 65536;
+
+/**
+ * @brief Appends a value using a printf style format. The decimal separator is
+ * always a period regardless of the C locale
+ */
+void appendFormatted(std::string &s, const char *format, double value) {
+  char buffer[64];
+  int n = snprintf(buffer, sizeof(buffer), format, value);
+  if (n < 0) return;
+  if (static_cast<size_t>(n) >= sizeof(buffer)) n = sizeof(buffer) - 1;
+  TextIO::fixDecimalPoint(buffer, buffer + n);
+  s.append(buffer, static_cast<size_t>(n));
+}
+
+/**
+ * @brief Appends a value formatted as "%12.6f"
+ *
+ * The value is scaled to an integer number of millionths. When the scaled
+ * value is far enough from a rounding tie that the error in the scaling
+ * cannot change the result, the digits are generated directly. Otherwise the
+ * C library is used so that the output is always identical to printf
+ */
+void appendFixed6(std::string &s, double value) {
+  const double magnitude = std::abs(value * 1e6);
+  if (std::isfinite(magnitude) && magnitude < 1e15) {
+    const double rounded = std::floor(magnitude + 0.5);
+    const double margin = magnitude * 4.5e-16 + 1e-9;
+    if (0.5 - std::abs(magnitude - rounded) > margin) {
+      unsigned long long n = static_cast<unsigned long long>(rounded);
+      char buffer[32];
+      char *p = buffer + sizeof(buffer);
+      for (int i = 0; i < 6; ++i) {
+        *--p = static_cast<char>('0' + n % 10);
+        n /= 10;
+      }
+      *--p = '.';
+      do {
+        *--p = static_cast<char>('0' + n % 10);
+        n /= 10;
+      } while (n != 0);
+      if (std::signbit(value)) *--p = '-';
+      const size_t length = static_cast<size_t>(buffer + sizeof(buffer) - p);
+      if (length < 12) s.append(12 - length, ' ');
+      s.append(p, length);
+      return;
+    }
+  }
+  appendFormatted(s, "%12.6f", value);
+}
+}  // namespace
+
 NodalAttributes::~NodalAttributes() = default;
 
 NodalAttributesPrivate::NodalAttributesPrivate()
@@ -79,12 +149,15 @@ void NodalAttributesPrivate::read() {
   this->_readFort13Header(fid);
   this->_readFort13Defaults(fid);
   this->_fillDefaultValues();
-  this->_readFort13Body(fid);
 
+  std::streamoff offset = fid.tellg();
   fid.close();
 
-  if (this->m_mesh != nullptr) {
-    this->_mapNodes();
+  if (this->numParameters() > 0) {
+    if (offset < 0) {
+      adcircmodules_throw_exception("NodalAttributes: Error reading file data");
+    }
+    this->_readFort13Body(static_cast<size_t>(offset));
   }
 
   return;
@@ -119,22 +192,15 @@ void NodalAttributesPrivate::_readFort13Header(std::fstream &fid) {
       adcircmodules_throw_exception(
           "NodalAttributes: Number of nodes does not match provided mesh.");
     }
-  } else {
-    this->setNumNodes(numnodes);
   }
+  this->setNumNodes(numnodes);
 
   this->m_nodalParameters.resize(this->numParameters());
-  this->m_nodalData.resize(this->numParameters());
+  this->m_nodalData.clear();
   for (size_t i = 0; i < this->numParameters(); ++i) {
-    this->m_nodalData[i].resize(this->numNodes());
-    for (size_t j = 0; j < this->numNodes(); ++j) {
-      if (this->m_mesh != nullptr) {
-        this->m_nodalData[i][j].setId(this->mesh()->node(j)->id());
-      } else {
-        this->m_nodalData[i][j].setId(j + 1);
-      }
-    }
+    this->m_nodalData.push_back(std::make_shared<AttributeData>());
   }
+  this->_setNodeIds();
 
   return;
 }
@@ -194,97 +260,160 @@ void NodalAttributesPrivate::_readFort13Defaults(std::fstream &fid) {
   return;
 }
 
-void NodalAttributesPrivate::_fillDefaultValues() {
-  for (size_t i = 0; i < this->numParameters(); ++i) {
-    if (this->m_nodalParameters[i].numberOfValues() == 1) {
-      for (size_t j = 0; j < this->numNodes(); ++j) {
-        this->m_nodalData[i][j].resize(1);
-        this->m_nodalData[i][j].setValue(
-            this->m_nodalParameters[i].defaultValue());
-      }
+void NodalAttributesPrivate::_setNodeIds() {
+  this->m_nodeIds.resize(this->numNodes());
+  for (size_t j = 0; j < this->numNodes(); ++j) {
+    if (this->m_mesh != nullptr) {
+      this->m_nodeIds[j] = this->m_mesh->node(j)->id();
     } else {
-      for (size_t j = 0; j < this->numNodes(); ++j) {
-        this->m_nodalData[i][j].resize(
-            this->m_nodalParameters[i].numberOfValues());
-        this->m_nodalData[i][j].setValue(
-            this->m_nodalParameters[i].getDefaultValues());
-      }
+      this->m_nodeIds[j] = j + 1;
     }
   }
+  return;
 }
 
-void NodalAttributesPrivate::_mapNodes() {
+void NodalAttributesPrivate::_fillDefaultValues() {
+  const size_t nWords =
+      (this->numNodes() + c_bitmapWordSize - 1) / c_bitmapWordSize;
   for (size_t i = 0; i < this->numParameters(); ++i) {
+    AttributeData &d = *this->m_nodalData[i];
+    d.numValues = this->m_nodalParameters[i].numberOfValues();
+    d.fillValue = this->m_nodalParameters[i].getDefaultValues();
+    d.values.resize(this->numNodes() * d.numValues);
     for (size_t j = 0; j < this->numNodes(); ++j) {
-      this->m_nodalData[i][j].setNode(
-          this->mesh()->nodeById(this->m_nodalData[i][j].id()));
+      std::copy(d.fillValue.begin(), d.fillValue.end(),
+                d.values.begin() + j * d.numValues);
     }
+    d.nonDefault.assign(nWords, 0);
   }
-  return;
 }
 
-void NodalAttributesPrivate::_readFort13Body(std::fstream &fid) {
-  std::string tempLine, name;
-  size_t node;
-  double value;
+/**
+ * The section boundaries are located with a serial scan of the mapped file,
+ * splitting each section into chunks of lines that are then parsed
+ * concurrently
+ */
+void NodalAttributesPrivate::_readFort13Body(size_t offset) {
+  Adcirc::Private::MappedFile file;
+  if (!file.open(this->filename()) || offset > file.size()) {
+    adcircmodules_throw_exception("NodalAttributes: Error reading file data");
+  }
+
+  const char *p = file.data() + offset;
+  const char *end = file.end();
+  std::vector<Fort13Chunk> chunks;
   bool ok;
 
   for (size_t i = 0; i < this->numParameters(); ++i) {
-    std::getline(fid, name);
-    name = StringConversion::sanitizeString(name);
+    if (p >= end) {
+      adcircmodules_throw_exception("NodalAttributes: Error reading file data");
+    }
+    auto line = TextIO::nextLine(p, end);
+    std::string name =
+        StringConversion::sanitizeString(std::string(line.first, line.second));
+    if (this->m_attributeLocations.find(name) ==
+        this->m_attributeLocations.end()) {
+      adcircmodules_throw_exception("NodalAttributes: Error reading file data");
+    }
     size_t index = this->m_attributeLocations[name];
 
-    std::getline(fid, tempLine);
-    size_t numNonDefault = StringConversion::stringToSizet(tempLine, ok);
-    assert(ok);
+    line = TextIO::nextLine(p, end);
+    size_t numNonDefault = StringConversion::stringToSizet(
+        std::string(line.first, line.second), ok);
     if (!ok) {
       adcircmodules_throw_exception("NodalAttributes: Error reading file data");
     }
 
-    size_t nValues = this->m_nodalParameters[index].numberOfValues();
-
+    Fort13Chunk chunk = {index, 0, p, p};
     for (size_t j = 0; j < numNonDefault; ++j) {
-      std::getline(fid, tempLine);
+      if (p >= end) {
+        adcircmodules_throw_exception(
+            "NodalAttributes: Error reading file data");
+      }
+      TextIO::nextLine(p, end);
+      if (++chunk.numLines == c_readChunkSize) {
+        chunk.end = p;
+        chunks.push_back(chunk);
+        chunk = {index, 0, p, p};
+      }
+    }
+    if (chunk.numLines > 0) {
+      chunk.end = p;
+      chunks.push_back(chunk);
+    }
+  }
 
-      if (nValues == 1) {
-        if (!FileIO::AdcircIO::splitStringAttribute1Format(tempLine, node,
-                                                           value)) {
-          adcircmodules_throw_exception(
-              "NodalAttributes: Error reading file data");
-        }
+  //...Node ids are only looked up through a table when they are not
+  //   numbered sequentially
+  std::unordered_map<size_t, size_t> lookup;
+  for (size_t j = 0; j < this->m_nodeIds.size(); ++j) {
+    if (this->m_nodeIds[j] != j + 1) {
+      lookup.reserve(this->m_nodeIds.size());
+      for (size_t k = 0; k < this->m_nodeIds.size(); ++k) {
+        lookup[this->m_nodeIds[k]] = k;
+      }
+      break;
+    }
+  }
 
-        Attribute *a;
-        if (this->m_mesh != nullptr) {
-          a = &this->m_nodalData[i][this->mesh()->nodeIndexById(node)];
-        } else {
-          a = &this->m_nodalData[i][node - 1];
-        }
-        a->setValue(value);
-        a->setId(node);
-
-      } else {
-        std::vector<double> values;
-        values.reserve(nValues);
-        if (!FileIO::AdcircIO::splitStringAttributeNFormat(tempLine, node,
-                                                           values)) {
-          adcircmodules_throw_exception(
-              "NodalAttributes: Error reading file data");
-        };
+  bool failed = false;
+  signed long long nChunks = static_cast<signed long long>(chunks.size());
 
-        Attribute *a;
-        if (this->m_mesh != nullptr) {
-          a = &this->m_nodalData[i][this->mesh()->nodeIndexById(node)];
-        } else {
-          a = &this->m_nodalData[i][node - 1];
-        }
-        a->setValue(values);
-        a->setId(node);
-      }
+#pragma omp parallel for schedule(dynamic, 1) default(none) \
+    shared(chunks, lookup, failed, nChunks)
+  for (signed long long c = 0; c < nChunks; ++c) {
+    if (!this->_readFort13Chunk(chunks[c], lookup)) {
+#pragma omp atomic write
+      failed = true;
     }
   }
+
+  if (failed) {
+    adcircmodules_throw_exception("NodalAttributes: Error reading file data");
+  }
   return;
 }
 
+/**
+ * @brief Parses the lines of one chunk of a fort.13 body section. Chunks may
+ * share words of the non-default bitmap, so bits are set atomically
+ * @return false if a line could not be parsed or refers to an unknown node
+ */
+bool NodalAttributesPrivate::_readFort13Chunk(
+    const Fort13Chunk &chunk,
+    const std::unordered_map<size_t, size_t> &lookup) {
+  AttributeData &d = *this->m_nodalData[chunk.parameter];
+  std::vector<double> values(d.numValues);
+  const char *p = chunk.begin;
+
+  for (size_t j = 0; j < chunk.numLines; ++j) {
+    auto line = TextIO::nextLine(p, chunk.end);
+    size_t node;
+    if (!FileIO::AdcircIO::splitStringAttributeNFormat(
+            line.first, line.second, node, values.data(), d.numValues)) {
+      return false;
+    }
+
+    size_t k;
+    if (lookup.empty()) {
+      if (node == 0) return false;
+      k = node - 1;
+    } else {
+      auto it = lookup.find(node);
+      if (it == lookup.end()) return false;
+      k = it->second;
+    }
+    if (k >= this->numNodes()) return false;
+
+    std::copy(values.begin(), values.end(), d.values.begin() + k * d.numValues);
+    uint64_t &word = d.nonDefault[k / c_bitmapWordSize];
+    const uint64_t mask = uint64_t(1) << (k % c_bitmapWordSize);
+#pragma omp atomic
+    word |= mask;
+  }
+  return true;
+}
+
 size_t NodalAttributesPrivate::numNodes() const { return this->m_numNodes; }
 
 void NodalAttributesPrivate::setNumNodes(size_t numNodes) {
@@ -305,20 +434,30 @@ void NodalAttributesPrivate::setHeader(const std::string &header) {
   this->m_header = header;
 }
 
-Attribute *NodalAttributesPrivate::attribute(size_t parameter, size_t node) {
+Attribute NodalAttributesPrivate::attribute(size_t parameter, size_t node) {
   assert(node < this->numNodes());
   assert(parameter < this->numParameters());
 
-  if (node < this->numNodes() && parameter < this->numParameters()) {
-    return &this->m_nodalData[parameter][node];
+  if (node < this->numNodes() && parameter < this->m_nodalData.size() &&
+      node < this->m_nodeIds.size()) {
+    AttributeData &d = *this->m_nodalData[parameter];
+    if (d.values.size() == this->numNodes() * d.numValues) {
+      Adcirc::Geometry::Node *n =
+          this->m_mesh != nullptr ? this->m_mesh->node(node) : nullptr;
+      return Attribute(this->m_nodalData[parameter],
+                       d.values.data() + node * d.numValues, d.numValues,
+                       this->m_nodeIds[node], n,
+                       &d.nonDefault[node / c_bitmapWordSize],
+                       uint64_t(1) << (node % c_bitmapWordSize));
+    }
   }
   adcircmodules_throw_exception(
       "NodalAttributes: Attribute could not be located");
-  return nullptr;
+  return Attribute();
 }
 
-Attribute *NodalAttributesPrivate::attribute(const std::string &name,
-                                             size_t node) {
+Attribute NodalAttributesPrivate::attribute(const std::string &name,
+                                            size_t node) {
   size_t index = this->locateAttribute(name);
   return this->attribute(index, node);
 }
@@ -341,6 +480,58 @@ void NodalAttributesPrivate::write(const std::string &outputFilename) {
   return;
 }
 
+/**
+ * @brief Writes the nodal attributes as points at the mesh nodes into
+ * FlatGeobuf format. Each attribute value gets its own column, suffixed with
+ * its index for attributes with more than one value per node
+ * @param outputFilename output file with .fgb extension
+ */
+void NodalAttributesPrivate::toFlatGeobuf(const std::string &outputFilename) {
+  if (this->m_mesh == nullptr) {
+    adcircmodules_throw_exception(
+        "NodalAttributes: A mesh is required to write FlatGeobuf output");
+  }
+  if (this->m_mesh->numNodes() != this->numNodes()) {
+    adcircmodules_throw_exception(
+        "NodalAttributes: Mesh does not match the nodal attributes");
+  }
+
+  FlatGeobufWriter writer(outputFilename, FlatGeobufWriter::Point,
+                          this->m_mesh->projection());
+  const uint16_t nodeid = writer.addColumn("nodeid", FlatGeobufWriter::Integer);
+
+  //...First column of each parameter
+  std::vector<uint16_t> column;
+  for (size_t i = 0; i < this->m_nodalData.size(); ++i) {
+    const AttributeData &d = *this->m_nodalData[i];
+    const std::string name = this->m_nodalParameters[i].name();
+    if (d.values.size() != this->numNodes() * d.numValues) {
+      adcircmodules_throw_exception("NodalAttributes: Attribute " + name +
+                                    " has not been read");
+    }
+    for (size_t j = 0; j < d.numValues; ++j) {
+      const uint16_t c = writer.addColumn(
+          d.numValues == 1 ? name : name + "_" + std::to_string(j + 1),
+          FlatGeobufWriter::Double);
+      if (j == 0) column.push_back(c);
+    }
+  }
+
+  Adcirc::Geometry::Mesh *mesh = this->m_mesh;
+  writer.write(this->numNodes(), [&](size_t i, FlatGeobufFeature &f) {
+    const Adcirc::Geometry::Node *n = mesh->node(i);
+    f.addPoint(n->x(), n->y());
+    f.setInteger(nodeid, static_cast<int>(n->id()));
+    for (size_t p = 0; p < this->m_nodalData.size(); ++p) {
+      const AttributeData &d = *this->m_nodalData[p];
+      for (size_t j = 0; j < d.numValues; ++j) {
+        f.setDouble(static_cast<uint16_t>(column[p] + j),
+                    d.values[i * d.numValues + j]);
+      }
+    }
+  });
+}
+
 void NodalAttributesPrivate::_writeFort13Header(std::ofstream &fid) {
   fid << this->m_header << "\n";
   fid << boost::str(boost::format("%11i\n") % this->numNodes());
@@ -351,32 +542,100 @@ void NodalAttributesPrivate::_writeFort13Header(std::ofstream &fid) {
   return;
 }
 
+/**
+ * Non-default nodes of each parameter are formatted in parallel in chunks and
+ * written to disk in order after each batch of chunks is complete
+ */
 void NodalAttributesPrivate::_writeFort13Body(std::ofstream &fid) {
+  size_t batchSize = 1;
+#ifdef _OPENMP
+  batchSize = static_cast<size_t>(omp_get_max_threads()) * 2;
+#endif
+
+  std::vector<size_t> nodes;
+  std::vector<std::string> buffers(batchSize);
   for (size_t i = 0; i < this->numParameters(); ++i) {
-    size_t ndefault =
-        this->_countDefault(this->m_nodalParameters[i], this->m_nodalData[i]);
+    size_t ndefault = this->_countDefault(i, nodes);
     fid << this->m_nodalParameters[i].name() << "\n";
     fid << boost::str(boost::format("%11i\n") % ndefault);
 
-    for (size_t j = 0; j < this->numNodes(); ++j) {
-      if (!this->m_nodalParameters[i].checkIfDefaultValue(
-              this->m_nodalData[i][j])) {
-        fid << this->m_nodalData[i][j].write();
+    const size_t nChunks =
+        (nodes.size() + c_writeChunkSize - 1) / c_writeChunkSize;
+    for (size_t first = 0; first < nChunks; first += batchSize) {
+      signed long long nBatch = static_cast<signed long long>(
+          std::min(batchSize, nChunks - first));
+
+#pragma omp parallel for schedule(dynamic, 1) default(none) \
+    shared(nodes, buffers, first, nBatch, i)
+      for (signed long long c = 0; c < nBatch; ++c) {
+        size_t begin = (first + c) * c_writeChunkSize;
+        size_t end = std::min(nodes.size(), begin + c_writeChunkSize);
+        buffers[c].clear();
+        this->_writeFort13Chunk(i, nodes.data() + begin, nodes.data() + end,
+                                buffers[c]);
+      }
+
+      for (signed long long c = 0; c < nBatch; ++c) {
+        fid.write(buffers[c].data(),
+                  static_cast<std::streamsize>(buffers[c].size()));
       }
     }
   }
   return;
 }
 
-size_t NodalAttributesPrivate::_countDefault(AttributeMetadata &metadata,
-                                             std::vector<Attribute> &values) {
-  size_t n = 0;
-  for (auto &v : values) {
-    if (!metadata.checkIfDefaultValue(v)) {
-      n++;
+/**
+ * @brief Formats the lines for a range of non-default nodes of a parameter
+ */
+void NodalAttributesPrivate::_writeFort13Chunk(size_t parameter,
+                                               const size_t *first,
+                                               const size_t *last,
+                                               std::string &buffer) const {
+  const AttributeData &d = *this->m_nodalData[parameter];
+  buffer.reserve(static_cast<size_t>(last - first) * (13 + 14 * d.numValues));
+  for (const size_t *j = first; j != last; ++j) {
+    TextIO::appendInteger(
+        buffer, static_cast<long long>(this->m_nodeIds[*j]), 11);
+    buffer += "  ";
+    const double *v = d.values.data() + *j * d.numValues;
+    for (size_t k = 0; k < d.numValues; ++k) {
+      appendFixed6(buffer, v[k]);
+      buffer += "  ";
     }
+    buffer += '\n';
   }
-  return n;
+}
+
+/**
+ * Nodes whose bit is clear still hold the fill value they were initialized
+ * with, so only flagged nodes need to be compared unless the default value
+ * has been changed since the data was filled
+ */
+size_t NodalAttributesPrivate::_countDefault(size_t parameter,
+                                             std::vector<size_t> &nodes) {
+  nodes.clear();
+  const AttributeData &d = *this->m_nodalData[parameter];
+  const std::vector<double> def =
+      this->m_nodalParameters[parameter].getDefaultValues();
+  const bool checkAll = !FpCompare::equalTo(def, d.fillValue);
+  const bool sizeMatch = def.size() == d.numValues;
+
+  for (size_t w = 0; w < d.nonDefault.size(); ++w) {
+    const uint64_t word = checkAll ? ~uint64_t(0) : d.nonDefault[w];
+    if (word == 0) continue;
+    for (size_t b = 0; b < c_bitmapWordSize; ++b) {
+      if (!((word >> b) & 1)) continue;
+      const size_t j = w * c_bitmapWordSize + b;
+      if (j >= this->numNodes()) break;
+      const double *v = d.values.data() + j * d.numValues;
+      bool isDefault = sizeMatch;
+      for (size_t k = 0; k < d.numValues && isDefault; ++k) {
+        isDefault = FpCompare::equalTo(v[k], def[k]);
+      }
+      if (!isDefault) nodes.push_back(j);
+    }
+  }
+  return nodes.size();
 }
 
 AttributeMetadata *NodalAttributesPrivate::metadata(size_t parameter) {
@@ -397,9 +656,123 @@ AttributeMetadata *NodalAttributesPrivate::metadata(const std::string &name) {
 
 void NodalAttributesPrivate::addAttribute(AttributeMetadata &metadata,
                                           std::vector<Attribute> &attribute) {
+  const size_t nv = metadata.numberOfValues();
+  if (this->numNodes() == 0) this->setNumNodes(attribute.size());
+
+  std::vector<double> values(attribute.size() * nv);
+  for (size_t j = 0; j < attribute.size(); ++j) {
+    if (attribute[j].size() != nv) {
+      adcircmodules_throw_exception(
+          "NodalAttributes: Attribute size does not match metadata");
+    }
+    for (size_t k = 0; k < nv; ++k) {
+      values[j * nv + k] = attribute[j].value(k);
+    }
+  }
+
+  if (this->m_nodeIds.size() != attribute.size()) {
+    this->m_nodeIds.resize(attribute.size());
+    for (size_t j = 0; j < attribute.size(); ++j) {
+      this->m_nodeIds[j] =
+          attribute[j].id() == adcircmodules_default_value<size_t>()
+              ? j + 1
+              : attribute[j].id();
+    }
+  }
+
+  this->addAttribute(metadata, values);
+}
+
+void NodalAttributesPrivate::addAttribute(AttributeMetadata &metadata,
+                                          const std::vector<double> &values) {
+  const size_t nv = metadata.numberOfValues();
+  if (this->numNodes() == 0 && nv > 0) this->setNumNodes(values.size() / nv);
+  if (values.size() != this->numNodes() * nv) {
+    adcircmodules_throw_exception(
+        "NodalAttributes: Number of values does not match the number of "
+        "nodes");
+  }
+  if (this->m_nodeIds.size() != this->numNodes()) this->_setNodeIds();
+
+  AttributeData d;
+  d.numValues = nv;
+  d.values = values;
+  d.fillValue = metadata.getDefaultValues();
+  d.nonDefault.assign(
+      (this->numNodes() + c_bitmapWordSize - 1) / c_bitmapWordSize, 0);
+  for (size_t j = 0; j < this->numNodes(); ++j) {
+    for (size_t k = 0; k < nv; ++k) {
+      if (k >= d.fillValue.size() ||
+          !FpCompare::equalTo(values[j * nv + k], d.fillValue[k])) {
+        d.nonDefault[j / c_bitmapWordSize] |=
+            uint64_t(1) << (j % c_bitmapWordSize);
+        break;
+      }
+    }
+  }
+
   this->m_nodalParameters.push_back(metadata);
-  this->m_nodalData.push_back(attribute);
+  this->m_nodalData.push_back(std::make_shared<AttributeData>(std::move(d)));
   this->m_attributeLocations[metadata.name()] =
       this->m_nodalParameters.size() - 1;
   this->m_numParameters = this->m_nodalParameters.size();
 }
+
+/**
+ * Values and the non-default bitmap are gathered into the new node order.
+ * Node ids are reassigned from the mesh, or sequentially if there is no mesh,
+ * since Mesh::reorder renumbers the nodes
+ */
+void NodalAttributesPrivate::permute(const std::vector<size_t> &permutation) {
+  const size_t nn = this->numNodes();
+  if (permutation.size() != nn) {
+    adcircmodules_throw_exception(
+        "NodalAttributes: Permutation size does not match the number of "
+        "nodes");
+  }
+  std::vector<bool> seen(nn, false);
+  for (auto i : permutation) {
+    if (i >= nn) {
+      adcircmodules_throw_exception(
+          "NodalAttributes: Permutation index out of range");
+    }
+    if (seen[i]) {
+      adcircmodules_throw_exception(
+          "NodalAttributes: Duplicate index in permutation");
+    }
+    seen[i] = true;
+  }
+
+  for (auto &data : this->m_nodalData) {
+    AttributeData &d = *data;
+    std::vector<double> values(d.values.size());
+    std::vector<uint64_t> nonDefault(d.nonDefault.size(), 0);
+#pragma omp parallel for schedule(static) default(none) \
+    shared(d, values, nonDefault, permutation, nn)
+    for (signed long long w = 0;
+         w < static_cast<signed long long>(nonDefault.size()); ++w) {
+      const size_t first = static_cast<size_t>(w) * c_bitmapWordSize;
+      const size_t last = std::min(nn, first + c_bitmapWordSize);
+      uint64_t word = 0;
+      for (size_t j = first; j < last; ++j) {
+        const size_t k = permutation[j];
+        std::copy(d.values.begin() + k * d.numValues,
+                  d.values.begin() + (k + 1) * d.numValues,
+                  values.begin() + j * d.numValues);
+        if ((d.nonDefault[k / c_bitmapWordSize] >> (k % c_bitmapWordSize)) &
+            1) {
+          word |= uint64_t(1) << (j % c_bitmapWordSize);
+        }
+      }
+      nonDefault[w] = word;
+    }
+
+    //...Copied back in place so that existing views keep pointing at valid
+    //   storage
+    std::copy(values.begin(), values.end(), d.values.begin());
+    std::copy(nonDefault.begin(), nonDefault.end(), d.nonDefault.begin());
+  }
+
+  this->_setNodeIds();
+}
+
@@ -19,7 +19,10 @@
 #ifndef ADCMOD_NODALATTRIBUTESPRIVATE_H
 #define ADCMOD_NODALATTRIBUTESPRIVATE_H
 
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "adcmap.h"
 #include "attribute.h"
@@ -45,6 +48,7 @@ class NodalAttributesPrivate {
   Adcirc::Geometry::Mesh *mesh();
 
   void write(const std::string &outputFilename);
+  void toFlatGeobuf(const std::string &outputFilename);
 
   std::string attributeNames(size_t index);
 
@@ -59,26 +63,51 @@ class NodalAttributesPrivate {
   size_t numNodes() const;
   void setNumNodes(size_t numNodes);
 
-  Adcirc::ModelParameters::Attribute *attribute(size_t parameter, size_t node);
-  Adcirc::ModelParameters::Attribute *attribute(const std::string &name,
-                                                size_t node);
+  Adcirc::ModelParameters::Attribute attribute(size_t parameter, size_t node);
+  Adcirc::ModelParameters::Attribute attribute(const std::string &name,
+                                               size_t node);
 
   Adcirc::ModelParameters::AttributeMetadata *metadata(size_t parameter);
   Adcirc::ModelParameters::AttributeMetadata *metadata(const std::string &name);
 
   void addAttribute(Adcirc::ModelParameters::AttributeMetadata &metadata,
                     std::vector<Adcirc::ModelParameters::Attribute> &attribute);
+  void addAttribute(Adcirc::ModelParameters::AttributeMetadata &metadata,
+                    const std::vector<double> &values);
+
+  void permute(const std::vector<size_t> &permutation);
 
  private:
+  /// Values of a nodal attribute stored as a numNodes x numberOfValues array
+  /// along with a bitmap of the nodes that may differ from the default value
+  struct AttributeData {
+    size_t numValues = 0;
+    std::vector<double> values;
+    std::vector<uint64_t> nonDefault;
+    std::vector<double> fillValue;
+  };
+
+  /// Range of lines in the body of a fort.13 file that belong to a single
+  /// nodal parameter
+  struct Fort13Chunk {
+    size_t parameter;
+    size_t numLines;
+    const char *begin;
+    const char *end;
+  };
+
   void _readFort13Header(std::fstream &fid);
   void _readFort13Defaults(std::fstream &fid);
-  void _readFort13Body(std::fstream &fid);
+  void _readFort13Body(size_t offset);
+  bool _readFort13Chunk(const Fort13Chunk &chunk,
+                        const std::unordered_map<size_t, size_t> &lookup);
   void _writeFort13Body(std::ofstream &fid);
+  void _writeFort13Chunk(size_t parameter, const size_t *first,
+                         const size_t *last, std::string &buffer) const;
   void _writeFort13Header(std::ofstream &fid);
   void _fillDefaultValues();
-  void _mapNodes();
-  size_t _countDefault(Adcirc::ModelParameters::AttributeMetadata &metadata,
-                       std::vector<Adcirc::ModelParameters::Attribute> &values);
+  void _setNodeIds();
+  size_t _countDefault(size_t parameter, std::vector<size_t> &nodes);
 
   /// Mapping function between the name of a nodal parameter and its position in
   /// the nodalParameters vector
@@ -102,8 +131,12 @@ class NodalAttributesPrivate {
   /// Vector of objects containing the nodal parameters read from the file
   std::vector<Adcirc::ModelParameters::AttributeMetadata> m_nodalParameters;
 
-  /// Vector of objects for the nodal parameters
-  std::vector<std::vector<Adcirc::ModelParameters::Attribute> > m_nodalData;
+  /// Node ids used in the nodal attributes file
+  std::vector<size_t> m_nodeIds;
+
+  /// Values for each of the nodal parameters. The storage is shared with the
+  /// Attribute views handed out by attribute() so that views never dangle
+  std::vector<std::shared_ptr<AttributeData>> m_nodalData;
 };
 }  // namespace Private
 }  // namespace Adcirc
@@ -479,6 +479,40 @@ void OutputRecord::setAll(size_t size, const double* values_u,
   return;
 }
 
+/**
+ * @brief Reorders the values to follow a renumbered mesh
+ * @param[in] permutation original node index for each new node position, as
+ * returned by Mesh::reorder
+ */
+void OutputRecord::permute(const std::vector<size_t>& permutation) {
+  if (permutation.size() != this->m_numNodes) {
+    adcircmodules_throw_exception("OutputRecord: Array size mismatch");
+    return;
+  }
+  std::vector<bool> seen(this->m_numNodes, false);
+  for (auto i : permutation) {
+    if (i >= this->m_numNodes) {
+      adcircmodules_throw_exception("OutputRecord: Index out of range");
+      return;
+    }
+    if (seen[i]) {
+      adcircmodules_throw_exception(
+          "OutputRecord: Duplicate index in permutation");
+      return;
+    }
+    seen[i] = true;
+  }
+  for (auto* v : {&this->m_u, &this->m_v, &this->m_w}) {
+    if (v->size() != this->m_numNodes) continue;
+    std::vector<double> p(this->m_numNodes);
+    for (size_t i = 0; i < this->m_numNodes; ++i) {
+      p[i] = (*v)[permutation[i]];
+    }
+    v->swap(p);
+  }
+  return;
+}
+
 std::vector<double> OutputRecord::magnitudes() {
   assert(this->m_metadata.isVector());
   if (!this->m_metadata.isVector()) {
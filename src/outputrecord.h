@@ -81,6 +81,8 @@ class OutputRecord {
   void setAll(size_t size, const double* values_u, const double* values_v,
               const double* values_w);
 
+  void permute(const std::vector<size_t>& permutation);
+
   std::vector<double> values(size_t column = 0);
   std::vector<double> magnitudes();
   std::vector<double> directions(AngleUnits angleType = AngleUnits::Degrees);
@@ -121,6 +123,7 @@ class OutputRecord {
 
   friend class ReadOutput;
   friend class WriteOutput;
+  friend class StationInterpolation;
 
  private:
   std::vector<double> m_u;
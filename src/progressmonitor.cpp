@@ -0,0 +1,141 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "progressmonitor.h"
+#include "progressmonitor_private.h"
+
+using namespace Adcirc;
+
+/**
+ * @brief Constructor
+ * @param[in] showProgressBar true if a text progress bar should be printed to
+ * standard output
+ */
+ProgressMonitor::ProgressMonitor(bool showProgressBar)
+    : m_impl(new Adcirc::Private::ProgressMonitorPrivate(this,
+                                                         showProgressBar)) {}
+
+ProgressMonitor::~ProgressMonitor() = default;
+
+/**
+ * @brief Starts monitoring a new operation and clears any previous
+ * cancellation request
+ * @param[in] total number of work items in the operation
+ */
+void ProgressMonitor::begin(size_t total) { this->m_impl->begin(total); }
+
+/**
+ * @brief Records completed work items for the calling thread
+ * @param[in] n number of completed work items
+ *
+ * This may be called concurrently from OpenMP threads. The count is kept in
+ * a counter owned by the calling thread and periodically added to the shared
+ * total.
+ */
+void ProgressMonitor::increment(size_t n) { this->m_impl->increment(n); }
+
+/**
+ * @brief Completes the operation, publishing all outstanding counts and
+ * reporting the final progress
+ */
+void ProgressMonitor::finish() { this->m_impl->finish(); }
+
+/**
+ * @brief Number of work items that have been published as complete
+ * @return completed work items
+ */
+size_t ProgressMonitor::completed() const { return this->m_impl->completed(); }
+
+/**
+ * @brief Total number of work items in the current operation
+ * @return total work items
+ */
+size_t ProgressMonitor::total() const { return this->m_impl->total(); }
+
+/**
+ * @brief Fraction of the current operation that has been completed
+ * @return fraction between 0 and 1
+ */
+double ProgressMonitor::fraction() const { return this->m_impl->fraction(); }
+
+/**
+ * @brief Requests that the current operation stop. Operations check this
+ * flag periodically and raise an exception once they have stopped
+ */
+void ProgressMonitor::cancel() { this->m_impl->cancel(); }
+
+/**
+ * @brief Returns true if cancellation has been requested
+ * @return cancellation status
+ */
+bool ProgressMonitor::isCancelled() const {
+  return this->m_impl->isCancelled();
+}
+
+/**
+ * @brief Minimum time between progress reports
+ * @return interval in seconds
+ */
+double ProgressMonitor::interval() const { return this->m_impl->interval(); }
+
+/**
+ * @brief Sets the minimum time between progress reports
+ * @param[in] seconds interval in seconds. Default is 0.5
+ */
+void ProgressMonitor::setInterval(double seconds) {
+  this->m_impl->setInterval(seconds);
+}
+
+/**
+ * @brief Returns true if a text progress bar is printed
+ * @return progress bar status
+ */
+bool ProgressMonitor::showProgressBar() const {
+  return this->m_impl->showProgressBar();
+}
+
+/**
+ * @brief Sets whether a text progress bar is printed. Takes effect at the
+ * next call to begin
+ * @param[in] showProgressBar true if the progress bar should be printed
+ */
+void ProgressMonitor::setShowProgressBar(bool showProgressBar) {
+  this->m_impl->setShowProgressBar(showProgressBar);
+}
+
+/**
+ * @brief Sets a function that is called with the number of completed and
+ * total work items each time progress is reported
+ * @param[in] callback function to call
+ */
+void ProgressMonitor::setCallback(const Callback &callback) {
+  this->m_impl->setCallback(callback);
+}
+
+/**
+ * @brief Called each time progress is reported
+ * @param[in] completed number of completed work items
+ * @param[in] total total number of work items
+ *
+ * Reports are rate limited by the interval and are never made by more than
+ * one thread at a time, however they may be made from any worker thread. The
+ * default implementation updates the progress bar and calls the callback.
+ */
+void ProgressMonitor::onProgress(size_t completed, size_t total) {
+  this->m_impl->defaultProgress(completed, total);
+}
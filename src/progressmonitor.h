@@ -0,0 +1,83 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_PROGRESSMONITOR_H
+#define ADCMOD_PROGRESSMONITOR_H
+
+#include <functional>
+#include <memory>
+#include "adcircmodules_global.h"
+
+namespace Adcirc {
+
+namespace Private {
+// Forward declaration of pimpl class
+class ProgressMonitorPrivate;
+}  // namespace Private
+
+/**
+ * @class ProgressMonitor
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Reports progress of long running operations and allows them to be
+ * cancelled
+ *
+ * Worker threads accumulate progress in their own counters, which are
+ * periodically added to a shared atomic total, so that reporting progress does
+ * not serialize the threads. Progress is reported at most once per interval
+ * through the onProgress function, which may be overridden (including from
+ * Python) or replaced with a callback. Operations check isCancelled and stop
+ * early when cancel has been called from another thread.
+ *
+ */
+class ProgressMonitor {
+ public:
+  using Callback = std::function<void(size_t, size_t)>;
+
+  ADCIRCMODULES_EXPORT ProgressMonitor(bool showProgressBar = false);
+  virtual ADCIRCMODULES_EXPORT ~ProgressMonitor();
+
+  void ADCIRCMODULES_EXPORT begin(size_t total);
+  void ADCIRCMODULES_EXPORT increment(size_t n = 1);
+  void ADCIRCMODULES_EXPORT finish();
+
+  size_t ADCIRCMODULES_EXPORT completed() const;
+  size_t ADCIRCMODULES_EXPORT total() const;
+  double ADCIRCMODULES_EXPORT fraction() const;
+
+  void ADCIRCMODULES_EXPORT cancel();
+  bool ADCIRCMODULES_EXPORT isCancelled() const;
+
+  double ADCIRCMODULES_EXPORT interval() const;
+  void ADCIRCMODULES_EXPORT setInterval(double seconds);
+
+  bool ADCIRCMODULES_EXPORT showProgressBar() const;
+  void ADCIRCMODULES_EXPORT setShowProgressBar(bool showProgressBar);
+
+  void ADCIRCMODULES_EXPORT setCallback(const Callback &callback);
+
+  virtual void ADCIRCMODULES_EXPORT onProgress(size_t completed,
+                                               size_t total);
+
+ private:
+  std::unique_ptr<Adcirc::Private::ProgressMonitorPrivate> m_impl;
+};
+}  // namespace Adcirc
+
+#endif  // ADCMOD_PROGRESSMONITOR_H
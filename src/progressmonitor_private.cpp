@@ -0,0 +1,202 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "progressmonitor_private.h"
+
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <thread>
+
+#include "logging.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Adcirc::Private;
+
+//...Approximate number of times per run that each thread publishes its
+//   local count to the shared total
+constexpr size_t c_flushesPerThread = 1000;
+
+ProgressMonitorPrivate::ProgressMonitorPrivate(Adcirc::ProgressMonitor *parent,
+                                               bool showProgressBar)
+    : m_parent(parent),
+      m_counters(nullptr),
+      m_numCounters(0),
+      m_completed(0),
+      m_cancelled(false),
+      m_nextReport(0),
+      m_total(0),
+      m_flushThreshold(1),
+      m_interval(500),
+      m_showProgressBar(showProgressBar),
+      m_displayed(0) {
+  m_reporting.clear();
+}
+
+int64_t ProgressMonitorPrivate::now() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void ProgressMonitorPrivate::begin(size_t total) {
+#ifdef _OPENMP
+  const size_t nt = static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t nt = 1;
+#endif
+
+  //...std::vector does not honor the alignment of ThreadCounter before
+  //   C++17, so the counters are placed in storage aligned by hand
+  this->m_counterStorage.assign((nt + 1) * sizeof(ThreadCounter), 0);
+  void *p = this->m_counterStorage.data();
+  size_t space = this->m_counterStorage.size();
+  p = std::align(alignof(ThreadCounter), nt * sizeof(ThreadCounter), p, space);
+  this->m_counters = static_cast<ThreadCounter *>(p);
+  this->m_numCounters = nt;
+  for (size_t t = 0; t < nt; ++t) {
+    new (&this->m_counters[t]) ThreadCounter{0};
+  }
+
+  this->m_owner = std::this_thread::get_id();
+  this->m_total = total;
+  this->m_flushThreshold =
+      std::max<size_t>(1, total / (nt * c_flushesPerThread));
+  this->m_completed.store(0);
+  this->m_cancelled.store(false);
+  this->m_nextReport.store(ProgressMonitorPrivate::now() + this->m_interval);
+  this->m_displayed = 0;
+  if (this->m_showProgressBar) {
+    this->m_progressBar.reset(new boost::progress_display(total));
+  } else {
+    this->m_progressBar.reset(nullptr);
+  }
+}
+
+void ProgressMonitorPrivate::increment(size_t n) {
+#ifdef _OPENMP
+  const size_t t = static_cast<size_t>(omp_get_thread_num());
+#else
+  const size_t t = 0;
+#endif
+  if (t >= this->m_numCounters) {
+    this->m_completed.fetch_add(n, std::memory_order_relaxed);
+    this->report(false);
+    return;
+  }
+  ThreadCounter &c = this->m_counters[t];
+  c.pending += n;
+  if (c.pending >= this->m_flushThreshold) {
+    this->flush(c);
+    this->report(false);
+  }
+}
+
+void ProgressMonitorPrivate::flush(ThreadCounter &counter) {
+  if (counter.pending == 0) return;
+  this->m_completed.fetch_add(counter.pending, std::memory_order_relaxed);
+  counter.pending = 0;
+}
+
+/**
+ * @brief Publishes progress if the reporting interval has elapsed
+ * @param force report regardless of the interval
+ *
+ * Progress is only published from the thread that called begin, which is the
+ * master thread of any parallel loop being monitored. onProgress may be
+ * overridden in Python through a SWIG director, which must not be entered
+ * from an OpenMP worker thread that does not hold the interpreter lock.
+ * Worker threads only add their counts to the shared total.
+ */
+void ProgressMonitorPrivate::report(bool force) {
+  if (std::this_thread::get_id() != this->m_owner) return;
+  if (!force) {
+    const int64_t t = ProgressMonitorPrivate::now();
+    int64_t next = this->m_nextReport.load(std::memory_order_relaxed);
+    if (t < next) return;
+    if (!this->m_nextReport.compare_exchange_strong(next,
+                                                    t + this->m_interval)) {
+      return;
+    }
+  }
+  if (this->m_reporting.test_and_set(std::memory_order_acquire)) return;
+  this->m_parent->onProgress(this->completed(), this->m_total);
+  this->m_reporting.clear(std::memory_order_release);
+}
+
+void ProgressMonitorPrivate::finish() {
+  for (size_t t = 0; t < this->m_numCounters; ++t) {
+    this->flush(this->m_counters[t]);
+  }
+  this->report(true);
+}
+
+size_t ProgressMonitorPrivate::completed() const {
+  return std::min(this->m_completed.load(std::memory_order_relaxed),
+                  this->m_total);
+}
+
+size_t ProgressMonitorPrivate::total() const { return this->m_total; }
+
+double ProgressMonitorPrivate::fraction() const {
+  return this->m_total > 0 ? static_cast<double>(this->completed()) /
+                                 static_cast<double>(this->m_total)
+                           : 0.0;
+}
+
+void ProgressMonitorPrivate::cancel() {
+  this->m_cancelled.store(true, std::memory_order_relaxed);
+}
+
+bool ProgressMonitorPrivate::isCancelled() const {
+  return this->m_cancelled.load(std::memory_order_relaxed);
+}
+
+double ProgressMonitorPrivate::interval() const {
+  return static_cast<double>(this->m_interval) / 1000.0;
+}
+
+void ProgressMonitorPrivate::setInterval(double seconds) {
+  this->m_interval = static_cast<int64_t>(std::max(0.0, seconds) * 1000.0);
+}
+
+bool ProgressMonitorPrivate::showProgressBar() const {
+  return this->m_showProgressBar;
+}
+
+void ProgressMonitorPrivate::setShowProgressBar(bool showProgressBar) {
+  this->m_showProgressBar = showProgressBar;
+}
+
+void ProgressMonitorPrivate::setCallback(
+    const Adcirc::ProgressMonitor::Callback &callback) {
+  this->m_callback = callback;
+}
+
+void ProgressMonitorPrivate::defaultProgress(size_t completed, size_t total) {
+  if (this->m_progressBar && completed > this->m_displayed) {
+    *(this->m_progressBar) += completed - this->m_displayed;
+    this->m_displayed = completed;
+  }
+  if (this->m_callback) {
+    this->m_callback(completed, total);
+  }
+}
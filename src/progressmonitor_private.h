@@ -0,0 +1,91 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_PROGRESSMONITORPRIVATE_H
+#define ADCMOD_PROGRESSMONITORPRIVATE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "boost/progress.hpp"
+#include "progressmonitor.h"
+
+namespace Adcirc {
+namespace Private {
+
+class ProgressMonitorPrivate {
+ public:
+  ProgressMonitorPrivate(Adcirc::ProgressMonitor *parent, bool showProgressBar);
+
+  void begin(size_t total);
+  void increment(size_t n);
+  void finish();
+
+  size_t completed() const;
+  size_t total() const;
+  double fraction() const;
+
+  void cancel();
+  bool isCancelled() const;
+
+  double interval() const;
+  void setInterval(double seconds);
+
+  bool showProgressBar() const;
+  void setShowProgressBar(bool showProgressBar);
+
+  void setCallback(const Adcirc::ProgressMonitor::Callback &callback);
+
+  void defaultProgress(size_t completed, size_t total);
+
+ private:
+  /// Counter owned by a single thread, aligned to a cache line to avoid
+  /// false sharing
+  struct alignas(64) ThreadCounter {
+    size_t pending;
+  };
+
+  void flush(ThreadCounter &counter);
+  void report(bool force);
+  static int64_t now();
+
+  Adcirc::ProgressMonitor *m_parent;
+  std::vector<char> m_counterStorage;
+  ThreadCounter *m_counters;
+  size_t m_numCounters;
+  std::thread::id m_owner;
+  std::atomic<size_t> m_completed;
+  std::atomic<bool> m_cancelled;
+  std::atomic<int64_t> m_nextReport;
+  std::atomic_flag m_reporting;
+  size_t m_total;
+  size_t m_flushThreshold;
+  int64_t m_interval;
+  bool m_showProgressBar;
+  size_t m_displayed;
+  std::unique_ptr<boost::progress_display> m_progressBar;
+  Adcirc::ProgressMonitor::Callback m_callback;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_PROGRESSMONITORPRIVATE_H
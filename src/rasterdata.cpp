@@ -19,6 +19,7 @@
 #include "rasterdata.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <iostream>
 
@@ -49,7 +50,7 @@ template double Adcirc::Raster::Rasterdata::nodata<double>() const;
       m_ymax(-std::numeric_limits<double>::max()), m_dx(0.0), m_dy(0.0),      \
       m_nodata(-std::numeric_limits<double>::max()),                          \
       m_nodataint(-std::numeric_limits<int>::max()), m_readType(GDT_Unknown), \
-      m_rasterType(RasterTypes::Unknown)
+      m_rasterType(RasterTypes::Unknown), m_overviewsInitialized(false)
 
 /**
  * @brief Default constructor without a filename
@@ -303,6 +304,9 @@ T Rasterdata::pixelValue(size_t i, size_t j) {
 template <typename T>
 T Rasterdata::pixelValue(Pixel &p) {
   if (p.i() > 0 && p.j() > 0 && p.i() < this->nx() && p.j() < this->ny()) {
+    if (this->m_isRead) {
+      return this->pixelValueFromMemory<T>(p.i(), p.j());
+    }
     T buf;
 #ifndef GDAL_IS_THREADSAFE
 #pragma omp critical
@@ -449,13 +453,7 @@ int Rasterdata::pixelValuesFromMemory(size_t ibegin, size_t jbegin, size_t iend,
   for (size_t j = jbegin; j <= jend; ++j) {
     for (size_t i = ibegin; i <= iend; ++i) {
       std::tie(x[k], y[k]) = this->pixelToCoordinate(i, j);
-      if (std::is_same<T, int>::value) {
-        z[k] = this->m_intOnDisk[j][i];
-      } else if (std::is_same<T, double>::value) {
-        z[k] = this->m_doubleOnDisk[j][i];
-      } else {
-        adcircmodules_throw_exception("Rasterdata: Invalid pixel type");
-      }
+      z[k] = this->pixelValueFromMemory<T>(i, j);
       k++;
     }
   }
@@ -549,3 +547,181 @@ int Rasterdata::epsg() const { return this->m_epsg; }
  * @param epsg epsg code for the raster
  */
 void Rasterdata::setEpsg(int epsg) { this->m_epsg = epsg; }
+
+/**
+ * @brief Returns a pixel value from the in-memory copy of the raster
+ * @param i i-index
+ * @param j j-index
+ * @return pixel value converted to the requested type
+ *
+ * The storage is selected by the type of the raster, not the requested type,
+ * since only one of the integer or floating point arrays is populated
+ */
+template <typename T>
+T Rasterdata::pixelValueFromMemory(size_t i, size_t j) const {
+  if (this->m_rasterType == RasterTypes::Double) {
+    return static_cast<T>(this->m_doubleOnDisk[j][i]);
+  } else {
+    return static_cast<T>(this->m_intOnDisk[j][i]);
+  }
+}
+
+/**
+ * @brief Makes the reduced resolution versions of the raster available
+ * @return number of overview levels
+ *
+ * If the raster has been read into memory, a pyramid is built by the library
+ * where each level halves the resolution of the previous one. Floating point
+ * rasters are averaged and integer (classified) rasters use the most common
+ * class. Otherwise, any overviews stored with the raster by GDAL are used.
+ * Overviews are not written to disk.
+ */
+size_t Rasterdata::initializeOverviews() {
+  if (this->m_overviewsInitialized) return this->m_overviews.size();
+
+  this->m_overviews.clear();
+
+  if (this->m_isRead) {
+    const Rasterdata *level = this;
+    while (this->m_overviews.size() < Rasterdata::c_maxOverviews &&
+           std::min(level->nx(), level->ny()) / 2 >=
+               Rasterdata::c_minOverviewSize) {
+      this->m_overviews.push_back(level->downsample());
+      level = this->m_overviews.back().get();
+    }
+  } else if (this->m_band != nullptr) {
+    int n = this->m_band->GetOverviewCount();
+    for (int i = 0; i < n; ++i) {
+      GDALRasterBand *band = this->m_band->GetOverview(i);
+      if (band == nullptr) continue;
+      std::unique_ptr<Rasterdata> r =
+          this->createOverview(static_cast<size_t>(band->GetXSize()),
+                               static_cast<size_t>(band->GetYSize()));
+      r->m_band = band;
+      this->m_overviews.push_back(std::move(r));
+    }
+    std::sort(this->m_overviews.begin(), this->m_overviews.end(),
+              [](const std::unique_ptr<Rasterdata> &a,
+                 const std::unique_ptr<Rasterdata> &b) {
+                return a->dx() < b->dx();
+              });
+  }
+
+  this->m_overviewsInitialized = true;
+  return this->m_overviews.size();
+}
+
+/**
+ * @brief Number of overview levels available for the raster
+ * @return number of overviews
+ */
+size_t Rasterdata::numOverviews() const { return this->m_overviews.size(); }
+
+/**
+ * @brief Returns an overview level of the raster
+ * @param index overview index, ordered from finest to coarsest
+ * @return raster object for the overview. The object is owned by this raster
+ */
+Rasterdata *Rasterdata::overview(size_t index) const {
+  if (index >= this->m_overviews.size()) {
+    adcircmodules_throw_exception("Rasterdata: Overview index out of range");
+  }
+  return this->m_overviews[index].get();
+}
+
+/**
+ * @brief Creates a raster object sharing the extent and metadata of this
+ * raster with a reduced number of pixels
+ * @param nx number of pixels in the x-direction
+ * @param ny number of pixels in the y-direction
+ * @return raster object for the overview
+ */
+std::unique_ptr<Rasterdata> Rasterdata::createOverview(size_t nx,
+                                                       size_t ny) const {
+  std::unique_ptr<Rasterdata> r(new Rasterdata(this->m_filename));
+  r->m_isOpen = true;
+  r->m_epsg = this->m_epsg;
+  r->m_nx = nx;
+  r->m_ny = ny;
+  r->m_dx = this->m_dx * static_cast<double>(this->m_nx) /
+            static_cast<double>(nx);
+  r->m_dy = this->m_dy * static_cast<double>(this->m_ny) /
+            static_cast<double>(ny);
+  r->m_xmin = this->m_xmin;
+  r->m_ymax = this->m_ymax;
+  r->m_xmax = static_cast<double>(nx - 1) * r->m_dx + r->m_xmin;
+  r->m_ymin = static_cast<double>(ny - 1) * (-r->m_dy) + r->m_ymax;
+  r->m_nodata = this->m_nodata;
+  r->m_nodataint = this->m_nodataint;
+  r->m_readType = this->m_readType;
+  r->m_rasterType = this->m_rasterType;
+  r->m_projectionReference = this->m_projectionReference;
+  r->m_overviewsInitialized = true;
+  return r;
+}
+
+/**
+ * @brief Builds an in-memory raster at half the resolution of this raster
+ * @return raster object for the overview
+ */
+std::unique_ptr<Rasterdata> Rasterdata::downsample() const {
+  const size_t nx = (this->m_nx + 1) / 2;
+  const size_t ny = (this->m_ny + 1) / 2;
+  std::unique_ptr<Rasterdata> r = this->createOverview(nx, ny);
+  r->m_isRead = true;
+
+  if (this->m_rasterType == RasterTypes::Double) {
+    r->m_doubleOnDisk.resize(boost::extents[ny][nx]);
+#pragma omp parallel for schedule(static) default(none) shared(r)
+    for (signed long long j = 0; j < static_cast<signed long long>(r->m_ny);
+         ++j) {
+      for (size_t i = 0; i < r->m_nx; ++i) {
+        double sum = 0.0;
+        size_t n = 0;
+        for (size_t jj = 2 * j; jj < std::min<size_t>(2 * j + 2, this->m_ny);
+             ++jj) {
+          for (size_t ii = 2 * i; ii < std::min(2 * i + 2, this->m_nx);
+               ++ii) {
+            const double v = this->m_doubleOnDisk[jj][ii];
+            if (v != this->m_nodata) {
+              sum += v;
+              n++;
+            }
+          }
+        }
+        r->m_doubleOnDisk[j][i] =
+            n > 0 ? sum / static_cast<double>(n) : this->m_nodata;
+      }
+    }
+  } else {
+    r->m_intOnDisk.resize(boost::extents[ny][nx]);
+#pragma omp parallel for schedule(static) default(none) shared(r)
+    for (signed long long j = 0; j < static_cast<signed long long>(r->m_ny);
+         ++j) {
+      for (size_t i = 0; i < r->m_nx; ++i) {
+        std::array<int, 4> v;
+        size_t n = 0;
+        for (size_t jj = 2 * j; jj < std::min<size_t>(2 * j + 2, this->m_ny);
+             ++jj) {
+          for (size_t ii = 2 * i; ii < std::min(2 * i + 2, this->m_nx);
+               ++ii) {
+            if (this->m_intOnDisk[jj][ii] != this->m_nodataint) {
+              v[n++] = this->m_intOnDisk[jj][ii];
+            }
+          }
+        }
+        int mode = this->m_nodataint;
+        size_t best = 0;
+        for (size_t a = 0; a < n; ++a) {
+          size_t c = std::count(v.begin(), v.begin() + n, v[a]);
+          if (c > best) {
+            best = c;
+            mode = v[a];
+          }
+        }
+        r->m_intOnDisk[j][i] = mode;
+      }
+    }
+  }
+  return r;
+}
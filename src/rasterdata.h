@@ -19,6 +19,7 @@
 #ifndef ADCMOD_RASTERDATA_H
 #define ADCMOD_RASTERDATA_H
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -117,6 +118,10 @@ class Rasterdata {
 
   bool isOpen() const;
 
+  size_t initializeOverviews();
+  size_t numOverviews() const;
+  Rasterdata *overview(size_t index) const;
+
  private:
   void init();
   bool getRasterMetadata();
@@ -135,6 +140,18 @@ class Rasterdata {
   void readIntegerRasterToMemory();
   void readDoubleRasterToMemory();
 
+  std::unique_ptr<Rasterdata> createOverview(size_t nx, size_t ny) const;
+  std::unique_ptr<Rasterdata> downsample() const;
+
+  template <typename T>
+  T pixelValueFromMemory(size_t i, size_t j) const;
+
+  /// Maximum number of overview levels built for in-memory rasters
+  static constexpr size_t c_maxOverviews = 16;
+
+  /// Smallest dimension of an overview built for in-memory rasters
+  static constexpr size_t c_minOverviewSize = 64;
+
   GDALDataset *m_file;
   GDALRasterBand *m_band;
 
@@ -153,6 +170,8 @@ class Rasterdata {
   RasterTypes m_rasterType;
   std::string m_projectionReference;
   std::string m_filename;
+  bool m_overviewsInitialized;
+  std::vector<std::unique_ptr<Rasterdata>> m_overviews;
 };
 }  // namespace Raster
 }  // namespace Adcirc
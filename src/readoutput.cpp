@@ -18,10 +18,12 @@
 //------------------------------------------------------------------------*/
 #include "readoutput.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <utility>
 
@@ -34,6 +36,12 @@
 
 using namespace Adcirc::Output;
 
+namespace {
+//...Nodes in a subset separated by fewer than this many entries are read
+//   from netcdf as one hyperslab rather than as separate requests
+constexpr size_t c_subsetGap = 256;
+}  // namespace
+
 const std::vector<OutputMetadata>* ReadOutput::adcircFileMetadata() {
   return &c_outputMetadata;
 }
@@ -129,6 +137,43 @@ void ReadOutput::addRecord(const OutputRecord& record) {
   this->rebuildMap();
 }
 
+void ReadOutput::setNodeSubset(const std::vector<size_t>& nodes) {
+  if (!this->m_records.empty()) {
+    adcircmodules_throw_exception(
+        "ReadOutput: Cannot change node subset after records have been read");
+  }
+  if (!std::is_sorted(nodes.begin(), nodes.end()) ||
+      std::adjacent_find(nodes.begin(), nodes.end()) != nodes.end()) {
+    adcircmodules_throw_exception(
+        "ReadOutput: Node subset must be sorted and unique");
+  }
+  if (!nodes.empty() && this->numNodes() != 0 &&
+      nodes.back() >= this->numNodes()) {
+    adcircmodules_throw_exception(
+        "ReadOutput: Node subset exceeds number of nodes in file");
+  }
+  this->m_nodeSubset = nodes;
+}
+
+std::vector<size_t> ReadOutput::nodeSubset() const {
+  return this->m_nodeSubset;
+}
+
+size_t ReadOutput::recordSize() const {
+  return this->m_nodeSubset.empty() ? this->numNodes()
+                                    : this->m_nodeSubset.size();
+}
+
+size_t ReadOutput::subsetIndex(size_t node) const {
+  if (this->m_nodeSubset.empty()) return node;
+  auto it = std::lower_bound(this->m_nodeSubset.begin(),
+                             this->m_nodeSubset.end(), node);
+  if (it == this->m_nodeSubset.end() || *it != node) {
+    return std::numeric_limits<size_t>::max();
+  }
+  return static_cast<size_t>(it - this->m_nodeSubset.begin());
+}
+
 double ReadOutput::modelDt() const { return this->m_modelDt; }
 
 void ReadOutput::setModelDt(double modelDt) { this->m_modelDt = modelDt; }
@@ -547,8 +592,8 @@ void ReadOutput::readNetcdfHeader() {
 void ReadOutput::readAsciiRecord() {
   std::string line;
 
-  this->m_records.push_back(
-      OutputRecord(this->currentSnap(), this->numNodes(), *(this->metadata())));
+  this->m_records.push_back(OutputRecord(
+      this->currentSnap(), this->recordSize(), *(this->metadata())));
   OutputRecord* record = &this->m_records.back();
 
   //...Record header
@@ -588,7 +633,8 @@ void ReadOutput::readAsciiRecord() {
   record->setDefaultValue(dflt);
   record->fill(dflt);
 
-  //...Record loop
+  //...Record loop. When reading a node subset, lines for nodes outside
+  //   the subset are parsed and discarded
   for (size_t i = 0; i < numNonDefault; ++i) {
     std::getline(this->m_fid, line);
 
@@ -596,7 +642,10 @@ void ReadOutput::readAsciiRecord() {
       size_t id;
       double v1, v2;
       if (FileIO::AdcircIO::splitStringAttribute2Format(line, id, v1, v2)) {
-        record->set(id - 1, v1, v2);
+        size_t index = this->subsetIndex(id - 1);
+        if (index != std::numeric_limits<size_t>::max()) {
+          record->set(index, v1, v2);
+        }
       } else {
         adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
       }
@@ -604,7 +653,10 @@ void ReadOutput::readAsciiRecord() {
       size_t id;
       double v1;
       if (FileIO::AdcircIO::splitStringAttribute1Format(line, id, v1)) {
-        record->set(id - 1, v1);
+        size_t index = this->subsetIndex(id - 1);
+        if (index != std::numeric_limits<size_t>::max()) {
+          record->set(index, v1);
+        }
       } else {
         adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
       }
@@ -631,13 +683,20 @@ void ReadOutput::readNetcdfRecord(size_t snap) {
         "ReadOutput: Record requested > number of records in file");
   }
   this->m_records.push_back(
-      OutputRecord(snap, this->numNodes(), this->metadata()->isVector(),
+      OutputRecord(snap, this->recordSize(), this->metadata()->isVector(),
                    this->metadata()->isMax(), this->metadata()->dimension()));
   OutputRecord* record = &this->m_records.back();
 
   record->setTime(this->m_time[snap]);
   record->setIteration(std::floor(this->m_time[snap] / this->dt()));
 
+  if (!this->m_nodeSubset.empty()) {
+    this->readNetcdfSubset(record, snap);
+    this->m_recordMap[record->record()] = this->m_records.size() - 1;
+    this->setCurrentSnap(this->currentSnap() + 1);
+    return;
+  }
+
   //..Read the data record. If it is a max record, there is
   //  no time dimension
   if (this->metadata()->isMax()) {
@@ -731,6 +790,54 @@ void ReadOutput::readNetcdfRecord(size_t snap) {
   this->setCurrentSnap(this->currentSnap() + 1);
 }
 
+void ReadOutput::readNetcdfSubset(OutputRecord* record, size_t snap) {
+  const size_t dimension =
+      std::min<size_t>(this->metadata()->dimension(), 3);
+  std::vector<double>* output[3] = {&record->m_u, &record->m_v, &record->m_w};
+  for (size_t c = 0; c < dimension; ++c) {
+    output[c]->resize(this->m_nodeSubset.size());
+  }
+
+  //...Group the sorted subset into runs with small gaps so that each
+  //   run is one contiguous hyperslab read
+  std::vector<double> buffer;
+  size_t k = 0;
+  while (k < this->m_nodeSubset.size()) {
+    size_t kend = k + 1;
+    while (kend < this->m_nodeSubset.size() &&
+           this->m_nodeSubset[kend] - this->m_nodeSubset[kend - 1] <=
+               c_subsetGap) {
+      ++kend;
+    }
+    const size_t first = this->m_nodeSubset[k];
+    const size_t length = this->m_nodeSubset[kend - 1] - first + 1;
+    buffer.resize(length);
+
+    for (size_t c = 0; c < dimension; ++c) {
+      int ierr;
+      if (this->metadata()->isMax()) {
+        size_t start[1] = {first};
+        size_t count[1] = {length};
+        ierr = nc_get_vara_double(this->m_ncid, this->m_varid_data[c], start,
+                                  count, buffer.data());
+      } else {
+        size_t start[2] = {snap, first};
+        size_t count[2] = {1, length};
+        ierr = nc_get_vara_double(this->m_ncid, this->m_varid_data[c], start,
+                                  count, buffer.data());
+      }
+      if (ierr != NC_NOERR) {
+        adcircmodules_throw_exception(
+            "ReadOutput: Error reading netcdf record");
+      }
+      for (size_t j = k; j < kend; ++j) {
+        (*output[c])[j] = buffer[this->m_nodeSubset[j] - first];
+      }
+    }
+    k = kend;
+  }
+}
+
 void ReadOutput::rebuildMap() {
   this->m_recordMap.clear();
   for (size_t i = 0; i < this->m_records.size(); ++i) {
@@ -112,6 +112,10 @@ class ReadOutput {
 
   void addRecord(const Adcirc::Output::OutputRecord &record);
 
+  void setNodeSubset(const std::vector<size_t> &nodes);
+  std::vector<size_t> nodeSubset() const;
+  size_t recordSize() const;
+
  private:
 
   void setOpen(bool open);
@@ -133,6 +137,7 @@ class ReadOutput {
   std::string m_units;
   std::string m_description;
   std::string m_name;
+  std::vector<size_t> m_nodeSubset;
   std::string m_header;
   Adcirc::Output::OutputMetadata m_metadata;
   size_t m_verbose;
@@ -161,6 +166,8 @@ class ReadOutput {
 
   void readAsciiRecord();
   void readNetcdfRecord(size_t snap);
+  void readNetcdfSubset(Adcirc::Output::OutputRecord *record, size_t snap);
+  size_t subsetIndex(size_t node) const;
   int netcdfVariableSearch(size_t variableIndex, OutputMetadata &filetypeFound);
 };
 }  // namespace Output
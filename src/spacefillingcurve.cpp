@@ -0,0 +1,167 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "spacefillingcurve.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <numeric>
+
+using namespace Adcirc::Private;
+
+/**
+ * @brief Computes the position of an integer coordinate along a Hilbert curve
+ * @param x x-position on the quantized grid
+ * @param y y-position on the quantized grid
+ * @return distance along the Hilbert curve
+ */
+uint64_t SpaceFillingCurve::hilbert(uint32_t x, uint32_t y) {
+  constexpr uint32_t n = 1u << SpaceFillingCurve::order();
+  uint64_t d = 0;
+  for (uint32_t s = n / 2; s > 0; s /= 2) {
+    uint32_t rx = (x & s) > 0 ? 1 : 0;
+    uint32_t ry = (y & s) > 0 ? 1 : 0;
+    d += static_cast<uint64_t>(s) * static_cast<uint64_t>(s) *
+         static_cast<uint64_t>((3 * rx) ^ ry);
+
+    //...Rotate the quadrant
+    if (ry == 0) {
+      if (rx == 1) {
+        x = n - 1 - x;
+        y = n - 1 - y;
+      }
+      std::swap(x, y);
+    }
+  }
+  return d;
+}
+
+/**
+ * @brief Computes the Morton (z-order) code for an integer coordinate
+ * @param x x-position on the quantized grid
+ * @param y y-position on the quantized grid
+ * @return interleaved bits of x and y
+ */
+uint64_t SpaceFillingCurve::morton(uint32_t x, uint32_t y) {
+  auto spread = [](uint64_t v) {
+    v &= 0x00000000ffffffffULL;
+    v = (v | (v << 16)) & 0x0000ffff0000ffffULL;
+    v = (v | (v << 8)) & 0x00ff00ff00ff00ffULL;
+    v = (v | (v << 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    v = (v | (v << 2)) & 0x3333333333333333ULL;
+    v = (v | (v << 1)) & 0x5555555555555555ULL;
+    return v;
+  };
+  return spread(x) | (spread(y) << 1);
+}
+
+/**
+ * @brief Maps a coordinate into the integer range used by the curves
+ * @param v value
+ * @param vmin minimum of the range
+ * @param vmax maximum of the range
+ * @return quantized value
+ */
+uint32_t SpaceFillingCurve::quantize(double v, double vmin, double vmax) {
+  constexpr double n = static_cast<double>((1u << SpaceFillingCurve::order()) - 1);
+  double range = vmax - vmin;
+  if (range <= 0.0) return 0;
+  double f = (v - vmin) / range;
+  f = std::max(0.0, std::min(1.0, f));
+  return static_cast<uint32_t>(f * n);
+}
+
+/**
+ * @brief Computes the Hilbert key for a coordinate inside the given extent
+ * @param x x-coordinate
+ * @param y y-coordinate
+ * @param xmin minimum x of the extent
+ * @param ymin minimum y of the extent
+ * @param xmax maximum x of the extent
+ * @param ymax maximum y of the extent
+ * @return Hilbert key
+ */
+uint64_t SpaceFillingCurve::hilbert(double x, double y, double xmin,
+                                    double ymin, double xmax, double ymax) {
+  return SpaceFillingCurve::hilbert(SpaceFillingCurve::quantize(x, xmin, xmax),
+                                    SpaceFillingCurve::quantize(y, ymin, ymax));
+}
+
+/**
+ * @brief Computes the Morton key for a coordinate inside the given extent
+ * @param x x-coordinate
+ * @param y y-coordinate
+ * @param xmin minimum x of the extent
+ * @param ymin minimum y of the extent
+ * @param xmax maximum x of the extent
+ * @param ymax maximum y of the extent
+ * @return Morton key
+ */
+uint64_t SpaceFillingCurve::morton(double x, double y, double xmin,
+                                   double ymin, double xmax, double ymax) {
+  return SpaceFillingCurve::morton(SpaceFillingCurve::quantize(x, xmin, xmax),
+                                   SpaceFillingCurve::quantize(y, ymin, ymax));
+}
+
+/**
+ * @brief Computes the Hilbert keys for a set of points using the extent of
+ * the points as the bounding box
+ * @param x vector of x-coordinates
+ * @param y vector of y-coordinates
+ * @return vector of Hilbert keys
+ */
+std::vector<uint64_t> SpaceFillingCurve::hilbertKeys(
+    const std::vector<double> &x, const std::vector<double> &y) {
+  assert(x.size() == y.size());
+  std::vector<uint64_t> keys(x.size());
+  if (x.empty()) return keys;
+
+  auto xr = std::minmax_element(x.begin(), x.end());
+  auto yr = std::minmax_element(y.begin(), y.end());
+  const double xmin = *xr.first;
+  const double xmax = *xr.second;
+  const double ymin = *yr.first;
+  const double ymax = *yr.second;
+
+#pragma omp parallel for schedule(static) default(none) \
+    shared(x, y, keys, xmin, xmax, ymin, ymax)
+  for (signed long long i = 0; i < static_cast<signed long long>(x.size());
+       ++i) {
+    keys[i] = SpaceFillingCurve::hilbert(x[i], y[i], xmin, ymin, xmax, ymax);
+  }
+  return keys;
+}
+
+/**
+ * @brief Computes the permutation that sorts a set of points along a Hilbert
+ * curve
+ * @param x vector of x-coordinates
+ * @param y vector of y-coordinates
+ * @return vector of indices in Hilbert order
+ */
+std::vector<size_t> SpaceFillingCurve::hilbertOrder(
+    const std::vector<double> &x, const std::vector<double> &y) {
+  std::vector<uint64_t> keys = SpaceFillingCurve::hilbertKeys(x, y);
+  std::vector<size_t> order(keys.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&keys](size_t a, size_t b) {
+    return keys[a] < keys[b];
+  });
+  return order;
+}
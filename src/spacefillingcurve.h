@@ -0,0 +1,69 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_SPACEFILLINGCURVE_H
+#define ADCMOD_SPACEFILLINGCURVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "adcircmodules_global.h"
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class SpaceFillingCurve
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Static functions used to compute Hilbert and Morton (z-order) keys
+ * for planar coordinates so that data can be ordered by spatial locality
+ *
+ */
+class SpaceFillingCurve {
+ public:
+  SpaceFillingCurve() = default;
+
+  /// Number of bits used in each direction when quantizing coordinates
+  static constexpr unsigned order() { return 16; }
+
+  static uint64_t ADCIRCMODULES_EXPORT hilbert(uint32_t x, uint32_t y);
+  static uint64_t ADCIRCMODULES_EXPORT morton(uint32_t x, uint32_t y);
+
+  static uint64_t ADCIRCMODULES_EXPORT hilbert(double x, double y,
+                                               double xmin, double ymin,
+                                               double xmax, double ymax);
+  static uint64_t ADCIRCMODULES_EXPORT morton(double x, double y, double xmin,
+                                              double ymin, double xmax,
+                                              double ymax);
+
+  static std::vector<uint64_t> ADCIRCMODULES_EXPORT
+  hilbertKeys(const std::vector<double> &x, const std::vector<double> &y);
+
+  static std::vector<size_t> ADCIRCMODULES_EXPORT
+  hilbertOrder(const std::vector<double> &x, const std::vector<double> &y);
+
+ private:
+  static uint32_t quantize(double v, double vmin, double vmax);
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_SPACEFILLINGCURVE_H
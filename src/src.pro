@@ -119,6 +119,8 @@ SOURCES += \
     cdate.cpp \
     formatting.cpp \
     griddata_private.cpp \
+    denselookuptable.cpp \
+    griddatacache.cpp \
     harmonicsoutput_private.cpp \
     harmonicsrecord_private.cpp \
     hash.cpp \
@@ -140,17 +142,27 @@ SOURCES += \
     config.cpp \
     filetypes.cpp \
     meshchecker.cpp \
+    meshcheckreport.cpp \
+    meshintersection.cpp \
+    meshdiff.cpp \
     elementtable.cpp \
     multithreading.cpp \
+    progressmonitor.cpp \
+    progressmonitor_private.cpp \
     griddata.cpp \
     mesh.cpp \
     harmonicsoutput.cpp \
     harmonicsrecord.cpp \
+    harmonicssynthesis.cpp \
     nodalattributes.cpp \
     fileio.cpp \
+    mappedfile.cpp \
+    flatgeobufwriter.cpp \
     rasterdata.cpp \
     pixel.cpp \
     constants.cpp \
+    spacefillingcurve.cpp \
+    coordinatetransform.cpp \
     kdtree.cpp \
     logging.cpp \
     writeoutput.cpp \
@@ -162,12 +174,18 @@ HEADERS += \
     adcirc_outputfiles.h \
     adcircmodules_global.h \
     adcmap.h \
+    binaryio.h \
     cdate.h \
     formatting.h \
+    mappedfile.h \
+    flatgeobufwriter.h \
     fpcompare.h \
     griddata_private.h \
+    denselookuptable.h \
+    griddatacache.h \
     harmonicsoutput_private.h \
     harmonicsrecord_private.h \
+    harmonicssynthesis.h \
     hash.h \
     hash_private.h \
     hashtype.h \
@@ -180,6 +198,7 @@ HEADERS += \
     stationinterpolation.h \
     stationinterpolationoptions.h \
     stringconversion.h \
+    textio.h \
     boundary.h \
     element.h \
     node.h \
@@ -190,8 +209,13 @@ HEADERS += \
     config.h \
     filetypes.h \
     meshchecker.h \
+    meshcheckreport.h \
+    meshintersection.h \
+    meshdiff.h \
     elementtable.h \
     multithreading.h \
+    progressmonitor.h \
+    progressmonitor_private.h \
     griddata.h \
     interpolationmethods.h \
     mesh.h \
@@ -203,6 +227,8 @@ HEADERS += \
     rasterdata.h \
     pixel.h \
     constants.h \
+    spacefillingcurve.h \
+    coordinatetransform.h \
     kdtree.h \
     logging.h \
     default_values.h \
@@ -18,21 +18,80 @@
 //------------------------------------------------------------------------*/
 #include "stationinterpolation.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <memory>
+
+#include "binaryio.h"
 #include "boost/format.hpp"
-#include "boost/progress.hpp"
 #include "constants.h"
+#include "coordinatetransform.h"
 #include "ezproj.h"
 #include "fileio.h"
 #include "fpcompare.h"
+#include "hash.h"
 #include "logging.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace Adcirc::Output;
 
+namespace {
+const char c_weightCacheMagic[] = "ADCMOD_STATION_WEIGHTS";
+constexpr uint32_t c_weightCacheVersion = 2;
+
+//...Bytes used by each station in the weight cache file: found flag, three
+//   node indices and three weights
+constexpr size_t c_weightRecordSize = 1 + 3 * 8 + 3 * 8;
+}  // namespace
+
 StationInterpolation::StationInterpolation(
     const StationInterpolationOptions &options)
-    : m_options(options) {}
+    : m_options(options),
+      m_progressMonitor(nullptr),
+      m_defaultMonitor(new Adcirc::ProgressMonitor(true)),
+      m_defaultValue(Adcirc::Output::defaultOutputValue()) {}
+
+/**
+ * @brief Returns the progress monitor used to report progress of the
+ * interpolation
+ * @return progress monitor. If none has been set, the internal monitor, which
+ * displays a progress bar, is returned
+ */
+Adcirc::ProgressMonitor *StationInterpolation::progressMonitor() {
+  return this->m_progressMonitor ? this->m_progressMonitor
+                                 : this->m_defaultMonitor.get();
+}
+
+/**
+ * @brief Sets a progress monitor used to report progress of the interpolation.
+ * Calling cancel on the monitor stops the run after the current time snap and
+ * throws an exception
+ * @param[in] monitor progress monitor. The monitor is not owned by this object.
+ * Pass nullptr to restore the internal monitor
+ */
+void StationInterpolation::setProgressMonitor(
+    Adcirc::ProgressMonitor *monitor) {
+  this->m_progressMonitor = monitor;
+}
 
 void StationInterpolation::run() {
+  //...Vector records are written as both components, a magnitude or a
+  //   direction, but not as a magnitude and a direction at once. This is
+  //   checked before the interpolation since the records are interpolated
+  //   inside parallel regions
+  if (this->m_options.magnitude() && this->m_options.direction()) {
+    adcircmodules_throw_exception(
+        "StationInterpolation: Select only one of --magnitude or "
+        "--direction");
+  }
+
   Adcirc::Output::ReadOutput globalFile(this->m_options.globalfile());
   globalFile.open();
 
@@ -46,26 +105,189 @@ void StationInterpolation::run() {
   Adcirc::Output::OutputFormat filetype = globalFile.filetype();
   Adcirc::Geometry::Mesh m = this->readMesh(filetype);
   Adcirc::CDate coldstart = this->getColdstartDate();
+  this->m_defaultValue = globalFile.defaultValue();
   this->allocateStationArrays();
   this->generateInterpolationWeights(m);
+  this->buildGatherTable();
+  globalFile.setNodeSubset(this->m_readNodes);
 
   size_t nsnap = this->m_options.endsnap() - this->m_options.startsnap() + 1;
 
-  boost::progress_display progress_bar(nsnap);
+  Adcirc::ProgressMonitor *monitor = this->progressMonitor();
+  monitor->begin(nsnap);
 
-  for (size_t i = this->m_options.startsnap(); i <= this->m_options.endsnap();
-       ++i) {
-    this->interpolateTimeSnapToStations(i, writeVector, coldstart, globalFile);
-    ++progress_bar;
-    globalFile.clearAt(0);
+  if (filetype == Adcirc::Output::OutputNetcdf3 ||
+      filetype == Adcirc::Output::OutputNetcdf4) {
+    globalFile.close();
+    this->interpolateSnapRanges(writeVector, coldstart);
+  } else {
+    this->interpolateSequential(globalFile, writeVector, coldstart);
+  }
+
+  monitor->finish();
+  if (monitor->isCancelled()) {
+    adcircmodules_throw_exception("StationInterpolation: Operation cancelled");
   }
 
   this->reprojectStationOutput();
   this->m_options.stations()->write(this->m_options.outputfile());
 
+  //...The columnar storage is only used while interpolating and writing.
+  //   Afterwards the data is moved into the stations so that the station
+  //   level accessors return the interpolated values
+  this->m_options.stations()->toStations();
+
   return;
 }
 
+/**
+ * @brief Returns the stations holding the interpolated data after run has
+ * completed
+ * @return pointer to the station data, owned by this object
+ */
+Hmdf *StationInterpolation::stations() { return this->m_options.stations(); }
+
+/**
+ * @brief Interpolates a file which must be read record by record (ASCII
+ * output). The next record is read while the current record is interpolated
+ * to the stations
+ * @param[in] globalFile open output file
+ * @param[in] writeVector true if both vector components are written
+ * @param[in] coldstart model cold start date
+ */
+void StationInterpolation::interpolateSequential(
+    Adcirc::Output::ReadOutput &globalFile, const bool writeVector,
+    const CDate &coldstart) {
+  const size_t startsnap = this->m_options.startsnap();
+  const size_t nsnap = this->m_options.endsnap() - startsnap + 1;
+  Adcirc::ProgressMonitor *monitor = this->progressMonitor();
+
+  GatherBuffer buffer;
+  buffer.resize(this->m_gatherStations.size());
+
+  Adcirc::Output::OutputRecord current;
+  Adcirc::Output::OutputRecord next;
+  globalFile.read(startsnap - 1);
+  current = std::move(*globalFile.dataAt(0));
+  globalFile.clearAt(0);
+
+  std::exception_ptr readError;
+
+  for (size_t s = 0; s < nsnap; ++s) {
+    if (monitor->isCancelled()) break;
+    const bool readNext = s + 1 < nsnap;
+
+#pragma omp parallel sections num_threads(2) \
+    shared(globalFile, current, next, buffer, readError, coldstart)
+    {
+#pragma omp section
+      {
+        if (readNext) {
+          try {
+            globalFile.read(startsnap + s);
+            next = std::move(*globalFile.dataAt(0));
+            globalFile.clearAt(0);
+          } catch (...) {
+            readError = std::current_exception();
+          }
+        }
+      }
+#pragma omp section
+      {
+        this->interpolateRecordToStations(current, s, writeVector, coldstart,
+                                          buffer);
+      }
+    }
+
+    if (readError) std::rethrow_exception(readError);
+    std::swap(current, next);
+    monitor->increment();
+  }
+}
+
+/**
+ * @brief Interpolates a file which allows random access to records (netCDF
+ * output). The snaps are divided into contiguous ranges, one for each thread,
+ * and each thread reads its range with its own file handle. Reads are
+ * serialized since the netCDF library is not thread safe, so one thread reads
+ * while the others interpolate
+ * @param[in] writeVector true if both vector components are written
+ * @param[in] coldstart model cold start date
+ */
+void StationInterpolation::interpolateSnapRanges(const bool writeVector,
+                                                 const CDate &coldstart) {
+  const size_t startsnap = this->m_options.startsnap();
+  const size_t nsnap = this->m_options.endsnap() - startsnap + 1;
+  Adcirc::ProgressMonitor *monitor = this->progressMonitor();
+
+#ifdef _OPENMP
+  const int nt = static_cast<int>(std::max<size_t>(
+      1, std::min<size_t>(omp_get_max_threads(), nsnap)));
+#else
+  const int nt = 1;
+#endif
+
+  std::exception_ptr error;
+  std::atomic<bool> failed(false);
+
+#pragma omp parallel num_threads(nt) shared(monitor, error, failed, coldstart)
+  {
+#ifdef _OPENMP
+    const size_t tid = static_cast<size_t>(omp_get_thread_num());
+    const size_t nth = static_cast<size_t>(omp_get_num_threads());
+#else
+    const size_t tid = 0;
+    const size_t nth = 1;
+#endif
+    const size_t first = nsnap * tid / nth;
+    const size_t last = nsnap * (tid + 1) / nth;
+
+    GatherBuffer buffer;
+    buffer.resize(this->m_gatherStations.size());
+    std::unique_ptr<Adcirc::Output::ReadOutput> file;
+
+#pragma omp critical(stationinterpolation_io)
+    {
+      try {
+        file.reset(new Adcirc::Output::ReadOutput(this->m_options.globalfile()));
+        file->open();
+        file->setNodeSubset(this->m_readNodes);
+      } catch (...) {
+        if (!error) error = std::current_exception();
+        failed = true;
+      }
+    }
+
+    for (size_t s = first; s < last; ++s) {
+      if (failed || monitor->isCancelled()) break;
+
+#pragma omp critical(stationinterpolation_io)
+      {
+        try {
+          file->read(startsnap + s - 1);
+        } catch (...) {
+          if (!error) error = std::current_exception();
+          failed = true;
+        }
+      }
+      if (failed) break;
+
+      this->interpolateRecordToStations(*file->dataAt(0), s, writeVector,
+                                        coldstart, buffer);
+      file->clearAt(0);
+      monitor->increment();
+    }
+
+#pragma omp critical(stationinterpolation_io)
+    {
+      if (file && file->isOpen()) file->close();
+      file.reset(nullptr);
+    }
+  }
+
+  if (error) std::rethrow_exception(error);
+}
+
 Adcirc::Geometry::Mesh StationInterpolation::readMesh(
     const Adcirc::Output::OutputFormat &filetype) {
   Adcirc::Geometry::Mesh mesh;
@@ -88,49 +310,39 @@ Adcirc::Geometry::Mesh StationInterpolation::readMesh(
   return mesh;
 }
 
+/**
+ * @brief Generates the interpolation weights for each station. When a weight
+ * cache file is specified and was generated for the same mesh and station
+ * list, the weights are taken from the cache and the element search is
+ * skipped
+ * @param[in] m mesh containing the global output
+ */
 void StationInterpolation::generateInterpolationWeights(
     Adcirc::Geometry::Mesh &m) {
-  m.buildElementalSearchTree();
-  size_t nFound = 0;
-  Ezproj e;
-  Hmdf *stn = this->m_options.stations();
-
-  this->m_weights.resize(stn->nstations());
-
-  for (size_t i = 0; i < stn->nstations(); ++i) {
-    std::vector<double> wt;
-    double x1 = stn->station(i)->longitude();
-    double y1 = stn->station(i)->latitude();
-    double x2 = 0;
-    double y2 = 0;
-
-    if (this->m_options.epsgStation() != this->m_options.epsgGlobal()) {
-      bool latlon = false;
-      e.transform(this->m_options.epsgStation(), this->m_options.epsgGlobal(),
-                  x1, y1, x2, y2, latlon);
-    } else {
-      x2 = x1;
-      y2 = y1;
-    }
-
-    size_t eidx = m.findElement(x2, y2, wt);
+  const std::string cacheFile = this->m_options.weightCacheFile();
+  std::string key;
+  bool cached = false;
+  if (!cacheFile.empty()) {
+    key = this->weightCacheKey(m);
+    cached = this->readWeightCache(key, m.numNodes());
+  }
 
-    if (eidx == m.ELEMENT_NOT_FOUND) {
-      this->m_weights[i].found = false;
-    } else {
-      nFound++;
-      for (size_t j = 0; j < 3; ++j) {
-        this->m_weights[i].found = true;
-        this->m_weights[i].node_index[j] =
-            m.nodeIndexById(m.element(eidx)->node(j)->id());
-        this->m_weights[i].weight[j] = wt[j];
-      }
-    }
+  if (cached) {
+    Adcirc::Logging::log("Station interpolation weights read from cache " +
+                             cacheFile,
+                         "[INFO]: ");
+  } else {
+    this->computeInterpolationWeights(m);
+    if (!cacheFile.empty()) this->writeWeightCache(key);
   }
 
+  const size_t nFound = static_cast<size_t>(
+      std::count_if(this->m_weights.begin(), this->m_weights.end(),
+                    [](const Weight &w) { return w.found; }));
+
   Adcirc::Logging::log(
       boost::str(boost::format("%i of %i stations found inside the mesh") %
-                 nFound % stn->nstations()),
+                 nFound % this->m_weights.size()),
       "[INFO]: ");
   if (nFound == 0) {
     Adcirc::Logging::logError(
@@ -140,28 +352,281 @@ void StationInterpolation::generateInterpolationWeights(
   return;
 }
 
+/**
+ * @brief Locates each station in the mesh and computes its interpolation
+ * weights. The station coordinates are projected in a single batch and the
+ * element search runs in parallel
+ * @param[in] m mesh containing the global output
+ */
+void StationInterpolation::computeInterpolationWeights(
+    Adcirc::Geometry::Mesh &m) {
+  Hmdf *stn = this->m_options.stations();
+  const size_t ns = stn->nstations();
+  this->m_weights.assign(ns, Weight());
+
+  std::vector<double> x(ns), y(ns);
+  for (size_t i = 0; i < ns; ++i) {
+    x[i] = stn->station(i)->longitude();
+    y[i] = stn->station(i)->latitude();
+  }
+
+  if (this->m_options.epsgStation() != this->m_options.epsgGlobal()) {
+    bool latlon = false;
+    int ierr = Adcirc::Private::CoordinateTransform::reproject(
+        this->m_options.epsgStation(), this->m_options.epsgGlobal(), x, y,
+        latlon);
+    if (ierr != Ezproj::NoError) {
+      adcircmodules_throw_exception(
+          "StationInterpolation: Proj4 library error");
+    }
+  }
+
+  //...The search tree is built before the parallel region so that the
+  //   element search only reads shared data
+  m.buildElementalSearchTree();
+  std::vector<size_t> element(ns);
+
+#pragma omp parallel for schedule(dynamic, 64) default(none) \
+    shared(m, x, y, element)
+  for (signed long long i = 0;
+       i < static_cast<signed long long>(element.size()); ++i) {
+    std::vector<double> wt(3);
+    element[i] = m.findElement(x[i], y[i], wt);
+    if (element[i] != Adcirc::Geometry::Mesh::ELEMENT_NOT_FOUND) {
+      this->m_weights[i].found = true;
+      for (size_t j = 0; j < 3; ++j) {
+        this->m_weights[i].weight[j] = wt[j];
+      }
+    }
+  }
+
+  //...The node lookup is not safe to call concurrently
+  for (size_t i = 0; i < ns; ++i) {
+    if (!this->m_weights[i].found) continue;
+    for (size_t j = 0; j < 3; ++j) {
+      this->m_weights[i].node_index[j] =
+          m.nodeIndexById(m.element(element[i])->node(j)->id());
+    }
+  }
+}
+
+/**
+ * @brief Generates the key identifying a weight cache. The key changes when
+ * the mesh, the station locations or the projections change
+ * @param[in] m mesh containing the global output
+ * @return cache key
+ */
+std::string StationInterpolation::weightCacheKey(Adcirc::Geometry::Mesh &m) {
+  Adcirc::Cryptography::Hash h;
+  h.addData(m.hash());
+  h.addData(boost::str(boost::format("%i %i %i") %
+                       this->m_options.epsgStation() %
+                       this->m_options.epsgGlobal() %
+                       this->m_options.stations()->nstations()));
+  Hmdf *stn = this->m_options.stations();
+  for (size_t i = 0; i < stn->nstations(); ++i) {
+    h.addData(boost::str(boost::format("%0.12e %0.12e") %
+                         stn->station(i)->longitude() %
+                         stn->station(i)->latitude()));
+  }
+  std::unique_ptr<char[]> digest(h.getHash());
+  return std::string(digest.get());
+}
+
+/**
+ * @brief Reads the interpolation weights from the weight cache file
+ * @param[in] key cache key for the current mesh and station list
+ * @param[in] numNodes number of nodes in the mesh
+ * @return true if the file exists, was generated with the same key and is
+ * consistent with the mesh
+ */
+bool StationInterpolation::readWeightCache(const std::string &key,
+                                           size_t numNodes) {
+  using namespace Adcirc::Private;
+  const std::string filename = this->m_options.weightCacheFile();
+  std::ifstream fid(filename, std::ios::binary);
+  if (!fid.is_open()) return false;
+
+  char magic[sizeof(c_weightCacheMagic)];
+  char header[sizeof(uint32_t) + sizeof(uint64_t)];
+  uint32_t version = 0;
+  uint64_t keyLength = 0, n = 0;
+  fid.read(magic, sizeof(c_weightCacheMagic));
+  fid.read(header, sizeof(header));
+  const char *pos = header;
+  BinaryIO::extract(pos, header + sizeof(header), version);
+  BinaryIO::extract(pos, header + sizeof(header), keyLength);
+  if (!fid ||
+      std::memcmp(magic, c_weightCacheMagic, sizeof(c_weightCacheMagic)) != 0 ||
+      version != c_weightCacheVersion) {
+    Adcirc::Logging::warning(
+        "StationInterpolation: Ignoring unrecognized weight cache file " +
+        filename);
+    return false;
+  }
+
+  std::string fileKey(keyLength == key.size() ? keyLength : 0, ' ');
+  fid.read(&fileKey[0], fileKey.size());
+  if (!fid || fileKey != key) {
+    Adcirc::Logging::log(
+        "StationInterpolation: Weight cache was generated for a different "
+        "mesh or station list and will be rebuilt");
+    return false;
+  }
+
+  char count[sizeof(uint64_t)];
+  fid.read(count, sizeof(count));
+  pos = count;
+  BinaryIO::extract(pos, count + sizeof(count), n);
+  if (!fid || n != this->m_options.stations()->nstations()) return false;
+
+  std::vector<char> buffer(n * c_weightRecordSize);
+  fid.read(buffer.data(), buffer.size());
+  if (!fid) {
+    Adcirc::Logging::warning("StationInterpolation: Weight cache file " +
+                             filename + " is truncated and will be rebuilt");
+    return false;
+  }
+
+  std::vector<Weight> weights(n);
+  pos = buffer.data();
+  const char *end = pos + buffer.size();
+  for (auto &w : weights) {
+    uint8_t found;
+    BinaryIO::extract(pos, end, found);
+    w.found = found != 0;
+    for (size_t j = 0; j < 3; ++j) {
+      uint64_t index;
+      BinaryIO::extract(pos, end, index);
+      if (w.found && index >= numNodes) return false;
+      w.node_index[j] = static_cast<size_t>(index);
+    }
+    for (size_t j = 0; j < 3; ++j) {
+      BinaryIO::extract(pos, end, w.weight[j]);
+    }
+  }
+
+  this->m_weights = std::move(weights);
+  return true;
+}
+
+/**
+ * @brief Writes the interpolation weights to the weight cache file
+ * @param[in] key cache key for the current mesh and station list
+ */
+void StationInterpolation::writeWeightCache(const std::string &key) const {
+  using namespace Adcirc::Private;
+  const std::string filename = this->m_options.weightCacheFile();
+  std::ofstream fid(filename, std::ios::binary | std::ios::trunc);
+  if (!fid.is_open()) {
+    adcircmodules_throw_exception(
+        "StationInterpolation: Could not open weight cache file " + filename);
+  }
+
+  //...The weights are serialized field by field so that the file does not
+  //   depend on the padding of the Weight structure
+  const uint64_t n = this->m_weights.size();
+  std::vector<char> buffer(c_weightCacheMagic,
+                           c_weightCacheMagic + sizeof(c_weightCacheMagic));
+  buffer.reserve(buffer.size() + key.size() + 20 + n * c_weightRecordSize);
+  BinaryIO::append(buffer, c_weightCacheVersion);
+  BinaryIO::append(buffer, static_cast<uint64_t>(key.size()));
+  buffer.insert(buffer.end(), key.begin(), key.end());
+  BinaryIO::append(buffer, n);
+  for (const auto &w : this->m_weights) {
+    BinaryIO::append(buffer, static_cast<uint8_t>(w.found ? 1 : 0));
+    for (size_t j = 0; j < 3; ++j) {
+      BinaryIO::append(buffer, static_cast<uint64_t>(w.node_index[j]));
+    }
+    for (size_t j = 0; j < 3; ++j) {
+      BinaryIO::append(buffer, w.weight[j]);
+    }
+  }
+  fid.write(buffer.data(), buffer.size());
+  fid.close();
+}
+
+/**
+ * @brief Allocates columnar storage for the requested snaps. Stations outside
+ * the mesh keep the default value
+ */
 void StationInterpolation::allocateStationArrays() {
-  for (size_t i = 0; i < this->m_options.stations()->nstations(); ++i) {
-    this->m_options.station(i)->reserve(this->m_options.endsnap() -
-                                        this->m_options.startsnap());
+  const size_t nsnap =
+      this->m_options.endsnap() - this->m_options.startsnap() + 1;
+  this->m_options.stations()->allocate(nsnap, this->m_defaultValue);
+}
+
+/**
+ * @brief Flattens the interpolation weights of the stations found in the mesh
+ * into contiguous node index and weight arrays, one per element vertex. The
+ * stations are ordered by node so that the gather from the output record
+ * walks memory in order.
+ *
+ * When sparse reading is enabled, the vertices used by the stations are
+ * collected into a sorted list of unique nodes which is handed to the output
+ * reader so that only those nodes are read from each record. The gather
+ * indices then refer to positions within that list
+ */
+void StationInterpolation::buildGatherTable() {
+  this->m_gatherStations.clear();
+  for (size_t i = 0; i < this->m_weights.size(); ++i) {
+    if (this->m_weights[i].found) this->m_gatherStations.push_back(i);
+  }
+
+  std::sort(this->m_gatherStations.begin(), this->m_gatherStations.end(),
+            [&](size_t a, size_t b) {
+              return this->m_weights[a].node_index[0] <
+                     this->m_weights[b].node_index[0];
+            });
+
+  for (size_t c = 0; c < 3; ++c) {
+    this->m_gatherNodes[c].resize(this->m_gatherStations.size());
+    this->m_gatherWeights[c].resize(this->m_gatherStations.size());
+    for (size_t k = 0; k < this->m_gatherStations.size(); ++k) {
+      const Weight &w = this->m_weights[this->m_gatherStations[k]];
+      this->m_gatherNodes[c][k] = w.node_index[c];
+      this->m_gatherWeights[c][k] = w.weight[c];
+    }
+  }
+
+  this->m_readNodes.clear();
+  if (!this->m_options.sparseRead() || this->m_gatherStations.empty()) return;
+
+  this->m_readNodes.reserve(3 * this->m_gatherStations.size());
+  for (size_t c = 0; c < 3; ++c) {
+    this->m_readNodes.insert(this->m_readNodes.end(),
+                             this->m_gatherNodes[c].begin(),
+                             this->m_gatherNodes[c].end());
+  }
+  std::sort(this->m_readNodes.begin(), this->m_readNodes.end());
+  this->m_readNodes.erase(
+      std::unique(this->m_readNodes.begin(), this->m_readNodes.end()),
+      this->m_readNodes.end());
+
+  for (size_t c = 0; c < 3; ++c) {
+    for (auto &n : this->m_gatherNodes[c]) {
+      n = static_cast<size_t>(std::lower_bound(this->m_readNodes.begin(),
+                                               this->m_readNodes.end(), n) -
+                              this->m_readNodes.begin());
+    }
+  }
+}
+
+void StationInterpolation::GatherBuffer::resize(size_t n) {
+  for (auto &v : this->vertex) {
+    v.resize(n);
   }
+  this->u.resize(n);
+  this->v.resize(n);
+  this->magnitude.resize(n);
+  this->dry.resize(n);
 }
 
 void StationInterpolation::reprojectStationOutput() {
   if (this->m_options.epsgStation() != this->m_options.epsgOutput()) {
-    Ezproj e;
     Hmdf *output = this->m_options.stations();
-    for (size_t i = 0; i < output->nstations(); ++i) {
-      double x1 = output->station(i)->longitude();
-      double y1 = output->station(i)->latitude();
-      double x2 = 0;
-      double y2 = 0;
-      bool latlon = false;
-      e.transform(this->m_options.epsgStation(), this->m_options.epsgOutput(),
-                  x1, y1, x2, y2, latlon);
-      output->station(i)->setLongitude(x2);
-      output->station(i)->setLatitude(y2);
-    }
+    output->setEpsg(this->m_options.epsgStation());
+    output->reproject(this->m_options.epsgOutput());
   }
   return;
 }
@@ -177,102 +642,165 @@ Adcirc::CDate StationInterpolation::getColdstartDate() {
   return Adcirc::CDate(1970, 1, 1, 0, 0, 0);
 }
 
-void StationInterpolation::interpolateTimeSnapToStations(
-    const size_t snap, const bool writeVector, const Adcirc::CDate &coldstart,
-    Adcirc::Output::ReadOutput &globalFile) {
-  globalFile.read(snap - 1);
-  Adcirc::CDate d = coldstart + globalFile.dataAt(0)->time();
+/**
+ * @brief Interpolates one output record to all stations found in the mesh
+ * @param[in] record output record
+ * @param[in] slot position of the record in the station arrays
+ * @param[in] writeVector true if both vector components are written
+ * @param[in] coldstart model cold start date
+ * @param[in] buffer scratch arrays owned by the calling thread
+ */
+void StationInterpolation::interpolateRecordToStations(
+    const Adcirc::Output::OutputRecord &record, const size_t slot,
+    const bool writeVector, const Adcirc::CDate &coldstart,
+    GatherBuffer &buffer) {
   Hmdf *stationData = this->m_options.stations();
+  const size_t nf = this->m_gatherStations.size();
 
-  for (size_t j = 0; j < stationData->nstations(); ++j) {
-    if (this->m_weights[j].found) {
-      if (writeVector) {
-        stationData->station(j)->setNext(
-            d, this->interpVector(globalFile, this->m_weights[j]));
-      } else {
-        if (this->m_options.hasPositiveDirection()) {
-          stationData->station(j)->setNext(
-              d, this->interpScalar(
-                     globalFile, this->m_weights[j],
-                     this->m_options.station(j)->positiveDirection()));
-        } else {
-          stationData->station(j)->setNext(
-              d, this->interpScalar(globalFile, this->m_weights[j]));
-        }
-      }
-    } else {
-      if (writeVector) {
-        stationData->station(j)->setNext(d, globalFile.defaultValue(),
-                                         globalFile.defaultValue());
+  stationData->setTime(slot, coldstart + record.time());
+
+  if (!record.m_metadata.isVector()) {
+    this->gatherVertexValues(record.m_u.data(), buffer);
+    this->blendVertexValues(buffer, buffer.u);
+    for (size_t k = 0; k < nf; ++k) {
+      stationData->setValue(this->m_gatherStations[k], slot, buffer.u[k]);
+    }
+    return;
+  }
+
+  if (writeVector || this->m_options.direction() ||
+      this->m_options.hasPositiveDirection()) {
+    this->gatherVertexValues(record.m_u.data(), buffer);
+    this->blendVertexValues(buffer, buffer.u);
+    this->gatherVertexValues(record.m_v.data(), buffer);
+    this->blendVertexValues(buffer, buffer.v);
+  }
+
+  if (writeVector) {
+    for (size_t k = 0; k < nf; ++k) {
+      stationData->setValue(this->m_gatherStations[k], slot, buffer.u[k],
+                            buffer.v[k]);
+    }
+  } else if (this->m_options.magnitude()) {
+    this->gatherVertexMagnitudes(record, buffer);
+    this->blendVertexValues(buffer, buffer.magnitude);
+    for (size_t k = 0; k < nf; ++k) {
+      const size_t j = this->m_gatherStations[k];
+      const double positiveDirection =
+          this->m_options.hasPositiveDirection()
+              ? stationData->station(j)->positiveDirection()
+              : -9999.0;
+      if (FpCompare::equalTo(positiveDirection, -9999.0)) {
+        stationData->setValue(j, slot, buffer.magnitude[k]);
       } else {
-        stationData->station(j)->setNext(d, globalFile.defaultValue());
+        stationData->setValue(j, slot,
+                              StationInterpolation::signedMagnitude(
+                                  buffer.u[k], buffer.v[k], positiveDirection,
+                                  this->m_defaultValue));
       }
     }
+  } else if (this->m_options.direction()) {
+    for (size_t k = 0; k < nf; ++k) {
+      stationData->setValue(this->m_gatherStations[k], slot,
+                            StationInterpolation::flowDirection(
+                                buffer.u[k], buffer.v[k], this->m_defaultValue));
+    }
   }
-  return;
 }
 
-double StationInterpolation::interpScalar(Adcirc::Output::ReadOutput &data,
-                                          Weight &w,
-                                          const double positive_direction) {
-  if (data.metadata()->isVector()) {
-    return this->interpScalarFromVector(data, w, positive_direction);
-  } else {
-    double v1 = data.dataAt(0)->z(w.node_index[0]);
-    double v2 = data.dataAt(0)->z(w.node_index[1]);
-    double v3 = data.dataAt(0)->z(w.node_index[2]);
-    return this->interpolateDryValues(v1, w.weight[0], v2, w.weight[1], v3,
-                                      w.weight[2], data.defaultValue());
+/**
+ * @brief Gathers the values at the element vertices surrounding each station
+ * @param[in] values nodal values of the output record
+ * @param[out] buffer scratch arrays receiving the vertex values
+ */
+void StationInterpolation::gatherVertexValues(const double *values,
+                                              GatherBuffer &buffer) const {
+  const size_t nf = this->m_gatherStations.size();
+  for (size_t c = 0; c < 3; ++c) {
+    const size_t *node = this->m_gatherNodes[c].data();
+    double *out = buffer.vertex[c].data();
+    for (size_t k = 0; k < nf; ++k) {
+      out[k] = values[node[k]];
+    }
+  }
+}
+
+/**
+ * @brief Gathers the vector magnitude at the element vertices surrounding
+ * each station
+ * @param[in] record vector output record
+ * @param[out] buffer scratch arrays receiving the vertex magnitudes
+ */
+void StationInterpolation::gatherVertexMagnitudes(
+    const Adcirc::Output::OutputRecord &record, GatherBuffer &buffer) const {
+  const size_t nf = this->m_gatherStations.size();
+  const double def = record.defaultValue();
+  const bool threeDimensional = record.m_metadata.dimension() == 3;
+  const double *u = record.m_u.data();
+  const double *v = record.m_v.data();
+  const double *w = threeDimensional ? record.m_w.data() : nullptr;
+  for (size_t c = 0; c < 3; ++c) {
+    const size_t *node = this->m_gatherNodes[c].data();
+    double *out = buffer.vertex[c].data();
+    for (size_t k = 0; k < nf; ++k) {
+      const size_t n = node[k];
+      const double wn = threeDimensional ? w[n] : 0.0;
+      const bool isDefault =
+          u[n] == def && v[n] == def && (!threeDimensional || wn == def);
+      out[k] = isDefault ? def : std::sqrt(u[n] * u[n] + v[n] * v[n] + wn * wn);
+    }
   }
 }
 
-std::tuple<double, double> StationInterpolation::interpVector(
-    Adcirc::Output::ReadOutput &data, Weight &w) {
-  size_t n1 = w.node_index[0];
-  size_t n2 = w.node_index[1];
-  size_t n3 = w.node_index[2];
-  double w1 = w.weight[0];
-  double w2 = w.weight[1];
-  double w3 = w.weight[2];
-  double v1x = data.dataAt(0)->u(n1);
-  double v1y = data.dataAt(0)->v(n1);
-  double v2x = data.dataAt(0)->u(n2);
-  double v2y = data.dataAt(0)->v(n2);
-  double v3x = data.dataAt(0)->u(n3);
-  double v3y = data.dataAt(0)->v(n3);
-  double vx = this->interpolateDryValues(v1x, w1, v2x, w2, v3x, w3,
-                                         data.defaultValue());
-  double vy = this->interpolateDryValues(v1y, w1, v2y, w2, v3y, w3,
-                                         data.defaultValue());
-  return std::make_tuple(vx, vy);
+/**
+ * @brief Applies the interpolation weights to the gathered vertex values. The
+ * weighted sum is computed for every station in a branch free loop which the
+ * compiler can vectorize, then stations with a dry vertex are recomputed with
+ * interpolateDryValues
+ * @param[in] buffer scratch arrays holding the vertex values
+ * @param[out] out interpolated value for each station
+ */
+void StationInterpolation::blendVertexValues(GatherBuffer &buffer,
+                                             std::vector<double> &out) const {
+  const size_t nf = this->m_gatherStations.size();
+  const double def = this->m_defaultValue;
+  const double *v1 = buffer.vertex[0].data();
+  const double *v2 = buffer.vertex[1].data();
+  const double *v3 = buffer.vertex[2].data();
+  const double *w1 = this->m_gatherWeights[0].data();
+  const double *w2 = this->m_gatherWeights[1].data();
+  const double *w3 = this->m_gatherWeights[2].data();
+  double *o = out.data();
+  char *dry = buffer.dry.data();
+
+  //...FpCompare::equalTo is exact equality, so the dry test is written
+  //   directly to keep the loop vectorizable
+  size_t ndry = 0;
+  for (size_t k = 0; k < nf; ++k) {
+    o[k] = v1[k] * w1[k] + v2[k] * w2[k] + v3[k] * w3[k];
+    dry[k] = (v1[k] == def) | (v2[k] == def) | (v3[k] == def);
+    ndry += dry[k];
+  }
+
+  if (ndry == 0) return;
+  for (size_t k = 0; k < nf; ++k) {
+    if (dry[k]) {
+      o[k] = StationInterpolation::interpolateDryValues(
+          v1[k], w1[k], v2[k], w2[k], v3[k], w3[k], def);
+    }
+  }
 }
 
-double StationInterpolation::interpScalarFromVectorWithFlowDirection(
-    Adcirc::Output::ReadOutput &data, Weight &w,
-    const double positive_direction) {
+double StationInterpolation::signedMagnitude(double vx, double vy,
+                                             double positiveDirection,
+                                             double defaultValue) {
   using namespace Adcirc::FpCompare;
-  size_t n1 = w.node_index[0];
-  size_t n2 = w.node_index[1];
-  size_t n3 = w.node_index[2];
-  double w1 = w.weight[0];
-  double w2 = w.weight[1];
-  double w3 = w.weight[2];
-  double v1x = data.dataAt(0)->u(n1);
-  double v1y = data.dataAt(0)->v(n1);
-  double v2x = data.dataAt(0)->u(n2);
-  double v2y = data.dataAt(0)->v(n2);
-  double v3x = data.dataAt(0)->u(n3);
-  double v3y = data.dataAt(0)->v(n3);
-  double vx = this->interpolateDryValues(v1x, w1, v2x, w2, v3x, w3,
-                                         data.defaultValue());
-  double vy = this->interpolateDryValues(v1y, w1, v2y, w2, v3y, w3,
-                                         data.defaultValue());
-  if (equalTo(vx, data.defaultValue()) || equalTo(vy, data.defaultValue())) {
-    return data.defaultValue();
+  if (equalTo(vx, defaultValue) || equalTo(vy, defaultValue)) {
+    return defaultValue;
   }
   double magnitude = std::sqrt(std::pow(vx, 2.0) + std::pow(vy, 2.0));
   double direction =
-      std::atan2(vy, vx) * Adcirc::Constants::rad2deg() - positive_direction;
+      std::atan2(vy, vx) * Adcirc::Constants::rad2deg() - positiveDirection;
 
   if (direction < -180.0)
     direction += 360.0;
@@ -282,60 +810,16 @@ double StationInterpolation::interpScalarFromVectorWithFlowDirection(
   return direction < 90.0 && direction > -90.0 ? magnitude : -magnitude;
 }
 
-double StationInterpolation::interpScalarFromVectorWithoutFlowDirection(
-    Adcirc::Output::ReadOutput &data, Weight &w) {
-  double v1 = data.dataAt(0)->magnitude(w.node_index[0]);
-  double v2 = data.dataAt(0)->magnitude(w.node_index[1]);
-  double v3 = data.dataAt(0)->magnitude(w.node_index[2]);
-  return this->interpolateDryValues(v1, w.weight[0], v2, w.weight[1], v3,
-                                    w.weight[2], data.defaultValue());
-}
-
-double StationInterpolation::interpDirectionFromVector(
-    Adcirc::Output::ReadOutput &data, Weight &w) {
+double StationInterpolation::flowDirection(double vx, double vy,
+                                           double defaultValue) {
   using namespace Adcirc::FpCompare;
-  size_t n1 = w.node_index[0];
-  size_t n2 = w.node_index[1];
-  size_t n3 = w.node_index[2];
-  double w1 = w.weight[0];
-  double w2 = w.weight[1];
-  double w3 = w.weight[2];
-  double v1x = data.dataAt(0)->u(n1);
-  double v1y = data.dataAt(0)->v(n1);
-  double v2x = data.dataAt(0)->u(n2);
-  double v2y = data.dataAt(0)->v(n2);
-  double v3x = data.dataAt(0)->u(n3);
-  double v3y = data.dataAt(0)->v(n3);
-  double vx = this->interpolateDryValues(v1x, w1, v2x, w2, v3x, w3,
-                                         data.defaultValue());
-  double vy = this->interpolateDryValues(v1y, w1, v2y, w2, v3y, w3,
-                                         data.defaultValue());
-  if (equalTo(vx, data.defaultValue()) || equalTo(vy, data.defaultValue())) {
-    return data.defaultValue();
+  if (equalTo(vx, defaultValue) || equalTo(vy, defaultValue)) {
+    return defaultValue;
   } else {
     return std::atan2(vy, vx) * Adcirc::Constants::rad2deg();
   }
 }
 
-double StationInterpolation::interpScalarFromVector(
-    Adcirc::Output::ReadOutput &data, Weight &w,
-    const double positive_direction) {
-  using namespace Adcirc::FpCompare;
-  if (this->m_options.magnitude() && equalTo(positive_direction, -9999.0)) {
-    return this->interpScalarFromVectorWithoutFlowDirection(data, w);
-  } else if (this->m_options.magnitude() &&
-             !equalTo(positive_direction, -9999.0)) {
-    return this->interpScalarFromVectorWithFlowDirection(data, w,
-                                                         positive_direction);
-  } else if (this->m_options.direction()) {
-    return this->interpDirectionFromVector(data, w);
-  } else {
-    adcircmodules_throw_exception(
-        "Cannot write vector data. Select --magnitude or --direction");
-    return data.defaultValue();
-  }
-}
-
 double StationInterpolation::interpolateDryValues(double v1, double w1,
                                                   double v2, double w2,
                                                   double v3, double w3,
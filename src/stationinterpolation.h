@@ -21,13 +21,16 @@
 
 #include <array>
 #include <limits>
+#include <memory>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "adcircmodules_global.h"
 #include "cdate.h"
 #include "hmdf.h"
 #include "mesh.h"
+#include "progressmonitor.h"
 #include "readoutput.h"
 #include "stationinterpolationoptions.h"
 
@@ -41,6 +44,11 @@ class StationInterpolation {
 
   void ADCIRCMODULES_EXPORT run();
 
+  Adcirc::Output::Hmdf ADCIRCMODULES_EXPORT *stations();
+
+  Adcirc::ProgressMonitor ADCIRCMODULES_EXPORT *progressMonitor();
+  void ADCIRCMODULES_EXPORT setProgressMonitor(Adcirc::ProgressMonitor *monitor);
+
  private:
   struct Weight {
     bool found;
@@ -49,6 +57,19 @@ class StationInterpolation {
     Weight() : found(false), node_index{0, 0, 0}, weight{0.0, 0.0, 0.0} {}
   };
 
+  /**
+   * @brief Per-thread scratch arrays used by the station gather kernel. Values
+   * are stored for each station found in the mesh
+   */
+  struct GatherBuffer {
+    std::array<std::vector<double>, 3> vertex;
+    std::vector<double> u;
+    std::vector<double> v;
+    std::vector<double> magnitude;
+    std::vector<char> dry;
+    void resize(size_t n);
+  };
+
   void reprojectStationOutput();
   CDate getColdstartDate();
   Adcirc::Geometry::Mesh readMesh(const Adcirc::Output::OutputFormat &filetype);
@@ -57,32 +78,42 @@ class StationInterpolation {
   Adcirc::Output::Hmdf copyStationList(Adcirc::Output::Hmdf &list,
                                        const bool vector = false);
 
-  void interpolateTimeSnapToStations(const size_t snap, const bool writeVector,
-                                     const CDate &coldstart,
-                                     Adcirc::Output::ReadOutput &globalFile);
+  void interpolateSequential(Adcirc::Output::ReadOutput &globalFile,
+                             const bool writeVector, const CDate &coldstart);
+  void interpolateSnapRanges(const bool writeVector, const CDate &coldstart);
+  void interpolateRecordToStations(const Adcirc::Output::OutputRecord &record,
+                                   const size_t slot, const bool writeVector,
+                                   const CDate &coldstart,
+                                   GatherBuffer &buffer);
   void allocateStationArrays();
   void generateInterpolationWeights(Adcirc::Geometry::Mesh &m);
-  double interpScalar(Adcirc::Output::ReadOutput &data, Weight &w,
-                      const double positive_direction = -9999.0);
-
-  double interpScalarFromVector(Adcirc::Output::ReadOutput &data, Weight &w,
-                                const double positive_direction = -9999.0);
-
-  double interpScalarFromVectorWithoutFlowDirection(
-      Adcirc::Output::ReadOutput &data, Weight &w);
-  double interpScalarFromVectorWithFlowDirection(
-      Adcirc::Output::ReadOutput &data, Weight &w,
-      const double positive_direction);
-  double interpDirectionFromVector(Adcirc::Output::ReadOutput &data, Weight &w);
-
-  std::tuple<double, double> interpVector(Adcirc::Output::ReadOutput &data,
-                                          Weight &w);
-  double interpolateDryValues(double v1, double w1, double v2, double w2,
-                              double v3, double w3, double defaultVal);
+  void computeInterpolationWeights(Adcirc::Geometry::Mesh &m);
+  std::string weightCacheKey(Adcirc::Geometry::Mesh &m);
+  bool readWeightCache(const std::string &key, size_t numNodes);
+  void writeWeightCache(const std::string &key) const;
+  void buildGatherTable();
+
+  void gatherVertexValues(const double *values, GatherBuffer &buffer) const;
+  void gatherVertexMagnitudes(const Adcirc::Output::OutputRecord &record,
+                              GatherBuffer &buffer) const;
+  void blendVertexValues(GatherBuffer &buffer, std::vector<double> &out) const;
+
+  static double signedMagnitude(double vx, double vy, double positiveDirection,
+                                double defaultValue);
+  static double flowDirection(double vx, double vy, double defaultValue);
+  static double interpolateDryValues(double v1, double w1, double v2, double w2,
+                                     double v3, double w3, double defaultVal);
   CDate dateFromString(const std::string &dateString);
 
   std::vector<Weight> m_weights;
+  std::vector<size_t> m_gatherStations;
+  std::array<std::vector<size_t>, 3> m_gatherNodes;
+  std::array<std::vector<double>, 3> m_gatherWeights;
+  std::vector<size_t> m_readNodes;
   Adcirc::Output::StationInterpolationOptions m_options;
+  Adcirc::ProgressMonitor *m_progressMonitor;
+  std::unique_ptr<Adcirc::ProgressMonitor> m_defaultMonitor;
+  double m_defaultValue;
 };
 
 }  // namespace Output
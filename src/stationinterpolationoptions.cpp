@@ -17,9 +17,11 @@ StationInterpolationOptions::StationInterpolationOptions()
       m_outputfile(std::string()),
       m_coldstart(std::string()),
       m_refdate(std::string()),
+      m_weightCacheFile(std::string()),
       m_magnitude(false),
       m_direction(false),
       m_readasciimesh(false),
+      m_sparseRead(true),
       m_startsnap(std::numeric_limits<size_t>::max()),
       m_endsnap(std::numeric_limits<size_t>::max()),
       m_epsgGlobal(4326),
@@ -145,6 +147,23 @@ void StationInterpolationOptions::setMultiplier(double multiplier) {
   this->m_multiplier = multiplier;
 }
 
+bool StationInterpolationOptions::sparseRead() const {
+  return this->m_sparseRead;
+}
+
+void StationInterpolationOptions::setSparseRead(bool sparseRead) {
+  this->m_sparseRead = sparseRead;
+}
+
+std::string StationInterpolationOptions::weightCacheFile() const {
+  return this->m_weightCacheFile;
+}
+
+void StationInterpolationOptions::setWeightCacheFile(
+    const std::string &weightCacheFile) {
+  this->m_weightCacheFile = weightCacheFile;
+}
+
 void StationInterpolationOptions::readStations(const std::string &stationFile) {
   std::string stn;
   if (stationFile != std::string()) {
@@ -59,6 +59,12 @@ class StationInterpolationOptions {
   double ADCIRCMODULES_EXPORT multiplier() const;
   void ADCIRCMODULES_EXPORT setMultiplier(double multiplier);
 
+  bool ADCIRCMODULES_EXPORT sparseRead() const;
+  void ADCIRCMODULES_EXPORT setSparseRead(bool sparseRead);
+
+  std::string ADCIRCMODULES_EXPORT weightCacheFile() const;
+  void ADCIRCMODULES_EXPORT setWeightCacheFile(const std::string &weightCacheFile);
+
   void ADCIRCMODULES_EXPORT readStations(const std::string &stationFile = std::string());
   Adcirc::Output::HmdfStation ADCIRCMODULES_EXPORT *station(size_t index);
   Adcirc::Output::Hmdf ADCIRCMODULES_EXPORT *stations();
@@ -78,10 +84,12 @@ private:
   std::string m_outputfile;
   std::string m_coldstart;
   std::string m_refdate;
+  std::string m_weightCacheFile;
 
   bool m_magnitude;
   bool m_direction;
   bool m_readasciimesh;
+  bool m_sparseRead;
   bool m_hasPositiveDirection;
 
   size_t m_startsnap;
@@ -0,0 +1,173 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_TEXTIO_H
+#define ADCMOD_TEXTIO_H
+
+#include <algorithm>
+#include <clocale>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @brief Helpers used to scan and format ASCII files held in memory, such as
+ * the contents of a MappedFile
+ *
+ * Text is processed as character ranges so that large files can be read and
+ * written without creating a string for each line. Formatted output always
+ * uses a period as the decimal separator regardless of the C locale
+ */
+namespace TextIO {
+
+/**
+ * @brief Returns the line beginning at p and advances p to the start of the
+ * next line
+ * @param[inout] p start of the line, advanced past its line break
+ * @param[in] end end of the character range
+ * @return begin and end of the line, excluding the line break
+ */
+inline std::pair<const char *, const char *> nextLine(const char *&p,
+                                                      const char *end) {
+  const char *begin = p;
+  const char *eol = static_cast<const char *>(
+      std::memchr(p, '\n', static_cast<size_t>(end - p)));
+  if (eol) {
+    p = eol + 1;
+    return {begin, eol};
+  }
+  p = end;
+  return {begin, end};
+}
+
+/**
+ * @brief Returns true if a character is one of the white space characters
+ * recognized by qi::space
+ */
+inline bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' ||
+         c == '\f';
+}
+
+/**
+ * @brief Returns true if a character range only contains white space
+ */
+inline bool isBlank(const char *p, const char *end) {
+  for (; p != end; ++p) {
+    if (!isSpace(*p)) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Skips the white space characters recognized by qi::space
+ * @param[in] p start of the character range
+ * @param[in] end end of the character range
+ * @return first character that is not white space, or end
+ */
+inline const char *skipSpace(const char *p, const char *end) {
+  while (p != end && isSpace(*p)) ++p;
+  return p;
+}
+
+/**
+ * @brief Parses a signed integer after any leading white space with the same
+ * rules as qi::int_, including failing when the value overflows an int
+ * @param[inout] p start of the text, advanced past the integer on success
+ * @param[in] end end of the character range
+ * @param[out] value value read
+ * @return true if an integer was read
+ */
+inline bool parseInteger(const char *&p, const char *end, int &value) {
+  const char *q = skipSpace(p, end);
+  bool negative = false;
+  if (q != end && (*q == '-' || *q == '+')) {
+    negative = *q == '-';
+    ++q;
+  }
+  if (q == end || *q < '0' || *q > '9') return false;
+
+  long long v = 0;
+  const long long limit =
+      negative ? -static_cast<long long>(std::numeric_limits<int>::min())
+               : static_cast<long long>(std::numeric_limits<int>::max());
+  while (q != end && *q >= '0' && *q <= '9') {
+    v = v * 10 + (*q - '0');
+    if (v > limit) return false;
+    ++q;
+  }
+  value = static_cast<int>(negative ? -v : v);
+  p = q;
+  return true;
+}
+
+/**
+ * @brief Replaces the decimal separator of the C locale written by printf
+ * with a period
+ * @param[inout] begin start of the formatted text
+ * @param[in] end end of the formatted text
+ */
+inline void fixDecimalPoint(char *begin, char *end) {
+  const char dp = *localeconv()->decimal_point;
+  if (dp != '.') std::replace(begin, end, dp, '.');
+}
+
+/**
+ * @brief Appends an integer right aligned in a field of the given width
+ * @param[inout] s string that the value is appended to
+ * @param[in] value value to append
+ * @param[in] width minimum width of the field
+ * @param[in] fill character used to pad the field. Using '0' is equivalent to
+ * the printf format %0n.ni and ' ' is equivalent to %*lld
+ */
+inline void appendInteger(std::string &s, long long value, size_t width,
+                          char fill = ' ') {
+  char buffer[24];
+  char *p = buffer + sizeof(buffer);
+  const bool negative = value < 0;
+  unsigned long long v = negative ? 0ULL - static_cast<unsigned long long>(value)
+                                  : static_cast<unsigned long long>(value);
+  do {
+    *--p = static_cast<char>('0' + v % 10);
+    v /= 10;
+  } while (v != 0);
+  size_t length = static_cast<size_t>(buffer + sizeof(buffer) - p);
+  if (fill == '0') {
+    while (length < width && p - buffer > 1) {
+      *--p = '0';
+      ++length;
+    }
+  }
+  if (negative) {
+    *--p = '-';
+    ++length;
+  }
+  if (length < width) s.append(width - length, fill);
+  s.append(p, length);
+}
+
+}  // namespace TextIO
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_TEXTIO_H
@@ -19,7 +19,7 @@
 
 /* Adcirc Interface File */
 #if defined(SWIGPYTHON)
-%module PyAdcirc
+%module(directors="1") PyAdcirc
 #endif
 
 #if defined(SWIGPERL)
@@ -36,6 +36,7 @@
 #include "adcircmodules_global.h"
 #include "config.h"
 #include "logging.h"
+#include "progressmonitor.h"
 #include "filetypes.h"
 #include "hash.h"
 #include "hashtype.h"
@@ -60,6 +61,9 @@
 #include "kdtree.h"
 #include "ezproj.h"
 #include "meshchecker.h"
+#include "meshcheckreport.h"
+#include "meshintersection.h"
+#include "meshdiff.h"
 #include "multithreading.h"
 #include "constants.h"
 %}
@@ -99,6 +103,11 @@ namespace std {
 %include "adcircmodules_global.h"
 %include "config.h"
 %include "logging.h"
+#if defined(SWIGPYTHON)
+%feature("director") Adcirc::ProgressMonitor;
+#endif
+%ignore Adcirc::ProgressMonitor::setCallback;
+%include "progressmonitor.h"
 %include "filetypes.h"
 %include "hash.h"
 %include "hashtype.h"
@@ -122,7 +131,10 @@ namespace std {
 %include "harmonicsoutput.h"
 %include "kdtree.h"
 %include "ezproj.h"
+%include "meshcheckreport.h"
+%include "meshintersection.h"
 %include "meshchecker.h"
+%include "meshdiff.h"
 %include "multithreading.h"
 %include "constants.h"
 #ifdef _USE_GDAL
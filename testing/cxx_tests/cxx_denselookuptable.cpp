@@ -0,0 +1,102 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "denselookuptable.h"
+
+int main() {
+  using Adcirc::Private::DenseLookupTable;
+
+  DenseLookupTable table;
+  if (!table.empty()) return 1;
+
+  table.set(12, 0.12);
+  table.set(3, 0.03);
+  table.set(200, 2.0);
+  table.set(12, 0.15);
+  if (table.size() != 3) return 1;
+  if (table.minimumKey() != 3 || table.maximumKey() != 200) return 1;
+  if (!table.contains(200) || table.contains(4) || table.contains(201)) {
+    return 1;
+  }
+
+  double v;
+  if (!table.value(12, v) || v != 0.15) return 1;
+  if (table.value(11, v)) return 1;
+
+  //...Classes are only accepted within the range of a 16 bit raster
+  bool thrown = false;
+  try {
+    table.set(-1, 1.0);
+  } catch (const std::exception &) {
+    thrown = true;
+  }
+  if (!thrown) return 1;
+  thrown = false;
+  try {
+    table.set(DenseLookupTable::maxKey() + 1, 1.0);
+  } catch (const std::exception &) {
+    thrown = true;
+  }
+  if (!thrown) return 1;
+
+  //...Undefined classes, classes outside of the table and nodata pixels are
+  //   all masked as invalid
+  std::vector<double> keys = {3.0, 12.0, 4.0, 200.0, 1.0, 70000.0, 12.0};
+  std::vector<uint8_t> keyValid = {1, 1, 1, 1, 1, 1, 0};
+  std::vector<double> values;
+  std::vector<uint8_t> valid;
+  table.classify(keys, keyValid, values, valid);
+
+  std::vector<uint8_t> expectedValid = {1, 1, 0, 1, 0, 0, 0};
+  if (valid != expectedValid) {
+    std::cout << "Unexpected classification mask" << std::endl;
+    return 1;
+  }
+  if (std::abs(values[0] - 0.03) > 1e-12 ||
+      std::abs(values[1] - 0.15) > 1e-12 ||
+      std::abs(values[3] - 2.0) > 1e-12) {
+    std::cout << "Unexpected classified values" << std::endl;
+    return 1;
+  }
+
+  //...Nodata pixels of a floating point raster and keys that do not fit in
+  //   an integer are masked without being converted
+  keys = {-std::numeric_limits<double>::max(), 12.0,
+          std::numeric_limits<double>::max(), -1.0, std::nan(""), 200.0};
+  keyValid = {0, 1, 1, 1, 1, 1};
+  table.classify(keys, keyValid, values, valid);
+  expectedValid = {0, 1, 0, 0, 0, 1};
+  if (valid != expectedValid) {
+    std::cout << "Unexpected classification mask for out of range keys"
+              << std::endl;
+    return 1;
+  }
+
+  table.clear();
+  table.classify(keys, keyValid, values, valid);
+  for (auto b : valid) {
+    if (b) return 1;
+  }
+
+  return 0;
+}
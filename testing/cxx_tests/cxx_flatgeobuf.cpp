@@ -0,0 +1,138 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include "adcircmodules.h"
+
+template <typename T>
+T read(const std::vector<char> &data, size_t position) {
+  T v;
+  std::memcpy(&v, &data[position], sizeof(T));
+  return v;
+}
+
+//...Position of a field in a flatbuffers table, or 0 when it is absent
+size_t tableField(const std::vector<char> &data, size_t table, size_t id) {
+  const size_t vtable = table - read<int32_t>(data, table);
+  if (4 + 2 * id >= read<uint16_t>(data, vtable)) return 0;
+  const uint16_t offset = read<uint16_t>(data, vtable + 4 + 2 * id);
+  return offset == 0 ? 0 : table + offset;
+}
+
+int main() {
+  using namespace Adcirc::Geometry;
+
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+  mesh->toElementFlatGeobuf("test_files/ms-riv-elements.fgb");
+
+  std::ifstream f("test_files/ms-riv-elements.fgb", std::ios::binary);
+  std::vector<char> data((std::istreambuf_iterator<char>(f)),
+                         std::istreambuf_iterator<char>());
+
+  const char magic[8] = {'f', 'g', 'b', 3, 'f', 'g', 'b', 0};
+  if (data.size() < 12 || std::memcmp(data.data(), magic, 8) != 0) {
+    std::cout << "Invalid FlatGeobuf signature" << std::endl;
+    return 1;
+  }
+
+  //...Header feature count and envelope
+  const size_t header = 12 + read<uint32_t>(data, 12);
+  const size_t countField = tableField(data, header, 8);
+  const size_t envelopeField = tableField(data, header, 1);
+  if (countField == 0 || envelopeField == 0) {
+    std::cout << "Header is missing the feature count or envelope"
+              << std::endl;
+    return 1;
+  }
+  const uint64_t headerCount = read<uint64_t>(data, countField);
+  std::cout << "Header lists " << headerCount << " features, expected "
+            << mesh->numElements() << std::endl;
+  if (headerCount != mesh->numElements()) return 1;
+
+  std::array<double, 4> extent = {mesh->node(0)->x(), mesh->node(0)->y(),
+                                  mesh->node(0)->x(), mesh->node(0)->y()};
+  for (size_t i = 0; i < mesh->numElements(); ++i) {
+    for (size_t j = 0; j < mesh->element(i)->n(); ++j) {
+      const Node *nd = mesh->element(i)->node(j);
+      extent[0] = std::min(extent[0], nd->x());
+      extent[1] = std::min(extent[1], nd->y());
+      extent[2] = std::max(extent[2], nd->x());
+      extent[3] = std::max(extent[3], nd->y());
+    }
+  }
+  const size_t envelope = envelopeField + read<uint32_t>(data, envelopeField);
+  if (read<uint32_t>(data, envelope) != 4) return 1;
+  for (size_t i = 0; i < 4; ++i) {
+    if (read<double>(data, envelope + 4 + 8 * i) != extent[i]) {
+      std::cout << "Header envelope does not match the mesh extent"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  //...Packed R-tree with 16 children per node. The root is the first node
+  //   and the leaves are the last
+  size_t n = mesh->numElements();
+  size_t numNodes = n;
+  while (n != 1) {
+    n = (n + 15) / 16;
+    numNodes += n;
+  }
+  const size_t index = 12 + read<uint32_t>(data, 8);
+  for (size_t i = 0; i < 4; ++i) {
+    if (read<double>(data, index + 8 * i) != extent[i]) {
+      std::cout << "R-tree root box does not match the mesh extent"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  const size_t featureStart = index + numNodes * 40;
+  std::vector<uint64_t> featureOffset;
+  size_t position = featureStart;
+  while (position + 4 <= data.size()) {
+    featureOffset.push_back(position - featureStart);
+    position += 4 + read<uint32_t>(data, position);
+  }
+
+  std::cout << "Found " << featureOffset.size() << " features, expected "
+            << mesh->numElements() << std::endl;
+  if (featureOffset.size() != mesh->numElements()) return 1;
+  if (position != data.size()) return 1;
+
+  //...Leaf j of the index refers to feature j in file order
+  const size_t leafStart = index + (numNodes - mesh->numElements()) * 40;
+  for (size_t j = 0; j < featureOffset.size(); ++j) {
+    if (read<uint64_t>(data, leafStart + 40 * j + 32) != featureOffset[j]) {
+      std::cout << "R-tree leaf " << j
+                << " does not point at the start of a feature" << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
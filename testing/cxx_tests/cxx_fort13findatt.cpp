@@ -27,7 +27,7 @@ int main(int argc, char *argv[]) {
   fort13->read();
 
   double manning_value =
-      fort13->attribute("mannings_n_at_sea_floor", 0)->value(0);
+      fort13->attribute("mannings_n_at_sea_floor", 0).value(0);
   std::cout << manning_value << std::endl;
   std::cout.flush();
   if (manning_value != 0.036067) return 1;
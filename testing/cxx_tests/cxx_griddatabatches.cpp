@@ -0,0 +1,89 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include "adcircmodules.h"
+
+int main() {
+  using namespace Adcirc::Geometry;
+  using namespace Adcirc::Interpolation;
+
+  std::unique_ptr<Mesh> m(new Mesh("test_files/ms-riv.grd"));
+  m->read();
+  m->defineProjection(4326, true);
+  m->reproject(26915);
+
+  //...A raster built from the mesh depths gives every node a different
+  //   neighbourhood, so a node processed in the wrong batch would show up
+  const size_t nn = m->numNodes();
+  std::vector<double> z(nn);
+  for (size_t i = 0; i < nn; ++i) {
+    z[i] = m->node(i)->z();
+  }
+  m->toRaster("test_files/batch_depth.tif", z, m->extent(), 50.0, -9999.0);
+
+  //...Mixed methods and filter sizes put the nodes into several search
+  //   radius classes with different costs
+  auto batchGriddata = [&](bool benchmark) {
+    std::unique_ptr<Griddata> g(
+        new Griddata(m.get(), "test_files/batch_depth.tif"));
+    g->setEpsg(26915);
+    g->setDefaultValue(-9999.0);
+    g->setRasterInMemory(true);
+    g->setBenchmarkMode(benchmark);
+    for (size_t i = 0; i < nn; ++i) {
+      g->setInterpolationFlag(i, 1 + i % 8);
+      g->setFilterSize(i, 1.0 + static_cast<double>(i % 4));
+    }
+    return g->computeValuesFromRaster();
+  };
+
+  std::cout << "Interpolating with one thread..." << std::endl;
+  Adcirc::Multithreading::disable();
+  std::vector<double> serial = batchGriddata(false);
+
+  std::cout << "Interpolating with spatial batches on four threads..."
+            << std::endl;
+  Adcirc::Multithreading::enable(4);
+  std::vector<double> parallel = batchGriddata(true);
+
+  std::remove("test_files/batch_depth.tif");
+
+  size_t nValid = 0;
+  for (size_t i = 0; i < nn; ++i) {
+    if (serial[i] != parallel[i]) {
+      std::cout << "Node " << i << " differs between schedules: " << serial[i]
+                << " " << parallel[i] << std::endl;
+      return 1;
+    }
+    if (serial[i] != -9999.0) nValid++;
+  }
+
+  //...Agreement only means something if the raster reached the nodes
+  std::cout << "Interpolated " << nValid << " of " << nn << " nodes"
+            << std::endl;
+  if (nValid < nn / 10) {
+    std::cout << "Too few nodes were interpolated from the raster"
+              << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,87 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include "griddatacache.h"
+
+int main() {
+  using Adcirc::Private::GriddataCache;
+
+  const std::string filename = "test_files/griddata_cache.bin";
+  const std::string key = "0123456789abcdef";
+
+  GriddataCache cache;
+  for (size_t i = 0; i < 1000; ++i) {
+    cache.add(GriddataCache::hashToKey("ffff") + i, i % 9,
+              1.0 + 0.5 * (i % 4), 10.0 + i, 0.001 * i);
+  }
+  cache.write(filename, key);
+
+  //...A cache read with the same key reproduces every entry
+  GriddataCache hit;
+  if (!hit.read(filename, key) || hit.size() != 1000) {
+    std::cout << "Cache was not reused" << std::endl;
+    return 1;
+  }
+  for (size_t i = 0; i < 1000; ++i) {
+    double v;
+    if (!hit.find(GriddataCache::hashToKey("ffff") + i, i % 9,
+                  1.0 + 0.5 * (i % 4), 10.0 + i, v) ||
+        v != 0.001 * i) {
+      std::cout << "Cache entry " << i << " was not reproduced" << std::endl;
+      return 1;
+    }
+  }
+
+  //...Entries are only reused when the per-node settings are unchanged
+  double v;
+  const uint64_t h = GriddataCache::hashToKey("ffff");
+  if (hit.find(h, 1, 1.0, 10.0, v)) return 1;
+  if (hit.find(h, 0, 1.5, 10.0, v)) return 1;
+  if (hit.find(h, 0, 1.0, 11.0, v)) return 1;
+  if (hit.find(h + 5000, 0, 1.0, 10.0, v)) return 1;
+
+  //...A different key invalidates the whole cache
+  GriddataCache miss;
+  if (miss.read(filename, "0123456789abcdee") || miss.size() != 0) {
+    std::cout << "Cache was reused with a different key" << std::endl;
+    return 1;
+  }
+
+  //...Truncated files are rejected
+  std::vector<char> bytes;
+  {
+    std::ifstream fid(filename, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(fid),
+                 std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream fid(filename, std::ios::binary | std::ios::trunc);
+    fid.write(bytes.data(), bytes.size() - 7);
+  }
+  GriddataCache truncated;
+  if (truncated.read(filename, key) || truncated.size() != 0) {
+    std::cout << "Truncated cache was accepted" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,105 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include "adcircmodules.h"
+
+int main() {
+  using namespace Adcirc::Geometry;
+  using namespace Adcirc::Interpolation;
+
+  std::unique_ptr<Mesh> m(new Mesh("test_files/ms-riv.grd"));
+  m->read();
+  m->defineProjection(4326, true);
+  m->reproject(26915);
+
+  const size_t nn = m->numNodes();
+  std::vector<double> ext = m->extent();
+  m->toRaster("test_files/cache_raster.tif", std::vector<double>(nn, 3.0),
+              {ext[0], ext[1], ext[2], ext[3]}, 100.0, -9999.0);
+
+  auto cleanup = []() {
+    std::remove("test_files/cache_raster.tif");
+    std::remove("test_files/cache_raster.cache");
+  };
+
+  //...The result cache is reused while the raster is unchanged and rebuilt
+  //   once the raster is rewritten
+  auto cachedGriddata = [&]() {
+    std::unique_ptr<Griddata> gc(
+        new Griddata(m.get(), "test_files/cache_raster.tif"));
+    gc->setEpsg(26915);
+    gc->setDefaultValue(-9999.0);
+    gc->setInterpolationFlags(Average);
+    gc->setFilterSizes(1.0);
+    gc->setCacheFile("test_files/cache_raster.cache");
+    return gc->computeValuesFromRaster();
+  };
+
+  //...Counts the nodes that received a value and checks it against the
+  //   constant written to the raster
+  auto countMatching = [&](const std::vector<double> &values, double expected,
+                           size_t &count) {
+    count = 0;
+    for (size_t i = 0; i < nn; ++i) {
+      if (values[i] == -9999.0) continue;
+      if (std::abs(values[i] - expected) > 0.000001) {
+        std::cout << "Unexpected value " << values[i] << " at node " << i
+                  << std::endl;
+        return false;
+      }
+      count++;
+    }
+    return true;
+  };
+
+  std::cout << "Interpolating with a result cache..." << std::endl;
+  std::remove("test_files/cache_raster.cache");
+  std::vector<double> first = cachedGriddata();
+  std::vector<double> second = cachedGriddata();
+
+  size_t nFirst = 0;
+  if (!countMatching(first, 3.0, nFirst) || nFirst < nn / 10) {
+    std::cout << "Too few nodes were interpolated from the raster"
+              << std::endl;
+    cleanup();
+    return 1;
+  }
+  if (first != second) {
+    std::cout << "Cached values differ from the computed values" << std::endl;
+    cleanup();
+    return 1;
+  }
+
+  m->toRaster("test_files/cache_raster.tif", std::vector<double>(nn, 4.0),
+              {ext[0], ext[1], ext[2], ext[3]}, 100.0, -9999.0);
+  std::vector<double> rebuilt = cachedGriddata();
+  cleanup();
+
+  size_t nRebuilt = 0;
+  if (!countMatching(rebuilt, 4.0, nRebuilt) || nRebuilt != nFirst) {
+    std::cout << "Stale cache values were used after the raster changed"
+              << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,83 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include "adcircmodules.h"
+
+//...Number of values in each node x constituent block of the netcdf file
+constexpr size_t c_netcdfBlockSize = 2097152;
+
+//...Two constituents with enough nodes that the variables are written and
+//   read in more than one block and the last block is not a multiple of the
+//   transpose tile
+constexpr size_t c_numConstituents = 2;
+constexpr size_t c_numNodes = c_netcdfBlockSize / c_numConstituents + 1001;
+
+void writeAsciiHarmonics(const std::string &filename) {
+  FILE *f = fopen(filename.c_str(), "w");
+  fprintf(f, "%12d\n", static_cast<int>(c_numConstituents));
+  fprintf(f, "     0.1405189025E-03  0.6930000   1.02100000  M2\n");
+  fprintf(f, "     0.7292115836E-04  0.7360000   0.94700000  K1\n");
+  fprintf(f, "%12zu\n", c_numNodes);
+  for (size_t i = 0; i < c_numNodes; ++i) {
+    fprintf(f, "%12zu\n", i + 1);
+    for (size_t c = 0; c < c_numConstituents; ++c) {
+      fprintf(f, "%16.10e %9.4f\n", 1e-6 * i + c, (i % 3600) * 0.1 + c);
+    }
+  }
+  fclose(f);
+}
+
+int main() {
+  using namespace Adcirc::Harmonics;
+
+  writeAsciiHarmonics("test_files/blocks.53");
+
+  std::unique_ptr<HarmonicsOutput> ascii(
+      new HarmonicsOutput("test_files/blocks.53"));
+  ascii->read();
+  ascii->write("test_files/blocks.53.nc");
+
+  std::unique_ptr<HarmonicsOutput> netcdf(
+      new HarmonicsOutput("test_files/blocks.53.nc"));
+  netcdf->read();
+
+  if (netcdf->numNodes() != c_numNodes ||
+      netcdf->numConstituents() != c_numConstituents) {
+    std::cout << "Incorrect dimensions" << std::endl;
+    return 1;
+  }
+
+  for (size_t c = 0; c < c_numConstituents; ++c) {
+    for (size_t i = 0; i < c_numNodes; ++i) {
+      if (netcdf->amplitude(c)->value(i) != ascii->amplitude(c)->value(i) ||
+          netcdf->phase(c)->value(i) != ascii->phase(c)->value(i)) {
+        std::cout << "Mismatch at node " << i << " constituent " << c
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  std::remove("test_files/blocks.53");
+  std::remove("test_files/blocks.53.nc");
+
+  return 0;
+}
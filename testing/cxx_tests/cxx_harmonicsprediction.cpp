@@ -0,0 +1,171 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include "adcircmodules.h"
+
+using namespace Adcirc::Harmonics;
+
+/**
+ * Direct evaluation of the constituent sum at a node
+ */
+double constituentSum(HarmonicsRecord *(HarmonicsOutput::*amplitude)(size_t),
+                      HarmonicsRecord *(HarmonicsOutput::*phase)(size_t),
+                      HarmonicsOutput *harm, size_t node, double time) {
+  double sum = 0.0;
+  for (size_t j = 0; j < harm->numConstituents(); ++j) {
+    HarmonicsRecord *a = (harm->*amplitude)(j);
+    HarmonicsRecord *p = (harm->*phase)(j);
+    sum += a->nodalFactor() * a->value(node) *
+           std::cos(a->frequency() * time +
+                    (a->equilibriumArg() - p->value(node)) *
+                        Adcirc::Constants::deg2rad());
+  }
+  return sum;
+}
+
+/**
+ * Streams a prediction to an ascii output file using a buffer that holds
+ * only a few times so that the times are evaluated in several batches, then
+ * compares each record in the file with the single time prediction
+ */
+int checkStreamedPrediction(HarmonicsOutput *harm, const std::string &filename,
+                            double dt, size_t numTimes) {
+  using namespace Adcirc::Output;
+  const size_t dimension = harm->isVelocity() ? 2 : 1;
+  harm->setPredictionBufferSize(harm->numNodes() * dimension *
+                                sizeof(double) * 5);
+
+  OutputRecord first = harm->predict(0.0);
+  std::unique_ptr<ReadOutput> container(new ReadOutput(filename));
+  container->setHeader("harmonic prediction");
+  container->setNumSnaps(numTimes);
+  container->setNumNodes(harm->numNodes());
+  container->setDt(dt);
+  container->setDiteration(1);
+  container->setMetadata(*first.metadata());
+
+  std::unique_ptr<WriteOutput> writer(
+      new WriteOutput(filename, container.get()));
+  writer->open();
+  harm->predict(writer.get(), 0.0, dt * (numTimes - 1), dt);
+  writer->close();
+
+  std::unique_ptr<ReadOutput> output(new ReadOutput(filename));
+  output->open();
+  if (output->numSnaps() != numTimes) {
+    std::cout << "Streamed prediction has " << output->numSnaps()
+              << " records, expected " << numTimes << std::endl;
+    return 1;
+  }
+  for (size_t t = 0; t < numTimes; ++t) {
+    output->read();
+    OutputRecord *r = output->data(t);
+    OutputRecord expected = harm->predict(dt * t);
+    if (std::abs(r->time() - dt * t) > 1e-3) return 1;
+    for (size_t i = 0; i < harm->numNodes(); i += 31) {
+      double e1 = harm->isVelocity() ? expected.u(i) : expected.z(i);
+      double v1 = harm->isVelocity() ? r->u(i) : r->z(i);
+      double e2 = harm->isVelocity() ? expected.v(i) : 0.0;
+      double v2 = harm->isVelocity() ? r->v(i) : 0.0;
+      if (std::abs(v1 - e1) > 1e-5 || std::abs(v2 - e2) > 1e-5) {
+        std::cout << "Streamed prediction differs at record " << t
+                  << " node " << i << std::endl;
+        return 1;
+      }
+    }
+  }
+  output->close();
+  std::remove(filename.c_str());
+  return 0;
+}
+
+int main() {
+
+  std::unique_ptr<HarmonicsOutput> harm(
+      new HarmonicsOutput("test_files/fort.53"));
+  harm->read();
+
+  const double time = 285120.0;
+  Adcirc::Output::OutputRecord record = harm->predict(time);
+
+  //...Check against a direct evaluation of the constituent sum
+  for (size_t i = 0; i < harm->numNodes(); i += 97) {
+    double expected = constituentSum(&HarmonicsOutput::amplitude,
+                                     &HarmonicsOutput::phase, harm.get(), i,
+                                     time);
+    if (std::abs(record.z(i) - expected) > 1e-9) {
+      std::cout << "Prediction at node " << i << " was " << record.z(i)
+                << ", expected " << expected << std::endl;
+      return 1;
+    }
+  }
+
+  std::vector<size_t> nodes = {3, 10, 100};
+  Adcirc::Output::Hmdf stations = harm->predict(
+      nodes, Adcirc::CDate(2020, 1, 1, 0, 0, 0), 0.0, time, time / 96.0);
+  if (stations.nstations() != 3 || stations.numSnaps() != 97) return 1;
+  if (std::abs(stations.value(0, 96) - record.z(3)) > 1e-9) return 1;
+  if (stations.date(96) != Adcirc::CDate(2020, 1, 4, 7, 12, 0)) return 1;
+
+  //...Times streamed to a file are split into batches of 5 times
+  if (checkStreamedPrediction(harm.get(), "test_files/predicted.63", 3600.0,
+                              13) != 0) {
+    return 1;
+  }
+
+  //...Velocity predictions
+  std::unique_ptr<HarmonicsOutput> vel(
+      new HarmonicsOutput("test_files/fort.54"));
+  vel->read();
+  if (!vel->isVelocity()) return 1;
+
+  Adcirc::Output::OutputRecord velocity = vel->predict(time);
+  for (size_t i = 0; i < vel->numNodes(); i += 97) {
+    double u = constituentSum(&HarmonicsOutput::u_amplitude,
+                              &HarmonicsOutput::u_phase, vel.get(), i, time);
+    double v = constituentSum(&HarmonicsOutput::v_amplitude,
+                              &HarmonicsOutput::v_phase, vel.get(), i, time);
+    if (std::abs(velocity.u(i) - u) > 1e-9 ||
+        std::abs(velocity.v(i) - v) > 1e-9) {
+      std::cout << "Velocity prediction at node " << i << " was "
+                << velocity.u(i) << ", " << velocity.v(i) << ", expected "
+                << u << ", " << v << std::endl;
+      return 1;
+    }
+  }
+
+  Adcirc::Output::Hmdf velocityStations = vel->predict(
+      nodes, Adcirc::CDate(2020, 1, 1, 0, 0, 0), 0.0, time, time / 96.0);
+  if (velocityStations.nstations() != 3 || velocityStations.numSnaps() != 97)
+    return 1;
+  if (std::abs(velocityStations.value_u(1, 96) - velocity.u(10)) > 1e-9 ||
+      std::abs(velocityStations.value_v(1, 96) - velocity.v(10)) > 1e-9) {
+    return 1;
+  }
+
+  if (checkStreamedPrediction(vel.get(), "test_files/predicted.64", 3600.0,
+                              13) != 0) {
+    return 1;
+  }
+
+  return 0;
+}
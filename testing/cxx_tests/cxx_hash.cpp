@@ -25,26 +25,32 @@ int main(int argc, char *argv[]) {
   Hash md5(HashType::AdcmodMD5);;
   Hash sha1(HashType::AdcmodSHA1);;
   Hash sha256(HashType::AdcmodSHA256);
+  Hash xxh64(HashType::AdcmodXXH64);
 
   md5.addData(hashData);
   sha1.addData(hashData);
   sha256.addData(hashData);
+  xxh64.addData(hashData);
 
   char* char_hashed_md5 = md5.getHash();
   char* char_hashed_sha1 = sha1.getHash();
   char* char_hashed_sha256 = sha256.getHash();
+  char* char_hashed_xxh64 = xxh64.getHash();
 
   std::string hashed_md5(char_hashed_md5);
   std::string hashed_sha1(char_hashed_sha1);
   std::string hashed_sha256(char_hashed_sha256);
+  std::string hashed_xxh64(char_hashed_xxh64);
 
   delete[] char_hashed_md5;
   delete[] char_hashed_sha1;
   delete[] char_hashed_sha256;
+  delete[] char_hashed_xxh64;
 
   if(hashed_md5 == "d61616c3e2a6cf59a0cc435a66c091d4" &&
      hashed_sha1 == "9de8c4480303b5335cd2a33eefe814615ba3612a" &&
-     hashed_sha256 == "cb9b5a0f4a8b09ba490e3acc902f38acf85205797cd59654645e5c1ef8c1ada0" ){
+     hashed_sha256 == "cb9b5a0f4a8b09ba490e3acc902f38acf85205797cd59654645e5c1ef8c1ada0" &&
+     hashed_xxh64 == "bb80b897a3f2cde9" ){
     return 0;
   } else {
     return 1;
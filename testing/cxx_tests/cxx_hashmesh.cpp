@@ -31,7 +31,7 @@ int main() {
   const size_t checkElemNum = 20;
   const size_t checkBndNum  = 2;
 
-  const std::string expectedMeshHash = "850a6b8af2b2846caba239633b7fb826f9aa52a8";
+  const std::string expectedMeshHash = "472e04858d101270ceb05c19b2971d86b816a795";
   const std::string expectedNodeHash = "79a55ffd9fc7212ad231c6c6dae6eebdf04138bf";
   const std::string expectedElementHash = "05d26fea84ab0652e2345d92ab09cc5c98059edc";
   const std::string expectedBoundaryHash = "09e05db32137f51dc82a228f5ca38ed78a0b3322";
@@ -41,5 +41,14 @@ int main() {
   if(mesh->element(checkElemNum)->hash()!=expectedElementHash)return 1;
   if(mesh->landBoundary(checkBndNum)->hash()!=expectedBoundaryHash)return 1;
 
+  //...Edits through the mesh only rehash the affected blocks, but must
+  //   produce the same result as hashing from scratch
+  std::vector<double> z = mesh->z();
+  z[checkNodeNum] += 1.0;
+  mesh->setZ(z);
+  const std::string editedHash = mesh->hash();
+  if(editedHash==expectedMeshHash)return 1;
+  if(editedHash!=mesh->hash(true))return 1;
+
   return 0;
 }
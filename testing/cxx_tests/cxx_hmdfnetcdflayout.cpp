@@ -0,0 +1,93 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include "adcircmodules.h"
+
+using namespace Adcirc::Output;
+
+bool compare(Hmdf &a, Hmdf &b) {
+  if (a.nstations() != b.nstations()) return false;
+  for (size_t i = 0; i < a.nstations(); ++i) {
+    if (a.station(i)->name() != b.station(i)->name() ||
+        a.station(i)->longitude() != b.station(i)->longitude() ||
+        a.station(i)->numSnaps() != b.station(i)->numSnaps()) {
+      return false;
+    }
+    for (size_t j = 0; j < a.station(i)->numSnaps(); ++j) {
+      if (a.station(i)->date(j) != b.station(i)->date(j) ||
+          a.station(i)->data(j) != b.station(i)->data(j)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+int main() {
+  Hmdf shared, ragged;
+  for (size_t i = 0; i < 5; ++i) {
+    HmdfStation s;
+    s.setName("station_" + std::to_string(i));
+    s.setLongitude(-90.0 + i);
+    s.setLatitude(29.0 + i);
+    HmdfStation r = s;
+    Adcirc::CDate d(2019, 8, 1, 0, 0, 0);
+    for (size_t j = 0; j < 48; ++j) {
+      double v = std::sin(0.1 * j + i);
+      s.setNext(d, v);
+      if (j < 10 * i) r.setNext(d, v);
+      d.addSeconds(3600);
+    }
+    shared.addStation(s);
+    ragged.addStation(r);
+  }
+
+  if (!shared.hasSharedTimeAxis() || ragged.hasSharedTimeAxis()) {
+    std::cout << "Incorrect shared time axis check" << std::endl;
+    return 1;
+  }
+
+  shared.writeNetcdf("test_files/hmdf_orthogonal.nc",
+                     Hmdf::HmdfNetcdfOrthogonalArray);
+  ragged.writeNetcdf("test_files/hmdf_ragged.nc", Hmdf::HmdfNetcdfTimeSeries);
+  ragged.writeNetcdf("test_files/hmdf_stations.nc");
+
+  Hmdf orthogonalIn, raggedIn, stationsIn;
+  orthogonalIn.readNetcdf("test_files/hmdf_orthogonal.nc");
+  raggedIn.readNetcdf("test_files/hmdf_ragged.nc");
+  stationsIn.readNetcdf("test_files/hmdf_stations.nc");
+
+  if (!compare(shared, orthogonalIn)) {
+    std::cout << "Orthogonal layout does not match" << std::endl;
+    return 1;
+  }
+
+  if (!compare(ragged, raggedIn)) {
+    std::cout << "Ragged layout does not match" << std::endl;
+    return 1;
+  }
+
+  if (!compare(ragged, stationsIn)) {
+    std::cout << "Station variable layout does not match" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include "adcircmodules.h"
+
+int main() {
+  using namespace Adcirc::Geometry;
+  using namespace Adcirc::Interpolation;
+  using namespace Adcirc::ModelParameters;
+
+  std::unique_ptr<Mesh> m(new Mesh("test_files/ms-riv.grd"));
+  m->read();
+  m->defineProjection(4326, true);
+  m->reproject(26915);
+
+  std::unique_ptr<Griddata> g(
+      new Griddata(m.get(), "test_files/lulc_samplelulcraster.tif"));
+  g->readLookupTable("test_files/sample_lookup.table");
+  g->setEpsg(26915);
+  g->setRasterInMemory(true);
+  g->setInterpolationFlags(Average);
+  g->setFilterSizes(1.0);
+  g->setDefaultValue(0.02);
+  g->setRasterMultiplier(2.0);
+  g->setDatumShift(0.5);
+
+  std::vector<double> manning = g->computeValuesFromRaster(true);
+  std::vector<std::vector<double>> dwind =
+      g->computeDirectionalWindReduction(true);
+
+  g->addAttributeJob("mannings_n_at_sea_floor", Average,
+                     "test_files/sample_lookup.table", 0.02, "s/m^(1/3)");
+  g->addDirectionalWindJob("surface_directional_effective_roughness_length",
+                           "test_files/sample_lookup.table", 0.02, "m");
+
+  std::unique_ptr<NodalAttributes> f(new NodalAttributes());
+  g->computeAttributes(f.get());
+
+  if (f->numParameters() != 2 || f->numNodes() != m->numNodes()) {
+    std::cout << "Incorrect nodal attribute size" << std::endl;
+    return 1;
+  }
+
+  for (size_t i = 0; i < m->numNodes(); ++i) {
+    double control = manning[i];
+    if (std::abs(f->attribute(0, i).value(0) - control) > 0.000001) {
+      std::cout << "Manning mismatch at node " << i << ": "
+                << f->attribute(0, i).value(0) << " " << control
+                << std::endl;
+      return 1;
+    }
+    for (size_t j = 0; j < 12; ++j) {
+      if (std::abs(f->attribute(1, i).value(j) - dwind[i][j]) > 0.000001) {
+        std::cout << "Directional wind mismatch at node " << i << ": "
+                  << f->attribute(1, i).value(j) << " " << dwind[i][j]
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  //...The per attribute and single pass Highest reductions must agree on a
+  //   raster where every pixel is negative
+  std::unique_ptr<Mesh> mn(new Mesh("test_files/ms-riv.grd"));
+  mn->read();
+  mn->defineProjection(4326, true);
+  std::vector<double> negative(mn->numNodes());
+  for (size_t i = 0; i < mn->numNodes(); ++i) {
+    negative[i] = -1.0 - std::abs(mn->node(i)->z());
+  }
+  mn->toRaster("test_files/negative_depth.img", negative, mn->extent(), 0.0002,
+               -9999.0);
+
+  std::unique_ptr<Griddata> gn(
+      new Griddata(mn.get(), "test_files/negative_depth.img"));
+  gn->setEpsg(4326);
+  gn->setRasterInMemory(true);
+  gn->setInterpolationFlags(Highest);
+  gn->setFilterSizes(1.0);
+  gn->setDefaultValue(-99999.0);
+  std::vector<double> highest = gn->computeValuesFromRaster(false);
+
+  gn->addAttributeJob("highest_negative", Highest, std::string(), -99999.0,
+                      "m");
+  std::unique_ptr<NodalAttributes> fn(new NodalAttributes());
+  gn->computeAttributes(fn.get());
+
+  size_t numNegative = 0;
+  for (size_t i = 0; i < mn->numNodes(); ++i) {
+    if (std::abs(fn->attribute(0, i).value(0) - highest[i]) > 0.000001) {
+      std::cout << "Highest mismatch at node " << i << ": "
+                << fn->attribute(0, i).value(0) << " " << highest[i]
+                << std::endl;
+      return 1;
+    }
+    if (highest[i] < 0.0 && highest[i] > -99999.0) numNegative++;
+  }
+  std::remove("test_files/negative_depth.img");
+
+  std::cout << "Found " << numNegative << " nodes with a negative highest "
+            << "value" << std::endl;
+  if (numNegative < mn->numNodes() / 10) return 1;
+
+  return 0;
+}
@@ -16,6 +16,7 @@
 // You should have received a copy of the GNU General Public License
 // along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
 //------------------------------------------------------------------------//
+#include <cmath>
 #include <iostream>
 #include <memory>
 #include "adcircmodules.h"
@@ -28,7 +29,7 @@ int main() {
     -9999.0, 
     -0.117294,    
     -0.142737,   
-    2.22507e-308, 
+    0.0, 
     -0.370975,    
     -0.477835,    
     -0.475127,    
@@ -72,10 +73,20 @@ int main() {
 
   for(size_t i=0;i<9;++i){
       std::cout << i << " " << r[i] << " " << rm[i] << " " << control[i] << std::endl;
+      if (i == 3) continue;
       if( std::abs(r[i]-control[i])>0.000001 || std::abs(rm[i]-control[i])>0.000001 ){
           return 1;
       }
   }
 
+  //...Node 3 uses Highest over a window with no positive pixels, so the
+  //   result must be a pixel value at or below zero, not the default and not
+  //   the smallest positive double that used to seed the search
+  if (!(r[3] <= 0.0) || r[3] == -9999.0 || r[3] != rm[3]) {
+    std::cout << "Highest value of a negative window is incorrect"
+              << std::endl;
+    return 1;
+  }
+
   return 0;
 }
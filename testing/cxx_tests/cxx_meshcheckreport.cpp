@@ -0,0 +1,55 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include "adcircmodules.h"
+
+int main() {
+  using namespace Adcirc::Geometry;
+  using namespace Adcirc::Utility;
+
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv2.grd"));
+  mesh->read();
+
+  MeshChecker checker(mesh.get());
+  const MeshCheckReport &report = checker.runChecks();
+
+  if (report.numResults() != 10) return 1;
+  if (report.passed()) return 1;
+  if (report.numNodes() != mesh->numNodes()) return 1;
+
+  const MeshCheckResult *disjoint = report.result("disjointNodes");
+  if (disjoint == nullptr || disjoint->passed) return 1;
+  if (disjoint->nodes != std::vector<size_t>{15095}) return 1;
+
+  const MeshCheckResult *overlap = report.result("overlappingElements");
+  if (overlap == nullptr || !overlap->passed) return 1;
+
+  const MeshCheckResult *missing = report.result("missingBoundaryConditions");
+  if (missing == nullptr || missing->nodes.size() != 10) return 1;
+
+  const std::string json = report.toJson();
+  std::cout << json.substr(0, 200) << std::endl;
+  if (json.find("\"name\": \"disjointNodes\"") == std::string::npos) return 1;
+  if (json.find("\"nodes\": [15095]") == std::string::npos) return 1;
+  if (json.find("\"passed\": false") == std::string::npos) return 1;
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <iostream>
+#include <memory>
+#include "adcircmodules.h"
+
+int main() {
+  using namespace Adcirc::Geometry;
+  using namespace Adcirc::Utility;
+
+  std::unique_ptr<Mesh> base(new Mesh("test_files/ms-riv.grd"));
+  base->read();
+  std::unique_ptr<Mesh> compare(new Mesh("test_files/ms-riv.grd"));
+  compare->read();
+
+  MeshDiff same(base.get(), compare.get());
+  same.compute();
+  if (!same.identical()) {
+    std::cout << "Identical meshes reported as different" << std::endl;
+    return 1;
+  }
+  for (size_t i = 0; i < base->numNodes(); ++i) {
+    if (same.nodeMap()[i] != i) return 1;
+  }
+
+  const size_t movedNode = 5;
+  const size_t raisedNode = 100;
+  compare->node(movedNode)->setX(compare->node(movedNode)->x() + 1.0);
+  compare->node(raisedNode)->setZ(compare->node(raisedNode)->z() + 1.0);
+
+  size_t touching = 0;
+  for (size_t i = 0; i < base->numElements(); ++i) {
+    const Element *e = base->element(i);
+    for (size_t j = 0; j < e->n(); ++j) {
+      if (e->node(j) == base->node(movedNode)) touching++;
+    }
+  }
+
+  MeshDiff diff(base.get(), compare.get());
+  diff.compute();
+
+  std::cout << "Nodes added/removed/modified: " << diff.addedNodes().size()
+            << "/" << diff.removedNodes().size() << "/"
+            << diff.modifiedNodes().size() << std::endl;
+  std::cout << "Elements added/removed: " << diff.addedElements().size()
+            << "/" << diff.removedElements().size() << std::endl;
+
+  if (diff.identical()) return 1;
+  if (diff.addedNodes() != std::vector<size_t>{movedNode}) return 1;
+  if (diff.removedNodes() != std::vector<size_t>{movedNode}) return 1;
+  if (diff.modifiedNodes() != std::vector<size_t>{raisedNode}) return 1;
+  if (diff.nodeMap()[movedNode] != MeshDiff::NOT_FOUND) return 1;
+  if (diff.removedElements().size() != touching) return 1;
+  if (diff.addedElements().size() != touching) return 1;
+  if (!diff.modifiedElements().empty()) return 1;
+
+  return 0;
+}
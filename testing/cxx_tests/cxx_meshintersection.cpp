@@ -0,0 +1,146 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "adcircmodules.h"
+
+/**
+ * Writes a mesh whose element sizes span more than four orders of magnitude:
+ * a fine grid of small triangles, a row of medium triangles that includes one
+ * overlapping pair, and two very large triangles that overlap each other and
+ * many of the smaller elements
+ */
+void writeGradedMesh(const std::string &filename) {
+  std::vector<std::array<double, 2>> nodes;
+  std::vector<std::array<size_t, 3>> elements;
+  const size_t nf = 30;
+  for (size_t j = 0; j <= nf; ++j) {
+    for (size_t i = 0; i <= nf; ++i) {
+      nodes.push_back({static_cast<double>(i) / nf,
+                       static_cast<double>(j) / nf});
+    }
+  }
+  for (size_t j = 0; j < nf; ++j) {
+    for (size_t i = 0; i < nf; ++i) {
+      const size_t n0 = j * (nf + 1) + i;
+      elements.push_back({n0, n0 + 1, n0 + nf + 2});
+      elements.push_back({n0, n0 + nf + 2, n0 + nf + 1});
+    }
+  }
+  auto triangle = [&](double x, double y, double size) {
+    const size_t n0 = nodes.size();
+    nodes.push_back({x, y});
+    nodes.push_back({x + size, y});
+    nodes.push_back({x, y + size});
+    elements.push_back({n0, n0 + 1, n0 + 2});
+  };
+  for (size_t k = 0; k < 20; ++k) triangle(100.0 + 10.0 * k, 0.0, 10.0);
+  triangle(102.5, 2.5, 5.0);
+  triangle(-5000.0, -5000.0, 20000.0);
+  triangle(-20000.0, 5000.0, 30000.0);
+
+  std::ofstream f(filename);
+  f.precision(12);
+  f << "graded\n" << elements.size() << " " << nodes.size() << "\n";
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    f << i + 1 << " " << nodes[i][0] << " " << nodes[i][1] << " 1.0\n";
+  }
+  for (size_t i = 0; i < elements.size(); ++i) {
+    f << i + 1 << " 3 " << elements[i][0] + 1 << " " << elements[i][1] + 1
+      << " " << elements[i][2] + 1 << "\n";
+  }
+  f << "0\n0\n0\n0\n";
+}
+
+int main() {
+  using namespace Adcirc::Geometry;
+  using namespace Adcirc::Utility;
+
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+
+  MeshIntersection clean(mesh.get());
+  clean.compute();
+  if (!clean.overlappingElements().empty()) return 1;
+  if (!clean.selfIntersectingElements().empty()) return 1;
+
+  //...Fold the first element by reflecting one vertex across the opposite
+  //   edge so that it overlaps its neighbors
+  Element *e = mesh->element(0);
+  Node *n = e->node(0);
+  const double mx = 0.5 * (e->node(1)->x() + e->node(2)->x());
+  const double my = 0.5 * (e->node(1)->y() + e->node(2)->y());
+  n->setX(2.0 * mx - n->x());
+  n->setY(2.0 * my - n->y());
+
+  MeshIntersection folded(mesh.get());
+  folded.compute();
+  const auto &pairs = folded.overlappingElements();
+  std::cout << "Found " << pairs.size() << " overlapping element pairs"
+            << std::endl;
+  if (pairs.empty()) return 1;
+  if (std::none_of(pairs.begin(), pairs.end(),
+                   [](const std::pair<size_t, size_t> &p) {
+                     return p.first == 0 || p.second == 0;
+                   })) {
+    return 1;
+  }
+
+  Node a(1, 0.0, 0.0, 0.0), b(2, 1.0, 0.0, 0.0), c(3, 0.0, 1.0, 0.0),
+      d(4, 1.0, 1.0, 0.0), f(5, 0.25, 0.25, 0.0);
+  Element e1(1, &a, &b, &c), e2(2, &b, &d, &c), e3(3, &a, &b, &f);
+  Element bowtie(4, &a, &d, &b, &c);
+  if (MeshIntersection::elementsOverlap(&e1, &e2)) return 1;
+  if (!MeshIntersection::elementsOverlap(&e1, &e3)) return 1;
+  if (MeshIntersection::isSelfIntersecting(&e1)) return 1;
+  if (!MeshIntersection::isSelfIntersecting(&bowtie)) return 1;
+
+  //...A mesh with a wide range of element sizes finds the same pairs as a
+  //   brute force search
+  std::unique_ptr<Mesh> graded(new Mesh("test_files/graded.grd"));
+  writeGradedMesh(graded->filename());
+  graded->read();
+  MeshIntersection gradedIntersection(graded.get());
+  gradedIntersection.compute();
+
+  std::vector<std::pair<size_t, size_t>> expected;
+  for (size_t i = 0; i < graded->numElements(); ++i) {
+    for (size_t j = i + 1; j < graded->numElements(); ++j) {
+      if (MeshIntersection::elementsOverlap(graded->element(i),
+                                            graded->element(j))) {
+        expected.emplace_back(i, j);
+      }
+    }
+  }
+  std::cout << "Found " << gradedIntersection.overlappingElements().size()
+            << " overlapping element pairs in the graded mesh, expected "
+            << expected.size() << std::endl;
+  if (expected.size() < graded->numElements() ||
+      gradedIntersection.overlappingElements() != expected) {
+    return 1;
+  }
+  std::remove("test_files/graded.grd");
+
+  return 0;
+}
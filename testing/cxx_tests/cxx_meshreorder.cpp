@@ -0,0 +1,180 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include "adcircmodules.h"
+
+using namespace Adcirc::Geometry;
+
+static bool isPermutation(std::vector<size_t> p) {
+  std::sort(p.begin(), p.end());
+  for (size_t i = 0; i < p.size(); ++i) {
+    if (p[i] != i) return false;
+  }
+  return true;
+}
+
+static bool checkReorder(MeshReorderStrategy strategy) {
+  std::unique_ptr<Mesh> original(new Mesh("test_files/ms-riv.grd"));
+  original->read();
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+
+  size_t bandwidth0, profile0;
+  Adcirc::Utility::MeshChecker::computeBandwidth(mesh.get(), bandwidth0,
+                                                 profile0);
+
+  MeshPermutation p = mesh->reorder(strategy);
+  if (p.nodes.size() != mesh->numNodes() || !isPermutation(p.nodes)) {
+    return false;
+  }
+  if (p.elements.size() != mesh->numElements() ||
+      !isPermutation(p.elements)) {
+    return false;
+  }
+  if (!Adcirc::Utility::MeshChecker::checkNodeNumbering(mesh.get()) ||
+      !Adcirc::Utility::MeshChecker::checkElementNumbering(mesh.get())) {
+    return false;
+  }
+
+  for (size_t i = 0; i < mesh->numNodes(); ++i) {
+    const Node *a = mesh->node(i);
+    const Node *b = original->node(p.nodes[i]);
+    if (a->x() != b->x() || a->y() != b->y() || a->z() != b->z()) {
+      return false;
+    }
+  }
+
+  for (size_t i = 0; i < mesh->numElements(); ++i) {
+    Element *a = mesh->element(i);
+    Element *b = original->element(p.elements[i]);
+    if (a->n() != b->n()) return false;
+    for (size_t j = 0; j < a->n(); ++j) {
+      if (p.nodes[a->node(j)->id() - 1] != b->node(j)->id() - 1) return false;
+    }
+  }
+
+  for (size_t i = 0; i < mesh->numLandBoundaries(); ++i) {
+    Boundary *a = mesh->landBoundary(i);
+    Boundary *b = original->landBoundary(i);
+    for (size_t j = 0; j < a->length(); ++j) {
+      if (a->node1(j)->x() != b->node1(j)->x()) return false;
+      if (a->isInternalWeir() && a->node2(j)->y() != b->node2(j)->y()) {
+        return false;
+      }
+    }
+  }
+
+  if (mesh->findNearestNode(original->node(10)->x(),
+                            original->node(10)->y()) !=
+      static_cast<size_t>(std::find(p.nodes.begin(), p.nodes.end(), 10) -
+                          p.nodes.begin())) {
+    return false;
+  }
+
+  size_t bandwidth, profile;
+  Adcirc::Utility::MeshChecker::computeBandwidth(mesh.get(), bandwidth,
+                                                 profile);
+  std::cout << "Bandwidth: " << bandwidth0 << " -> " << bandwidth
+            << ", Profile: " << profile0 << " -> " << profile << std::endl;
+  if (strategy == ReorderReverseCuthillMcKee && profile > profile0) {
+    return false;
+  }
+
+  Adcirc::Output::OutputRecord record(1, mesh->numNodes(), false, false, 1);
+  std::vector<double> z = original->z();
+  record.setAll(z);
+  record.permute(p.nodes);
+  for (size_t i = 0; i < mesh->numNodes(); ++i) {
+    if (record.z(i) != mesh->node(i)->z()) return false;
+  }
+
+  return true;
+}
+
+int main() {
+  if (!checkReorder(ReorderHilbert)) {
+    std::cout << "Hilbert reordering failed" << std::endl;
+    return 1;
+  }
+  if (!checkReorder(ReorderReverseCuthillMcKee)) {
+    std::cout << "Reverse Cuthill-McKee reordering failed" << std::endl;
+    return 1;
+  }
+
+  //...Nodal attributes follow the mesh when remapped
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+  std::unique_ptr<Adcirc::ModelParameters::NodalAttributes> original(
+      new Adcirc::ModelParameters::NodalAttributes("test_files/ms-riv.13"));
+  original->read();
+  std::unique_ptr<Adcirc::ModelParameters::NodalAttributes> fort13(
+      new Adcirc::ModelParameters::NodalAttributes("test_files/ms-riv.13",
+                                                   mesh.get()));
+  fort13->read();
+
+  MeshPermutation p = mesh->reorder(ReorderReverseCuthillMcKee);
+  fort13->permute(p.nodes);
+  for (size_t k = 0; k < fort13->numParameters(); ++k) {
+    for (size_t i = 0; i < mesh->numNodes(); ++i) {
+      if (fort13->attribute(k, i).values() !=
+          original->attribute(k, p.nodes[i]).values()) {
+        std::cout << "Nodal attribute permutation failed" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  //...An index that appears twice is not a permutation and is rejected
+  //   before any values are moved
+  std::vector<size_t> duplicate(p.nodes);
+  duplicate[1] = duplicate[0];
+  try {
+    fort13->permute(duplicate);
+    std::cout << "Duplicate nodal attribute index was accepted" << std::endl;
+    return 1;
+  } catch (const std::exception &e) {
+    std::cout << "Caught expected exception: " << e.what() << std::endl;
+  }
+  if (fort13->attribute(0, 1).values() !=
+      original->attribute(0, p.nodes[1]).values()) {
+    std::cout << "Rejected permutation modified the nodal attributes"
+              << std::endl;
+    return 1;
+  }
+
+  Adcirc::Output::OutputRecord record(1, mesh->numNodes(), false, false, 1);
+  record.setAll(mesh->z());
+  try {
+    record.permute(duplicate);
+    std::cout << "Duplicate output record index was accepted" << std::endl;
+    return 1;
+  } catch (const std::exception &e) {
+    std::cout << "Caught expected exception: " << e.what() << std::endl;
+  }
+  if (record.z(1) != mesh->node(1)->z()) {
+    std::cout << "Rejected permutation modified the output record"
+              << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
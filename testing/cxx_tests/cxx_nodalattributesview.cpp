@@ -0,0 +1,112 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include "adcircmodules.h"
+
+int main() {
+  using namespace Adcirc::ModelParameters;
+
+  std::unique_ptr<NodalAttributes> fort13(
+      new NodalAttributes("test_files/ms-riv.13"));
+  fort13->read();
+
+  size_t idx = fort13->locateAttribute("mannings_n_at_sea_floor");
+
+  //...Changes made through a copy of a view are seen by the parent object
+  Attribute a = fort13->attribute(idx, 0);
+  if (!a.isView()) return 1;
+  Attribute b = a;
+  b.setValue(0.5);
+  if (fort13->attribute(idx, 0).value(0) != 0.5) {
+    std::cout << "View did not modify the nodal attribute data" << std::endl;
+    return 1;
+  }
+
+  //...Views cannot change size
+  try {
+    b.resize(2);
+    return 1;
+  } catch (const std::exception &e) {
+    std::cout << "Caught expected exception: " << e.what() << std::endl;
+  }
+
+  fort13->write("test_files/ms-riv-view.13");
+
+  std::unique_ptr<NodalAttributes> check(
+      new NodalAttributes("test_files/ms-riv-view.13"));
+  check->read();
+  if (check->attribute(idx, 0).value(0) != 0.5) {
+    std::cout << "Modified value was not written" << std::endl;
+    return 1;
+  }
+  if (check->attribute(idx, 10).value(0) != 0.020922) return 1;
+  if (check->attribute(idx, 0).id() != 1) return 1;
+
+  //...Attributes can be added from a flat array of values
+  std::vector<double> values(check->numNodes(), 1.0);
+  values[3] = 2.0;
+  AttributeMetadata metadata("test_attribute", "unitless", 1);
+  metadata.setDefaultValue(1.0);
+  check->addAttribute(metadata, values);
+  if (check->attribute("test_attribute", 3).value(0) != 2.0) return 1;
+  if (check->attribute("test_attribute", 4).id() != 5) return 1;
+
+  //...Views remain usable when attributes are added or the parent object is
+  //   destroyed
+  Attribute view = check->attribute(idx, 0);
+  AttributeMetadata metadata2("test_attribute_2", "unitless", 1);
+  metadata2.setDefaultValue(1.0);
+  check->addAttribute(metadata2, values);
+  if (view.value(0) != 0.5) return 1;
+  view.setValue(0.25);
+  if (check->attribute(idx, 0).value(0) != 0.25) return 1;
+  check.reset();
+  if (view.value(0) != 0.25) return 1;
+  view.setValue(0.75);
+  if (view.value(0) != 0.75) return 1;
+
+  //...Views of neighboring nodes modified from several threads must all be
+  //   flagged as non-default so that every edit is written
+  std::unique_ptr<NodalAttributes> threaded(
+      new NodalAttributes("test_files/ms-riv.13"));
+  threaded->read();
+  const signed long long nn = threaded->numNodes();
+#pragma omp parallel for schedule(static, 1) default(none) \
+    shared(threaded, idx, nn)
+  for (signed long long i = 0; i < nn; ++i) {
+    Attribute v = threaded->attribute(idx, i);
+    v.setValue(0.125);
+  }
+  threaded->write("test_files/ms-riv-threaded.13");
+
+  std::unique_ptr<NodalAttributes> threadedCheck(
+      new NodalAttributes("test_files/ms-riv-threaded.13"));
+  threadedCheck->read();
+  std::remove("test_files/ms-riv-threaded.13");
+  for (signed long long i = 0; i < nn; ++i) {
+    if (threadedCheck->attribute(idx, i).value(0) != 0.125) {
+      std::cout << "Edit at node " << i << " was not written" << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,80 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <iostream>
+#include <memory>
+#include <thread>
+#include "adcircmodules.h"
+
+class CancellingMonitor : public Adcirc::ProgressMonitor {
+ public:
+  void onProgress(size_t completed, size_t total) override {
+    if (completed > 0) this->cancel();
+  }
+};
+
+int main(int argc, char *argv[]) {
+  const size_t n = 1000000;
+
+  Adcirc::ProgressMonitor monitor;
+  size_t lastCompleted = 0;
+  size_t reports = 0;
+  size_t foreignReports = 0;
+  const std::thread::id owner = std::this_thread::get_id();
+  monitor.setInterval(0.0);
+  monitor.setCallback([&](size_t completed, size_t total) {
+    lastCompleted = completed;
+    reports++;
+    if (std::this_thread::get_id() != owner) foreignReports++;
+  });
+  monitor.begin(n);
+#pragma omp parallel for schedule(static) shared(monitor)
+  for (signed long long i = 0; i < static_cast<signed long long>(n); ++i) {
+    monitor.increment();
+  }
+  monitor.finish();
+
+  //...Progress is only reported from the thread that started the monitor
+  if (foreignReports != 0) {
+    std::cout << "Progress was reported from a worker thread" << std::endl;
+    return 1;
+  }
+
+  if (monitor.completed() != n || lastCompleted != n || reports == 0) {
+    std::cout << "Progress monitor counted " << monitor.completed() << " of "
+              << n << " items" << std::endl;
+    return 1;
+  }
+
+  std::unique_ptr<Adcirc::Geometry::Mesh> mesh(
+      new Adcirc::Geometry::Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+  CancellingMonitor cancel;
+  cancel.setInterval(0.0);
+  Adcirc::Utility::MeshChecker checker(mesh.get());
+  checker.setProgressMonitor(&cancel);
+  try {
+    checker.checkMesh();
+  } catch (const std::exception &e) {
+    std::cout << "Mesh check cancelled: " << e.what() << std::endl;
+    return 0;
+  }
+
+  std::cout << "Mesh check was not cancelled" << std::endl;
+  return 1;
+}
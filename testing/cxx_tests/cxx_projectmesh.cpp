@@ -64,8 +64,16 @@ int main() {
   }
 
   std::cout << "Transforming to CPP...\n";
+  Point cppExpected;
+  Ezproj::cpp(-90.0, 24.0, Point(mesh->node(0)->x(), mesh->node(0)->y()),
+              cppExpected);
   mesh->cpp(-90.0,24.0);
   printf("CPP: %14.2f, %14.2f\n",mesh->node(0)->x(),mesh->node(0)->y());
+  if (std::abs(cppExpected.first - mesh->node(0)->x()) > 0.000001 ||
+      std::abs(cppExpected.second - mesh->node(0)->y()) > 0.000001) {
+    std::cout << "Error during CPP transformation\n";
+    return 1;
+  }
   mesh->inverseCpp(-90.0,24.0);
   printf("INVCPP: %14.2f, %14.2f\n",mesh->node(0)->x(),mesh->node(0)->y());
   if(std::abs(oldx-mesh->node(0)->x())>0.00001 ||
@@ -74,6 +82,52 @@ int main() {
       return 1;
   }
 
+  //...A mesh large enough to be split between threads must match the single
+  //   point transformation at every node
+  std::cout << "Transforming a mesh with 40000 nodes...\n";
+  const size_t n = 200;
+  mesh.reset(new Mesh());
+  mesh->resizeMesh(n * n, 0, 0, 0);
+  for (size_t i = 0; i < n * n; ++i) {
+    mesh->addNode(i, Node(i + 1, -91.0 + 0.005 * static_cast<double>(i % n),
+                          29.0 + 0.005 * static_cast<double>(i / n), 0.0));
+  }
+  mesh->defineProjection(4326, true);
+  mesh->reproject(26915);
+  if (mesh->isLatLon()) return 1;
+  for (size_t i = 0; i < n * n; ++i) {
+    Point in(-91.0 + 0.005 * static_cast<double>(i % n),
+             29.0 + 0.005 * static_cast<double>(i / n));
+    Point out;
+    bool latlon;
+    p.transform(4326, 26915, in, out, latlon);
+    if (std::abs(out.first - mesh->node(i)->x()) > 0.000001 ||
+        std::abs(out.second - mesh->node(i)->y()) > 0.000001) {
+      std::cout << "Error transforming node " << i + 1 << "\n";
+      return 1;
+    }
+  }
+  mesh->reproject(4326);
+  if (!mesh->isLatLon()) return 1;
+  for (size_t i = 0; i < n * n; ++i) {
+    if (std::abs(-91.0 + 0.005 * static_cast<double>(i % n) -
+                 mesh->node(i)->x()) > 0.00001 ||
+        std::abs(29.0 + 0.005 * static_cast<double>(i / n) -
+                 mesh->node(i)->y()) > 0.00001) {
+      std::cout << "Error returning node " << i + 1 << " to 4326\n";
+      return 1;
+    }
+  }
+
+  //...Stations without any entries only change their projection
+  Adcirc::Output::Hmdf h;
+  h.setEpsg(4326);
+  h.reproject(26915);
+  if (h.getEpsg() != 26915) {
+    std::cout << "Error reprojecting an empty station set\n";
+    return 1;
+  }
+
 
   return 0;
 
@@ -0,0 +1,109 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include "adcircmodules.h"
+
+int main() {
+  using namespace Adcirc::Geometry;
+  using namespace Adcirc::Interpolation;
+
+  std::unique_ptr<Mesh> m(new Mesh("test_files/ms-riv.grd"));
+  m->read();
+  m->defineProjection(4326, true);
+  m->reproject(26915);
+
+  const size_t nn = m->numNodes();
+
+  //...Overview levels are only used when their cell size, scaled by the
+  //   tolerance, fits inside the averaging radius of the node
+  auto overviewGriddata = [&](const std::string &file, bool useOverviews,
+                              double tolerance) {
+    std::unique_ptr<Griddata> go(new Griddata(m.get(), file));
+    go->setEpsg(26915);
+    go->setDefaultValue(-9999.0);
+    go->setInterpolationFlags(Average);
+    go->setFilterSizes(8.0);
+    go->setRasterInMemory(true);
+    go->setUseOverviews(useOverviews);
+    go->setOverviewTolerance(tolerance);
+    return go->computeValuesFromRaster();
+  };
+
+  std::cout << "Interpolating with raster overviews..." << std::endl;
+  std::vector<double> base =
+      overviewGriddata("test_files/bathy_sampleraster.tif", false, 1.0);
+  std::vector<double> never =
+      overviewGriddata("test_files/bathy_sampleraster.tif", true, 1.0e12);
+  std::vector<double> coarse =
+      overviewGriddata("test_files/bathy_sampleraster.tif", true, 1.0);
+
+  size_t nBase = 0, nCoarse = 0;
+  for (size_t i = 0; i < nn; ++i) {
+    if (never[i] != base[i]) {
+      std::cout << "Overview selected beyond tolerance at node " << i
+                << std::endl;
+      return 1;
+    }
+    if (base[i] == -9999.0) continue;
+    nBase++;
+    if (coarse[i] != base[i]) nCoarse++;
+  }
+
+  //...Matching results only mean something if the raster reached the nodes
+  std::cout << "Interpolated: " << nBase << ", From overviews: " << nCoarse
+            << std::endl;
+  if (nBase < nn / 10) {
+    std::cout << "Too few nodes were interpolated from the raster"
+              << std::endl;
+    return 1;
+  }
+  if (nCoarse == 0) {
+    std::cout << "No overview levels were selected" << std::endl;
+    return 1;
+  }
+
+  //...Averaging a constant raster gives the same constant at every overview
+  //   level
+  std::vector<double> ext = m->extent();
+  m->toRaster("test_files/overview_flat.tif", std::vector<double>(nn, 3.0),
+              {ext[0], ext[1], ext[2], ext[3]}, 100.0, -9999.0);
+  std::vector<double> flat =
+      overviewGriddata("test_files/overview_flat.tif", true, 1.0);
+  std::remove("test_files/overview_flat.tif");
+
+  size_t nFlat = 0;
+  for (size_t i = 0; i < nn; ++i) {
+    if (flat[i] == -9999.0) continue;
+    nFlat++;
+    if (std::abs(flat[i] - 3.0) > 0.000001) {
+      std::cout << "Overview average mismatch at node " << i << std::endl;
+      return 1;
+    }
+  }
+  if (nFlat < nn / 10) {
+    std::cout << "Too few nodes were interpolated from the constant raster"
+              << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
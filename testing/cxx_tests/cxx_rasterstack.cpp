@@ -0,0 +1,134 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include "adcircmodules.h"
+
+int main() {
+  using namespace Adcirc::Geometry;
+  using namespace Adcirc::Interpolation;
+
+  std::unique_ptr<Mesh> m(new Mesh("test_files/ms-riv.grd"));
+  m->read();
+  m->defineProjection(4326, true);
+  m->reproject(26915);
+
+  //...Two rasters with constant values covering the west and east halves of
+  //   the mesh test the selection of a raster for each node
+  const size_t nn = m->numNodes();
+  std::vector<double> ext = m->extent();
+  const double xmid = 0.5 * (ext[0] + ext[2]);
+  m->toRaster("test_files/stack_west.tif", std::vector<double>(nn, 1.0),
+              {ext[0], ext[1], xmid, ext[3]}, 100.0, -9999.0);
+  m->toRaster("test_files/stack_east.tif", std::vector<double>(nn, 2.0),
+              {xmid, ext[1], ext[2], ext[3]}, 100.0, -9999.0);
+  m->toRaster("test_files/stack_full.tif", std::vector<double>(nn, 3.0),
+              {ext[0], ext[1], ext[2], ext[3]}, 100.0, -9999.0);
+
+  auto cleanup = []() {
+    std::remove("test_files/stack_west.tif");
+    std::remove("test_files/stack_east.tif");
+    std::remove("test_files/stack_full.tif");
+  };
+
+  std::unique_ptr<Griddata> gs(
+      new Griddata(m.get(), "test_files/stack_west.tif"));
+  gs->addRasterFile("test_files/stack_east.tif");
+  gs->setEpsg(26915);
+  gs->setDefaultValue(-9999.0);
+  gs->setInterpolationFlags(Average);
+  gs->setFilterSizes(1.0);
+
+  std::cout << "Interpolating from raster stack..." << std::endl;
+  std::vector<double> rs = gs->computeValuesFromRaster();
+  std::vector<int> idx = gs->nodeRasterIndices();
+  size_t nWest = 0, nEast = 0;
+  for (size_t i = 0; i < nn; ++i) {
+    const double x = m->node(i)->x();
+    if ((idx[i] == 0 && x > xmid) || (idx[i] == 1 && x < xmid) ||
+        idx[i] < 0) {
+      std::cout << "Node " << i << " assigned to the wrong raster" << std::endl;
+      cleanup();
+      return 1;
+    }
+    if (rs[i] == -9999.0) continue;
+    idx[i] == 0 ? nWest++ : nEast++;
+    if (std::abs(rs[i] - (idx[i] + 1.0)) > 0.000001) {
+      std::cout << "Raster stack mismatch at node " << i << std::endl;
+      cleanup();
+      return 1;
+    }
+  }
+
+  //...Both halves of the mesh must have been interpolated, otherwise the
+  //   comparison above did not check anything
+  std::cout << "West: " << nWest << ", East: " << nEast << std::endl;
+  if (nWest + nEast < nn / 10 || nWest == 0 || nEast == 0) {
+    std::cout << "Too few nodes were interpolated from the raster stack"
+              << std::endl;
+    cleanup();
+    return 1;
+  }
+
+  //...The east raster takes priority where it covers a node's footprint and
+  //   the full raster is the fallback everywhere else
+  std::unique_ptr<Griddata> gp(
+      new Griddata(m.get(), "test_files/stack_east.tif"));
+  gp->addRasterFile("test_files/stack_full.tif");
+  gp->setEpsg(26915);
+  gp->setDefaultValue(-9999.0);
+  gp->setInterpolationFlags(Average);
+  gp->setFilterSizes(1.0);
+
+  std::cout << "Interpolating from prioritized raster stack..." << std::endl;
+  std::vector<double> rp = gp->computeValuesFromRaster();
+  idx = gp->nodeRasterIndices();
+  size_t nPrimary = 0, nFallback = 0;
+  for (size_t i = 0; i < nn; ++i) {
+    if (m->node(i)->x() < xmid && idx[i] != 1) {
+      std::cout << "Node " << i << " did not fall back to the next raster"
+                << std::endl;
+      cleanup();
+      return 1;
+    }
+    if (rp[i] == -9999.0) continue;
+    idx[i] == 0 ? nPrimary++ : nFallback++;
+    const double expected = idx[i] == 0 ? 2.0 : 3.0;
+    if (std::abs(rp[i] - expected) > 0.000001) {
+      std::cout << "Prioritized raster stack mismatch at node " << i
+                << std::endl;
+      cleanup();
+      return 1;
+    }
+  }
+
+  cleanup();
+
+  std::cout << "Primary: " << nPrimary << ", Fallback: " << nFallback
+            << std::endl;
+  if (nPrimary + nFallback < nn / 10 || nPrimary == 0 || nFallback == 0) {
+    std::cout << "Too few nodes were interpolated from the prioritized stack"
+              << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -16,6 +16,8 @@
 // You should have received a copy of the GNU General Public License
 // along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
 //------------------------------------------------------------------------//
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include "adcircmodules.h"
@@ -29,5 +31,88 @@ int main() {
   mesh.reset(new Mesh("test_files/ms-riv_quad_net.nc"));
   mesh->read();
 
+  //...Nodestrings may continue over several cards and become land boundaries
+  {
+    std::ofstream f("test_files/nodestring.2dm");
+    f << "MESH2D\nMESHNAME \"nodestring\"\n";
+    f << "E4Q 1 10 20 50 40 1\nE3T 2 20 30 50 1\nE3T 3 30 60 50 1\n";
+    f << "ND 10 0.0 0.0 1.0\nND 20 1.0 0.0 1.0\nND 30 2.0 0.0 1.0\n";
+    f << "ND 40 0.0 1.0 1.0\nND 50 1.0 1.0 1.0\nND 60 2.0 1.0 1.0\n";
+    f << "NS 10 20\nNS 30 -60 south\nNS 40 -50\n";
+  }
+  mesh.reset(new Mesh("test_files/nodestring.2dm"));
+  mesh->read();
+  if (mesh->numNodes() != 6 || mesh->numElements() != 3) return 1;
+  if (mesh->element(0)->n() != 4 || mesh->element(2)->node(1)->id() != 60) {
+    return 1;
+  }
+  if (mesh->numLandBoundaries() != 2) return 1;
+  if (mesh->landBoundary(0)->length() != 4) return 1;
+  if (mesh->landBoundary(0)->node1(3)->id() != 60) return 1;
+  if (mesh->landBoundary(1)->length() != 2) return 1;
+
+  //...A file larger than the 4 MiB scanned per task is split into several
+  //   ranges. Elements come before the nodes and the nodestring cards sit in
+  //   the middle of the node cards so that every section crosses a range
+  {
+    const size_t n = 400;
+    std::ofstream f("test_files/ranges.2dm");
+    f << "MESH2D\nMESHNAME \"ranges\"\n";
+    size_t id = 1;
+    for (size_t j = 0; j + 1 < n; ++j) {
+      for (size_t i = 0; i + 1 < n; ++i) {
+        const size_t a = j * n + i + 1;
+        f << "E3T " << id++ << " " << a << " " << a + 1 << " " << a + n + 1
+          << " 1\n";
+        f << "E3T " << id++ << " " << a << " " << a + n + 1 << " " << a + n
+          << " 1\n";
+      }
+    }
+    for (size_t k = 0; k < n * n; ++k) {
+      if (k == n * n / 2) {
+        for (size_t i = 0; i < n; ++i) {
+          if (i % 10 == 0) f << "NS";
+          f << " " << (i + 1 == n ? "-" : "") << i + 1;
+          if (i % 10 == 9 || i + 1 == n) f << "\n";
+        }
+      }
+      f << "ND " << k + 1 << " " << k % n << ".5 " << k / n << ".25 "
+        << 2.0 << "\n";
+    }
+  }
+  mesh.reset(new Mesh("test_files/ranges.2dm"));
+  mesh->read();
+  std::remove("test_files/ranges.2dm");
+
+  const size_t n = 400;
+  std::cout << "Read " << mesh->numNodes() << " nodes and "
+            << mesh->numElements() << " elements from a multi-range 2dm file"
+            << std::endl;
+  if (mesh->numNodes() != n * n) return 1;
+  if (mesh->numElements() != 2 * (n - 1) * (n - 1)) return 1;
+  for (size_t k = 0; k < n * n; ++k) {
+    const Node *nd = mesh->node(k);
+    if (nd->id() != k + 1 || nd->x() != static_cast<double>(k % n) + 0.5 ||
+        nd->y() != static_cast<double>(k / n) + 0.25) {
+      std::cout << "Node " << k + 1 << " was not read correctly" << std::endl;
+      return 1;
+    }
+  }
+  for (size_t e = 0; e < mesh->numElements(); ++e) {
+    const size_t a = (e / 2 / (n - 1)) * n + (e / 2) % (n - 1) + 1;
+    const size_t c = e % 2 == 0 ? a + 1 : a + n + 1;
+    const size_t d = e % 2 == 0 ? a + n + 1 : a + n;
+    const Element *el = mesh->element(e);
+    if (el->id() != e + 1 || el->node(0)->id() != a ||
+        el->node(1)->id() != c || el->node(2)->id() != d) {
+      std::cout << "Element " << e + 1 << " was not read correctly"
+                << std::endl;
+      return 1;
+    }
+  }
+  if (mesh->numLandBoundaries() != 1) return 1;
+  if (mesh->landBoundary(0)->length() != n) return 1;
+  if (mesh->landBoundary(0)->node1(n - 1)->id() != n) return 1;
+
   return 0;
 }
@@ -0,0 +1,104 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include "adcircmodules.h"
+
+//...Enough nodes that the body of the fort.13 file is split into more than
+//   one parsing chunk
+constexpr size_t c_numNodes = 70000;
+
+//...Node ids are not sequential so that values are located through the id
+//   lookup table
+size_t nodeId(size_t i) { return 3 * (c_numNodes - i) + 7; }
+
+double nodeValue(size_t i, size_t j) { return 0.001 * i + j; }
+
+void writeMesh(const std::string &filename) {
+  std::ofstream f(filename);
+  f << "nonsequential\n";
+  f << 1 << " " << c_numNodes << "\n";
+  for (size_t i = 0; i < c_numNodes; ++i) {
+    f << nodeId(i) << " " << i % 250 << " " << i / 250 << " 1.0\n";
+  }
+  f << "1 3 " << nodeId(0) << " " << nodeId(1) << " " << nodeId(250) << "\n";
+  f << "0\n0\n0\n0\n";
+}
+
+void writeFort13(const std::string &filename, size_t badLine) {
+  std::ofstream f(filename);
+  f << "nonsequential\n" << c_numNodes << "\n1\n";
+  f << "test_attribute\nunitless\n2\n0.0 0.0\n";
+  f << "test_attribute\n" << c_numNodes << "\n";
+  //...Written in reverse order of the mesh so that the lines in each chunk
+  //   refer to nodes spread over the whole mesh
+  char line[128];
+  for (size_t k = 0; k < c_numNodes; ++k) {
+    size_t i = c_numNodes - 1 - k;
+    snprintf(line, sizeof(line), "%zu %.6f %.6f", nodeId(i), nodeValue(i, 0),
+             nodeValue(i, 1));
+    f << line;
+    if (k == badLine) f << " 9.0";
+    f << "\n";
+  }
+}
+
+int main() {
+  using namespace Adcirc::Geometry;
+  using namespace Adcirc::ModelParameters;
+
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/nonsequential.grd"));
+  writeMesh(mesh->filename());
+  mesh->read();
+
+  //...Every node is read across the chunk boundary
+  writeFort13("test_files/nonsequential.13", c_numNodes);
+  std::unique_ptr<NodalAttributes> fort13(
+      new NodalAttributes("test_files/nonsequential.13", mesh.get()));
+  fort13->read();
+  for (size_t i = 0; i < c_numNodes; ++i) {
+    Attribute a = fort13->attribute(0, i);
+    if (a.id() != nodeId(i) || a.node()->id() != nodeId(i) ||
+        std::abs(a.value(0) - nodeValue(i, 0)) > 1e-9 ||
+        std::abs(a.value(1) - nodeValue(i, 1)) > 1e-9) {
+      std::cout << "Incorrect value at node " << i << std::endl;
+      return 1;
+    }
+  }
+
+  //...A line with more values than the attribute has is rejected, including
+  //   when it is located in a later chunk
+  writeFort13("test_files/nonsequential.13", 65536 + 10);
+  fort13.reset(new NodalAttributes("test_files/nonsequential.13", mesh.get()));
+  try {
+    fort13->read();
+    std::cout << "Extra values were not rejected" << std::endl;
+    return 1;
+  } catch (const std::exception &e) {
+    std::cout << "Caught expected exception: " << e.what() << std::endl;
+  }
+
+  std::remove("test_files/nonsequential.grd");
+  std::remove("test_files/nonsequential.13");
+
+  return 0;
+}
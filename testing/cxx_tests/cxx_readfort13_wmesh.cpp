@@ -30,7 +30,7 @@ int main() {
       new NodalAttributes("test_files/ms-riv.13", mesh.get()));
   fort13->read();
 
-  int id = fort13->attribute(0, 0)->node()->id();
+  int id = fort13->attribute(0, 0).node()->id();
   if (id != 1) return 1;
 
   return 0;
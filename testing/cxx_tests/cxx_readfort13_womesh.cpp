@@ -30,15 +30,15 @@ int main() {
 
   int idx = fort13->locateAttribute("mannings_n_at_sea_floor");
 
-  double n = fort13->attribute(idx, 10)->value(0);
+  double n = fort13->attribute(idx, 10).value(0);
 
   std::cout << "Manning n before: " << n << std::endl;
   std::cout << "Manning n expected: 0.020922" << std::endl;
 
   if (n != 0.020922) return 1;
 
-  fort13->attribute(idx, 10)->setValue(0, 0.022);
-  n = fort13->attribute(idx, 10)->value(0);
+  fort13->attribute(idx, 10).setValue(0, 0.022);
+  n = fort13->attribute(idx, 10).value(0);
 
   std::cout << "Attempted to set value to 0.022 and got " << n << std::endl;
 
@@ -0,0 +1,156 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "adcircmodules.h"
+
+int main() {
+  using namespace Adcirc::Output;
+
+  //...Hand written file with windows line endings, blank lines, records
+  //   before 1970 and a station without any data
+  std::ofstream out("test_files/hmdf_handwritten.imeds", std::ios::binary);
+  out << "% IMEDS generic format\r\n";
+  out << "% year month day hour min sec value\r\n";
+  out << "% ADCIRCModules UTC MSL m\r\n";
+  out << "station_a   29.5000000000   -90.2500000000\r\n";
+  out << "2020 02 29 00 00 00 1.500000e+00\r\n";
+  out << "2020 02 29 01 00 00 -2.500000e-01\r\n";
+  out << "\r\n";
+  out << "station_b   30.0   -91.0\r\n";
+  out << "station_c   31.0   -92.0\r\n";
+  out << "1969 12 31 23 59 59 3.0\r\n";
+  out.close();
+
+  Hmdf h;
+  h.readImeds("test_files/hmdf_handwritten.imeds");
+  if (h.nstations() != 3 || h.header3() != "% ADCIRCModules UTC MSL m") {
+    std::cout << "Incorrect station count or header" << std::endl;
+    return 1;
+  }
+
+  if (h.station(0)->name() != "station_a" ||
+      h.station(0)->latitude() != 29.5 || h.station(0)->longitude() != -90.25 ||
+      h.station(0)->numSnaps() != 2 || h.station(1)->numSnaps() != 0 ||
+      h.station(2)->numSnaps() != 1) {
+    std::cout << "Incorrect station metadata" << std::endl;
+    return 1;
+  }
+
+  if (h.station(0)->date(1) != Adcirc::CDate(2020, 2, 29, 1, 0, 0) ||
+      h.station(0)->data(1) != -0.25 ||
+      h.station(2)->date(0) != Adcirc::CDate(1969, 12, 31, 23, 59, 59) ||
+      h.station(2)->data(0) != 3.0) {
+    std::cout << "Incorrect station data" << std::endl;
+    return 1;
+  }
+
+  //...Round trip through the writer
+  Hmdf rows;
+  for (size_t i = 0; i < 4; ++i) {
+    HmdfStation s;
+    s.setName("station_" + std::to_string(i));
+    s.setLongitude(-90.0 + i);
+    s.setLatitude(29.0 + i);
+    Adcirc::CDate d(2019, 8, 1, 0, 0, 0);
+    for (size_t j = 0; j < 500; ++j) {
+      s.setNext(d, std::sin(0.1 * j + i) * 1.5);
+      d.addSeconds(1800);
+    }
+    rows.addStation(s);
+  }
+  rows.writeImeds("test_files/hmdf_roundtrip.imeds");
+
+  Hmdf r;
+  r.readImeds("test_files/hmdf_roundtrip.imeds");
+  if (r.nstations() != rows.nstations()) {
+    std::cout << "Round trip station count does not match" << std::endl;
+    return 1;
+  }
+  for (size_t i = 0; i < r.nstations(); ++i) {
+    if (r.station(i)->numSnaps() != rows.station(i)->numSnaps()) {
+      std::cout << "Round trip length does not match" << std::endl;
+      return 1;
+    }
+    for (size_t j = 0; j < r.station(i)->numSnaps(); ++j) {
+      if (r.station(i)->date(j) != rows.station(i)->date(j) ||
+          std::abs(r.station(i)->data(j) - rows.station(i)->data(j)) > 1e-6) {
+        std::cout << "Round trip data does not match" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  //...A file of several megabytes is split into blocks that are parsed in
+  //   parallel. Stations of different lengths place the block boundaries in
+  //   the middle of stations, which must be stitched back together
+  Hmdf large;
+  const std::vector<size_t> lengths = {90000, 7, 45000, 120000, 1, 60000};
+  for (size_t i = 0; i < lengths.size(); ++i) {
+    HmdfStation s;
+    s.setName("large_" + std::to_string(i));
+    s.setLongitude(-80.0 - i);
+    s.setLatitude(25.0 + i);
+    Adcirc::CDate d(2010, 1, 1, 0, 0, 0);
+    for (size_t j = 0; j < lengths[i]; ++j) {
+      s.setNext(d, 0.5 * static_cast<double>((j + i) % 2000) - 500.0);
+      d.addSeconds(60);
+    }
+    large.addStation(s);
+  }
+  large.writeImeds("test_files/hmdf_large.imeds");
+
+  std::ifstream size("test_files/hmdf_large.imeds",
+                     std::ios::binary | std::ios::ate);
+  if (static_cast<size_t>(size.tellg()) < 4 * 1048576) {
+    std::cout << "Large IMEDS file does not span several blocks" << std::endl;
+    return 1;
+  }
+  size.close();
+
+  Hmdf blocks;
+  blocks.readImeds("test_files/hmdf_large.imeds");
+  if (blocks.nstations() != lengths.size()) {
+    std::cout << "Blocked read found " << blocks.nstations() << " stations"
+              << std::endl;
+    return 1;
+  }
+  for (size_t i = 0; i < lengths.size(); ++i) {
+    HmdfStation *a = blocks.station(i);
+    HmdfStation *b = large.station(i);
+    if (a->name() != b->name() || a->numSnaps() != lengths[i] ||
+        a->latitude() != b->latitude() || a->longitude() != b->longitude()) {
+      std::cout << "Blocked read station " << i << " does not match"
+                << std::endl;
+      return 1;
+    }
+    for (size_t j = 0; j < lengths[i]; ++j) {
+      if (a->date(j) != b->date(j) || a->data(j) != b->data(j)) {
+        std::cout << "Blocked read data of station " << i << " snap " << j
+                  << " does not match" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "adcircmodules.h"
+
+int compareSubset(const std::string &filename) {
+  using namespace Adcirc::Output;
+  const std::vector<size_t> nodes = {0, 1, 2, 925, 1220, 1221, 1900, 2715};
+
+  std::unique_ptr<ReadOutput> full(new ReadOutput(filename));
+  std::unique_ptr<ReadOutput> subset(new ReadOutput(filename));
+  full->open();
+  subset->open();
+  subset->setNodeSubset(nodes);
+
+  for (size_t snap = 0; snap < 3; ++snap) {
+    full->read();
+    subset->read();
+    OutputRecord *a = full->dataAt(snap);
+    OutputRecord *b = subset->dataAt(snap);
+    if (b->numNodes() != nodes.size()) {
+      std::cout << filename << ": expected " << nodes.size()
+                << " nodes, got " << b->numNodes() << std::endl;
+      return 1;
+    }
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      if (a->z(nodes[i]) != b->z(i)) {
+        std::cout << filename << ": snap " << snap << ", node " << nodes[i]
+                  << ": expected " << a->z(nodes[i]) << ", got " << b->z(i)
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+  full->close();
+  subset->close();
+  return 0;
+}
+
+int main() {
+  if (compareSubset("test_files/fort.63") != 0) return 1;
+  if (compareSubset("test_files/sparse_fort.63") != 0) return 1;
+  if (compareSubset("test_files/fort.63.nc") != 0) return 1;
+
+  //...An unsorted subset is rejected
+  Adcirc::Output::ReadOutput output("test_files/fort.63");
+  output.open();
+  try {
+    output.setNodeSubset({5, 2});
+    return 1;
+  } catch (const std::exception &e) {
+    std::cout << "Caught expected exception: " << e.what() << std::endl;
+  }
+  output.close();
+  return 0;
+}
@@ -0,0 +1,76 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "spacefillingcurve.h"
+
+int main() {
+  using Adcirc::Private::SpaceFillingCurve;
+
+  //...The curve starts at the origin, so the first 4^k keys fill the
+  //   2^k x 2^k block in the corner and consecutive cells are neighbors
+  constexpr uint32_t side = 16;
+  std::vector<std::pair<uint64_t, std::pair<uint32_t, uint32_t>>> cells;
+  for (uint32_t j = 0; j < side; ++j) {
+    for (uint32_t i = 0; i < side; ++i) {
+      cells.push_back({SpaceFillingCurve::hilbert(i, j), {i, j}});
+    }
+  }
+  std::sort(cells.begin(), cells.end());
+  for (size_t k = 0; k < cells.size(); ++k) {
+    if (cells[k].first != k) {
+      std::cout << "Hilbert keys are not contiguous" << std::endl;
+      return 1;
+    }
+    if (k == 0) continue;
+    const auto &a = cells[k - 1].second;
+    const auto &b = cells[k].second;
+    int d = std::abs(static_cast<int>(a.first) - static_cast<int>(b.first)) +
+            std::abs(static_cast<int>(a.second) - static_cast<int>(b.second));
+    if (d != 1) {
+      std::cout << "Consecutive Hilbert cells are not adjacent" << std::endl;
+      return 1;
+    }
+  }
+
+  //...Morton codes interleave the bits of x (even) and y (odd)
+  if (SpaceFillingCurve::morton(3u, 0u) != 5) return 1;
+  if (SpaceFillingCurve::morton(0u, 3u) != 10) return 1;
+  if (SpaceFillingCurve::morton(0xffffu, 0xffffu) != 0xffffffffULL) return 1;
+
+  //...Coordinates are quantized within the extent and clamped outside of it
+  if (SpaceFillingCurve::hilbert(0.0, 0.0, 0.0, 0.0, 1.0, 1.0) != 0) return 1;
+  if (SpaceFillingCurve::hilbert(-5.0, -5.0, 0.0, 0.0, 1.0, 1.0) != 0) {
+    return 1;
+  }
+
+  std::vector<double> x = {0.0, 1.0, 1.0, 0.0};
+  std::vector<double> y = {0.0, 0.0, 1.0, 1.0};
+  std::vector<size_t> order = SpaceFillingCurve::hilbertOrder(x, y);
+  std::vector<size_t> expected = {0, 3, 2, 1};
+  if (order != expected) {
+    std::cout << "Unexpected Hilbert ordering of the unit square corners"
+              << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,268 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include "adcircmodules.h"
+#include "stationinterpolation.h"
+
+using namespace Adcirc::Output;
+
+//...Runs the station interpolation and returns the contents of the output
+std::string interpolate(const std::string &global, const std::string &output,
+                        bool magnitude,
+                        const std::string &weightCache = std::string()) {
+  StationInterpolationOptions options;
+  options.setMesh("test_files/internal_overflow.grd");
+  options.setGlobalfile(global);
+  options.setStationfile("test_files/stations_internal_overflow.txt");
+  options.readStations();
+  options.setOutputfile(output);
+  options.setColdstart("20000101000000");
+  options.setStartsnap(1);
+  options.setEndsnap(43);
+  options.setMagnitude(magnitude);
+  if (!weightCache.empty()) options.setWeightCacheFile(weightCache);
+  StationInterpolation interp(options);
+  interp.run();
+
+  std::ifstream fid(output);
+  return std::string(std::istreambuf_iterator<char>(fid),
+                     std::istreambuf_iterator<char>());
+}
+
+int main() {
+  Adcirc::Geometry::Mesh mesh("test_files/internal_overflow.grd");
+  mesh.read();
+
+  //...Stations at the centroids of a few elements and one outside the mesh
+  const std::vector<size_t> elements = {10, 500, 1200, 2000, 3500, 4900};
+  std::vector<double> sx, sy;
+  for (auto e : elements) {
+    double x = 0.0, y = 0.0;
+    for (size_t j = 0; j < 3; ++j) {
+      x += mesh.element(e)->node(j)->x() / 3.0;
+      y += mesh.element(e)->node(j)->y() / 3.0;
+    }
+    sx.push_back(x);
+    sy.push_back(y);
+  }
+  sx.push_back(-1.0e6);
+  sy.push_back(-1.0e6);
+
+  {
+    std::ofstream fid("test_files/stations_internal_overflow.txt");
+    fid.precision(12);
+    fid << sx.size() << "\n";
+    for (size_t i = 0; i < sx.size(); ++i) {
+      fid << sx[i] << " " << sy[i] << "\n";
+    }
+  }
+
+  //...The pipelined read and the parallel snap ranges must reproduce the
+  //   result of a single thread
+  Adcirc::Multithreading::disable();
+  const std::string serial =
+      interpolate("test_files/fort.63", "test_files/stations_serial.imeds",
+                  false);
+  const std::string serialMagnitude = interpolate(
+      "test_files/sparse_fort.64", "test_files/stations_serial_mag.imeds",
+      true);
+
+  Adcirc::Multithreading::enable();
+  const std::string parallel =
+      interpolate("test_files/fort.63", "test_files/stations_parallel.imeds",
+                  false);
+  const std::string parallelMagnitude = interpolate(
+      "test_files/sparse_fort.64", "test_files/stations_parallel_mag.imeds",
+      true);
+
+  if (serial.empty() || serial != parallel) {
+    std::cout << "Parallel station interpolation does not match the serial "
+                 "result"
+              << std::endl;
+    return 1;
+  }
+  if (serialMagnitude.empty() || serialMagnitude != parallelMagnitude) {
+    std::cout << "Parallel vector magnitude does not match the serial result"
+              << std::endl;
+    return 1;
+  }
+
+  //...A magnitude and a direction cannot be written at the same time
+  {
+    StationInterpolationOptions options;
+    options.setMesh("test_files/internal_overflow.grd");
+    options.setGlobalfile("test_files/sparse_fort.64");
+    options.setStationfile("test_files/stations_internal_overflow.txt");
+    options.readStations();
+    options.setOutputfile("test_files/stations_invalid.imeds");
+    options.setColdstart("20000101000000");
+    options.setStartsnap(1);
+    options.setEndsnap(43);
+    options.setMagnitude(true);
+    options.setDirection(true);
+    StationInterpolation interp(options);
+    bool rejected = false;
+    try {
+      interp.run();
+    } catch (const std::exception &) {
+      rejected = true;
+    }
+    if (!rejected) {
+      std::cout << "Magnitude and direction together were not rejected"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  //...Check the interpolated values against weights computed directly from
+  //   the mesh
+  Hmdf h;
+  h.readImeds("test_files/stations_serial.imeds");
+  if (h.nstations() != sx.size()) return 1;
+
+  ReadOutput global("test_files/fort.63");
+  global.open();
+  for (size_t s = 0; s < 43; ++s) {
+    global.read();
+    const OutputRecord *r = global.dataAt(0);
+    for (size_t i = 0; i < elements.size(); ++i) {
+      std::vector<double> w(3);
+      size_t e = mesh.findElement(sx[i], sy[i], w);
+      if (e == Adcirc::Geometry::Mesh::ELEMENT_NOT_FOUND) return 1;
+      double expected = 0.0;
+      bool wet = true;
+      for (size_t j = 0; j < 3; ++j) {
+        const double z =
+            r->z(mesh.nodeIndexById(mesh.element(e)->node(j)->id()));
+        if (z == defaultOutputValue()) wet = false;
+        expected += w[j] * z;
+      }
+      if (!wet) continue;
+      if (std::abs(h.station(i)->data(s) - expected) > 1e-6) {
+        std::cout << "Station " << i << " snap " << s << ": "
+                  << h.station(i)->data(s) << " expected " << expected
+                  << std::endl;
+        return 1;
+      }
+    }
+    global.clearAt(0);
+  }
+
+  //...After the run the interpolated values are available through the
+  //   station level accessors
+  StationInterpolationOptions options;
+  options.setMesh("test_files/internal_overflow.grd");
+  options.setGlobalfile("test_files/fort.63");
+  options.setStationfile("test_files/stations_internal_overflow.txt");
+  options.readStations();
+  options.setOutputfile("test_files/stations_accessor.imeds");
+  options.setColdstart("20000101000000");
+  options.setStartsnap(1);
+  options.setEndsnap(43);
+  StationInterpolation interp(options);
+  interp.run();
+
+  Hmdf *result = interp.stations();
+  if (result->isColumnar() || result->nstations() != h.nstations()) {
+    std::cout << "Station data was not moved into the stations" << std::endl;
+    return 1;
+  }
+  for (size_t i = 0; i < result->nstations(); ++i) {
+    if (result->station(i)->numSnaps() != 43) {
+      std::cout << "Station " << i << " has "
+                << result->station(i)->numSnaps() << " snaps" << std::endl;
+      return 1;
+    }
+    for (size_t s = 0; s < 43; ++s) {
+      if (std::abs(result->station(i)->data(s) - h.station(i)->data(s)) >
+              1e-6 ||
+          result->station(i)->date(s) != h.station(i)->date(s)) {
+        std::cout << "Station " << i << " snap " << s
+                  << " does not match the output file" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  //...Weights written to the cache hold fixed width fields without padding
+  const std::string cache = "test_files/stations_weights.bin";
+  std::remove(cache.c_str());
+  if (interpolate("test_files/fort.63", "test_files/stations_cache.imeds",
+                  false, cache) != serial) {
+    return 1;
+  }
+  std::vector<char> bytes;
+  {
+    std::ifstream fid(cache, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(fid),
+                 std::istreambuf_iterator<char>());
+  }
+  const size_t magicSize = sizeof("ADCMOD_STATION_WEIGHTS");
+  const size_t recordSize = 1 + 3 * 8 + 3 * 8;
+  if (bytes.size() < magicSize + 12) return 1;
+  uint64_t keyLength = 0;
+  for (size_t i = 0; i < 8; ++i) {
+    keyLength |= static_cast<uint64_t>(
+                     static_cast<unsigned char>(bytes[magicSize + 4 + i]))
+                 << (8 * i);
+  }
+  const size_t records = magicSize + 12 + keyLength + 8;
+  if (bytes.size() != records + sx.size() * recordSize) {
+    std::cout << "Weight cache has an unexpected size" << std::endl;
+    return 1;
+  }
+
+  //...A cache hit uses the stored weights, so replacing the weights of the
+  //   first station with those of a single vertex changes the result
+  auto writeCache = [&]() {
+    std::ofstream fid(cache, std::ios::binary | std::ios::trunc);
+    fid.write(bytes.data(), bytes.size());
+  };
+  const double vertexWeights[3] = {1.0, 0.0, 0.0};
+  std::memcpy(&bytes[records + 25], vertexWeights, sizeof(vertexWeights));
+  writeCache();
+  if (interpolate("test_files/fort.63", "test_files/stations_cache.imeds",
+                  false, cache) == serial) {
+    std::cout << "Weight cache was not used" << std::endl;
+    return 1;
+  }
+
+  //...A cache generated for a different key is rebuilt
+  bytes[magicSize + 12] ^= 0x1;
+  writeCache();
+  if (interpolate("test_files/fort.63", "test_files/stations_cache.imeds",
+                  false, cache) != serial) {
+    std::cout << "Weight cache with a different key was not rebuilt"
+              << std::endl;
+    return 1;
+  }
+
+  std::remove(cache.c_str());
+
+  return 0;
+}
@@ -0,0 +1,85 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "adcircmodules.h"
+
+std::string readFile(const std::string &filename) {
+  std::ifstream f(filename);
+  std::stringstream ss;
+  ss << f.rdbuf();
+  return ss.str();
+}
+
+int main() {
+  using namespace Adcirc::Output;
+
+  const size_t nstations = 3;
+  const size_t nsnap = 25;
+
+  Hmdf rows, columns;
+  for (size_t i = 0; i < nstations; ++i) {
+    HmdfStation s;
+    s.setName("station_" + std::to_string(i));
+    s.setLongitude(-90.0 + i);
+    s.setLatitude(29.0 + i);
+    rows.addStation(s);
+    columns.addStation(s);
+  }
+
+  columns.allocate(nsnap);
+  Adcirc::CDate start(2019, 8, 1, 0, 0, 0);
+  for (size_t j = 0; j < nsnap; ++j) {
+    Adcirc::CDate d = start;
+    d.addSeconds(static_cast<long>(j * 3600));
+    columns.setTime(j, d);
+    for (size_t i = 0; i < nstations; ++i) {
+      double v = std::sin(0.1 * j + i) * 1.5;
+      rows.station(i)->setNext(d, v);
+      columns.setValue(i, j, v);
+    }
+  }
+
+  rows.writeImeds("test_files/hmdf_rows.imeds");
+  columns.writeImeds("test_files/hmdf_columns.imeds");
+  rows.writeCsv("test_files/hmdf_rows.csv");
+  columns.writeCsv("test_files/hmdf_columns.csv");
+
+  if (readFile("test_files/hmdf_rows.imeds") !=
+      readFile("test_files/hmdf_columns.imeds")) {
+    std::cout << "Columnar IMEDS output does not match" << std::endl;
+    return 1;
+  }
+
+  if (readFile("test_files/hmdf_rows.csv") !=
+      readFile("test_files/hmdf_columns.csv")) {
+    std::cout << "Columnar CSV output does not match" << std::endl;
+    return 1;
+  }
+
+  columns.toStations();
+  if (columns.isColumnar() || columns.station(2)->numSnaps() != nsnap ||
+      columns.station(2)->date(5) != rows.station(2)->date(5)) {
+    std::cout << "Columnar data was not copied to the stations" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
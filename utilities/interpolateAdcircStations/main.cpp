@@ -55,7 +55,8 @@ int main(int argc, char *argv[]) {
                      ("readAsciiMesh", "Force the code to read an ascii meshfile instead of defaulting to the NetCDF ADCIRC output file data")
                      ("epsg_global","Specify the coordinate system of the global time series file (default: 4326)",cxxopts::value<int>())
                      ("epsg_station","Specify the coordinate system of the input station locations (default: 4326)",cxxopts::value<int>())
-                     ("epsg_output","Specify the coordinate system of the output data file (default: 4326)",cxxopts::value<int>());
+                     ("epsg_output","Specify the coordinate system of the output data file (default: 4326)",cxxopts::value<int>())
+                     ("weight_cache","Reuse station interpolation weights stored in this file when the mesh and stations are unchanged",cxxopts::value<std::string>());
   // clang-format on
 
   if (argc == 1) {
@@ -118,6 +119,8 @@ Adcirc::Output::StationInterpolationOptions parseCommandLineOptions(
     input.setEpsgOutput(parser["epsg_output"].as<int>());
   if (parser["epsg_station"].count() > 0)
     input.setEpsgStation(parser["epsg_station"].as<int>());
+  if (parser["weight_cache"].count() > 0)
+    input.setWeightCacheFile(parser["weight_cache"].as<std::string>());
   if (parser["positive_direction"].count() > 0) {
     std::string positive_direction_string =
         parser["positive_direction"].as<std::string>();